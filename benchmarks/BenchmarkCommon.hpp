@@ -0,0 +1,64 @@
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <BufferView.hpp>
+#include <Logger.hpp>
+#include <VrmlFile.hpp>
+#include <VrmlNodeManager.hpp>
+#include <VrmlParser.hpp>
+
+#include "SceneGenerators.hpp"
+
+namespace vrmlx::benchmarks {
+  /**
+   * @brief Gets a directory for temporary files of the benchmarks. It is created if it does not exist.
+   *
+   * @returns path to the directory
+   */
+  inline std::filesystem::path GetTemporaryDirectory() {
+    auto directory = std::filesystem::temp_directory_path() / "vrmlx_benchmarks";
+    std::filesystem::create_directories(directory);
+    return directory;
+  }
+
+  /**
+   * @brief Writes text into a file.
+   *
+   * @param filepath path to the file
+   * @param text text to write
+   */
+  inline void WriteTextFile(const std::filesystem::path& filepath, const std::string& text) {
+    std::ofstream stream(filepath, std::ios::binary);
+    stream << text;
+  }
+
+  /**
+   * @brief Parses the scene. Benchmark is skipped with an error message if the scene cannot be parsed.
+   *
+   * @param state benchmark state
+   * @param scene scene to parse
+   * @param manager manager for DEF nodes
+   * @param file output parsed file
+   * @returns true if parsing succeeded
+   */
+  inline bool ParseScene(benchmark::State& state,
+      const Scene& scene,
+      vrml_proc::parser::service::VrmlNodeManager& manager,
+      vrml_proc::parser::model::VrmlFile& file) {  //
+
+    vrml_proc::parser::VrmlParser parser(manager);
+    auto result = parser.Parse(
+        vrml_proc::parser::BufferView(scene.text.data(), scene.text.data() + scene.text.size()));
+    if (result.has_error()) {
+      state.SkipWithError("Generated scene could not be parsed.");
+      return false;
+    }
+    file = std::move(result.value());
+    return true;
+  }
+}  // namespace vrmlx::benchmarks
@@ -0,0 +1,25 @@
+#include <benchmark/benchmark.h>
+
+#include <Logger.hpp>
+
+#include "BenchmarkCommon.hpp"
+
+/**
+ * Entry point of `vrmlx_benchmarks`. Logging must be initialized, otherwise all messages would be buffered in memory
+ * for the whole run. For results suitable for regression tracking, run it with
+ * `--benchmark_out=<file>.json --benchmark_out_format=json`.
+ */
+int main(int argc, char** argv) {
+  vrml_proc::core::logger::LoggingSettings settings;
+  settings.asynchronous = true;
+  vrml_proc::core::logger::InitLogging(
+      vrmlx::benchmarks::GetTemporaryDirectory().string(), "vrmlx_benchmarks", settings);
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
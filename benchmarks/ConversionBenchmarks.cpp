@@ -0,0 +1,334 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <BoxCalculator.hpp>
+#include <CalculatorResult.hpp>
+#include <ConversionContextActionExecutor.hpp>
+#include <ConversionContextActionMap.hpp>
+#include <HandlerToActionBundle.hpp>
+#include <Hash.hpp>
+#include <IndexedFaceSetCalculator.hpp>
+#include <Int32Array.hpp>
+#include <Mesh.hpp>
+#include <MeshTask.hpp>
+#include <MeshTaskConversionContext.hpp>
+#include <ObjFileWriter.hpp>
+#include <PipelineTaskRunner.hpp>
+#include <PlyFileWriter.hpp>
+#include <StlFileWriter.hpp>
+#include <ThreadTaskRunner.hpp>
+#include <ToGeomActionMap.hpp>
+#include <ToGeomConfig.hpp>
+#include <TransformationMatrix.hpp>
+#include <Vec3f.hpp>
+#include <Vec3fArray.hpp>
+#include <VrmlFile.hpp>
+#include <VrmlFileTraversor.hpp>
+#include <VrmlHeaders.hpp>
+#include <VrmlNodeManager.hpp>
+
+#include "BenchmarkCommon.hpp"
+#include "SceneGenerators.hpp"
+
+/**
+ * Throughput of traversal (nodes/s), i.e. creation of mesh tasks from the parsed scene. Tasks are not run.
+ */
+
+static void RunTraverse(benchmark::State& state, const vrmlx::benchmarks::Scene& scene) {
+  using namespace to_geom::conversion_context;
+
+  vrml_proc::parser::service::VrmlNodeManager manager;
+  vrml_proc::parser::model::VrmlFile file;
+  if (!vrmlx::benchmarks::ParseScene(state, scene, manager, file)) {
+    return;
+  }
+
+  auto config = std::make_shared<to_geom::core::config::ToGeomConfig>();
+  auto headers = vrml_proc::traversor::node_descriptor::VrmlHeaders();
+  auto traversor = vrml_proc::traversor::VrmlFileTraversor<MeshTaskConversionContext>(
+      manager, config, GetActionMap(), headers);
+
+  for (auto _ : state) {
+    auto result = traversor.Traverse(file);
+    if (result.has_error()) {
+      state.SkipWithError("Generated scene could not be traversed.");
+      break;
+    }
+    benchmark::DoNotOptimize(result.value());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * scene.nodesCount));
+}
+
+static void BM_TraverseDeepTransform(benchmark::State& state) {
+  RunTraverse(state, vrmlx::benchmarks::GenerateDeepTransformScene(static_cast<size_t>(state.range(0))));
+}
+BENCHMARK(BM_TraverseDeepTransform)->Arg(512)->Unit(benchmark::kMicrosecond);
+
+static void BM_TraverseManyBoxes(benchmark::State& state) {
+  RunTraverse(state, vrmlx::benchmarks::GenerateManyBoxesScene(static_cast<size_t>(state.range(0))));
+}
+BENCHMARK(BM_TraverseManyBoxes)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void BM_TraverseInstanced(benchmark::State& state) {
+  RunTraverse(state, vrmlx::benchmarks::GenerateInstancedScene(16, static_cast<size_t>(state.range(0))));
+}
+BENCHMARK(BM_TraverseInstanced)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+static void BM_TraverseTextured(benchmark::State& state) {
+  RunTraverse(state, vrmlx::benchmarks::GenerateTexturedScene(static_cast<size_t>(state.range(0)), 4));
+}
+BENCHMARK(BM_TraverseTextured)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+/**
+ * Per-node cost of action dispatch (nodes/s). Runtime dispatch goes through `std::function` and creates the action on
+ * the heap, static dispatch uses the static action table of togeom. As in the handlers, the action is found by the
+ * canonical id of the node, which is resolved before the dispatch.
+ */
+static void RunActionDispatch(benchmark::State& state, bool staticDispatch) {
+  using namespace to_geom::conversion_context;
+  using vrml_proc::traversor::utils::ConversionContextActionExecutor::TryToExecute;
+
+  vrml_proc::action::ConversionContextActionMap<MeshTaskConversionContext> actionMap;
+  if (staticDispatch) {
+    actionMap.SetStaticActions(StaticActions);
+  } else {
+    for (const auto& action : StaticActions) {
+      actionMap.AddAction(std::string(action.key), action.create);
+    }
+  }
+
+  const std::vector<std::string> keys = {"Group", "Transform"};
+  const std::vector<uint32_t> ids = {vrml_proc::core::utils::Hash(keys[0]), vrml_proc::core::utils::Hash(keys[1])};
+  vrml_proc::traversor::handler::HandlerToActionBundle<MeshTaskConversionContext> data;
+  size_t node = 0;
+  for (auto _ : state) {
+    size_t index = node++ % keys.size();
+    auto result = TryToExecute(actionMap, ids[index], keys[index], data);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+static void BM_ActionDispatchRuntime(benchmark::State& state) { RunActionDispatch(state, false); }
+BENCHMARK(BM_ActionDispatchRuntime);
+
+static void BM_ActionDispatchStatic(benchmark::State& state) { RunActionDispatch(state, true); }
+BENCHMARK(BM_ActionDispatchStatic);
+
+/**
+ * Throughput of IndexedFaceSet mesh generation (triangles/s).
+ */
+static void BM_IndexedFaceSetCalculator(benchmark::State& state) {
+  vrml_proc::parser::model::Vec3fArray coordinates;
+  vrml_proc::parser::model::Int32Array coordinateIndices;
+  vrmlx::benchmarks::GenerateGrid(static_cast<size_t>(state.range(0)), coordinates, coordinateIndices);
+  bool checkRange = state.range(1) != 0;
+
+  to_geom::calculator::IndexedFaceSetCalculator calculator;
+  vrml_proc::math::TransformationMatrix matrix;
+  for (auto _ : state) {
+    auto result =
+        calculator.Generate3DMesh(std::cref(coordinateIndices), std::cref(coordinates), matrix, checkRange);
+    if (result.has_error()) {
+      state.SkipWithError("Mesh could not be generated.");
+      break;
+    }
+    benchmark::DoNotOptimize(result.value());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * coordinateIndices.integers.size() / 4));
+}
+BENCHMARK(BM_IndexedFaceSetCalculator)
+    ->ArgsProduct({{256, 1024}, {0, 1}})
+    ->ArgNames({"size", "checkRange"})
+    ->Unit(benchmark::kMillisecond);
+
+/**
+ * Data of mesh tasks with a skewed size distribution: many small IndexedFaceSets and one huge IndexedFaceSet submitted
+ * last.
+ */
+struct SkewedMeshTasks {
+  static constexpr size_t SmallTasksCount = 2000;
+
+  SkewedMeshTasks() {
+    vrmlx::benchmarks::GenerateGrid(16, smallCoordinates, smallCoordinateIndices);
+    vrmlx::benchmarks::GenerateGrid(1024, hugeCoordinates, hugeCoordinateIndices);
+  }
+
+  SkewedMeshTasks(const SkewedMeshTasks&) = delete;
+  SkewedMeshTasks& operator=(const SkewedMeshTasks&) = delete;
+
+  std::vector<to_geom::core::MeshTask> CreateTasks() const {
+    auto createTask = [this](const auto& coordinates, const auto& coordinateIndices) {
+      return to_geom::core::MeshTask(
+          [&coordinates, &coordinateIndices, this]() {
+            return to_geom::calculator::IndexedFaceSetCalculator().Generate3DMesh(
+                std::cref(coordinateIndices), std::cref(coordinates), matrix, false);
+          },
+          coordinates.vectors.size() + coordinateIndices.integers.size());
+    };
+
+    std::vector<to_geom::core::MeshTask> tasks;
+    for (size_t i = 0; i < SmallTasksCount; ++i) {
+      tasks.push_back(createTask(smallCoordinates, smallCoordinateIndices));
+    }
+    tasks.push_back(createTask(hugeCoordinates, hugeCoordinateIndices));
+    return tasks;
+  }
+
+  vrml_proc::parser::model::Vec3fArray smallCoordinates;
+  vrml_proc::parser::model::Int32Array smallCoordinateIndices;
+  vrml_proc::parser::model::Vec3fArray hugeCoordinates;
+  vrml_proc::parser::model::Int32Array hugeCoordinateIndices;
+  vrml_proc::math::TransformationMatrix matrix;
+};
+
+/**
+ * Wall-clock time of running the skewed mesh tasks on all threads by `ThreadTaskRunner`. Tasks are run either in the
+ * submission order or longest-first with batching.
+ */
+static void BM_SkewedMeshTasks(benchmark::State& state) {
+  using to_geom::calculator::CalculatorResult;
+  using to_geom::core::MeshTask;
+
+  bool longestFirst = state.range(0) != 0;
+
+  SkewedMeshTasks data;
+  std::vector<MeshTask> tasks = data.CreateTasks();
+
+  std::vector<size_t> costs;
+  for (const auto& task : tasks) {
+    costs.push_back(task.GetCost());
+  }
+
+  vrml_proc::core::parallelism::ThreadTaskRunner<MeshTask, CalculatorResult> runner;
+  for (auto _ : state) {
+    std::vector<CalculatorResult> results;
+    if (longestFirst) {
+      runner.Run(tasks, results, costs, MeshTask::BatchCost);
+    } else {
+      runner.Run(tasks, results);
+    }
+    benchmark::DoNotOptimize(results);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * tasks.size()));
+}
+BENCHMARK(BM_SkewedMeshTasks)->Arg(0)->Arg(1)->ArgName("longestFirst")->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/**
+ * Wall-clock time of streaming the skewed mesh tasks through `PipelineTaskRunner`, as the conversion does, and
+ * consuming their results in the completion order. Tasks are submitted either without costs (started in the
+ * submission order) or with their costs (longest-first with batching).
+ */
+static void BM_SkewedMeshTasksPipeline(benchmark::State& state) {
+  using to_geom::calculator::CalculatorResult;
+  using to_geom::core::MeshTask;
+
+  bool longestFirst = state.range(0) != 0;
+
+  SkewedMeshTasks data;
+  for (auto _ : state) {
+    vrml_proc::core::parallelism::PipelineTaskRunner<MeshTask, CalculatorResult> runner(
+        std::thread::hardware_concurrency(), longestFirst ? MeshTask::BatchCost : 0);
+    auto consuming = std::async(std::launch::async, [&runner]() {
+      return runner.Consume([](CalculatorResult&& result) { benchmark::DoNotOptimize(result); });
+    });
+
+    for (auto& task : data.CreateTasks()) {
+      size_t cost = longestFirst ? task.GetCost() : 0;
+      runner.Submit(std::move(task), cost);
+    }
+    runner.Close();
+    consuming.wait();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * (SkewedMeshTasks::SmallTasksCount + 1)));
+}
+BENCHMARK(BM_SkewedMeshTasksPipeline)
+    ->Arg(0)
+    ->Arg(1)
+    ->ArgName("longestFirst")
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+/**
+ * Cost of merging many small submeshes into the final mesh (submeshes/s).
+ */
+static void BM_MeshMerge(benchmark::State& state) {
+  auto count = static_cast<size_t>(state.range(0));
+
+  to_geom::calculator::BoxCalculator calculator;
+  vrml_proc::parser::model::Vec3f size(1.0f, 2.0f, 3.0f);
+  vrml_proc::math::TransformationMatrix matrix;
+  std::vector<std::shared_ptr<to_geom::core::Mesh>> submeshes;
+  for (size_t i = 0; i < count; ++i) {
+    auto result = calculator.Generate3DMesh(std::cref(size), matrix);
+    if (result.has_error()) {
+      state.SkipWithError("Mesh could not be generated.");
+      return;
+    }
+    submeshes.push_back(result.value());
+  }
+
+  for (auto _ : state) {
+    to_geom::core::Mesh mesh;
+    for (const auto& submesh : submeshes) {
+      mesh.join(*submesh);
+    }
+    benchmark::DoNotOptimize(mesh);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_MeshMerge)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+/**
+ * Throughput of writers (bytes/s of the output file).
+ */
+template <typename Writer>
+static void RunWrite(benchmark::State& state, Writer writer, const std::string& extension) {
+  vrml_proc::parser::model::Vec3fArray coordinates;
+  vrml_proc::parser::model::Int32Array coordinateIndices;
+  vrmlx::benchmarks::GenerateGrid(static_cast<size_t>(state.range(0)), coordinates, coordinateIndices);
+
+  to_geom::calculator::IndexedFaceSetCalculator calculator;
+  auto result = calculator.Generate3DMesh(
+      std::cref(coordinateIndices), std::cref(coordinates), vrml_proc::math::TransformationMatrix(), false);
+  if (result.has_error()) {
+    state.SkipWithError("Mesh could not be generated.");
+    return;
+  }
+
+  auto filepath = vrmlx::benchmarks::GetTemporaryDirectory() / ("write." + extension);
+  for (auto _ : state) {
+    auto writeResult = writer.Write(filepath, *(result.value()));
+    if (writeResult.has_error()) {
+      state.SkipWithError("Mesh could not be written.");
+      break;
+    }
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * std::filesystem::file_size(filepath)));
+}
+
+static void BM_WriteBinaryStl(benchmark::State& state) {
+  RunWrite(state, to_geom::core::io::StlFileWriter(true), "stl");
+}
+BENCHMARK(BM_WriteBinaryStl)->Arg(1024)->Unit(benchmark::kMillisecond);
+
+static void BM_WriteAsciiStl(benchmark::State& state) {
+  RunWrite(state, to_geom::core::io::StlFileWriter(false), "stl");
+}
+BENCHMARK(BM_WriteAsciiStl)->Arg(1024)->Unit(benchmark::kMillisecond);
+
+static void BM_WriteBinaryPly(benchmark::State& state) {
+  RunWrite(state, to_geom::core::io::PlyFileWriter(true), "ply");
+}
+BENCHMARK(BM_WriteBinaryPly)->Arg(1024)->Unit(benchmark::kMillisecond);
+
+static void BM_WriteObj(benchmark::State& state) { RunWrite(state, to_geom::core::io::ObjFileWriter(), "obj"); }
+BENCHMARK(BM_WriteObj)->Arg(1024)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <MetricsCollector.hpp>
+
+#include "vrmlx.hpp"
+
+#include "BenchmarkCommon.hpp"
+#include "SceneGenerators.hpp"
+
+/**
+ * Whole conversion (read, parse, traverse, generate, merge and write) of a generated scene, as run by the application.
+ * Wall time of each stage of the last iteration is reported as a counter. If `parallel` is false, the meshes are
+ * generated sequentially after the traversal of each root node instead of in the pipeline.
+ */
+static void RunConversion(benchmark::State& state, const vrmlx::benchmarks::Scene& scene, const std::string& name,
+    bool parallel = true) {
+  auto directory = vrmlx::benchmarks::GetTemporaryDirectory();
+  auto inputFilepath = directory / (name + ".wrl");
+  auto outputFilepath = directory / (name + ".stl");
+  auto configFilepath = directory / "config.json";
+
+  vrmlx::benchmarks::WriteTextFile(inputFilepath, scene.text);
+  vrmlx::benchmarks::WriteTextFile(configFilepath, R"({
+  "logFileDirectory": ")" + directory.generic_string() + R"(",
+  "logFileName": "vrmlx_benchmarks",
+  "loggingSettings": { "asynchronous": true },
+  "exportFormat": { "format": "stl" },
+  "IFSSettings": { "checkRange": false },
+  "parallelismSettings": { "active": )" + std::string(parallel ? "true" : "false") + R"( }
+})");
+
+  std::vector<vrml_proc::core::metrics::StageMetrics> stages;
+  for (auto _ : state) {
+    vrml_proc::core::metrics::MetricsCollector metrics;
+
+    // The conversion reports its progress on the standard output.
+    std::ostringstream silenced;
+    auto* original = std::cout.rdbuf(silenced.rdbuf());
+    bool successful =
+        vrmlx::ConvertVrmlToGeom(inputFilepath.string(), outputFilepath.string(), configFilepath.string(), metrics);
+    std::cout.rdbuf(original);
+
+    if (!successful) {
+      state.SkipWithError("Generated scene could not be converted.");
+      break;
+    }
+    stages = metrics.GetStages();
+  }
+
+  for (const auto& stage : stages) {
+    state.counters[stage.name + "Time"] = stage.wallTime;
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * scene.text.size()));
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * scene.trianglesCount));
+}
+
+static void BM_ConvertDeepTransform(benchmark::State& state) {
+  RunConversion(state, vrmlx::benchmarks::GenerateDeepTransformScene(static_cast<size_t>(state.range(0))),
+      "deepTransform");
+}
+BENCHMARK(BM_ConvertDeepTransform)->Arg(512)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_ConvertHugeIndexedFaceSet(benchmark::State& state) {
+  RunConversion(state, vrmlx::benchmarks::GenerateHugeIndexedFaceSetScene(static_cast<size_t>(state.range(0))),
+      "hugeIndexedFaceSet");
+}
+BENCHMARK(BM_ConvertHugeIndexedFaceSet)->Arg(1024)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_ConvertManyBoxes(benchmark::State& state) {
+  RunConversion(
+      state, vrmlx::benchmarks::GenerateManyBoxesScene(static_cast<size_t>(state.range(0))), "manyBoxes");
+}
+BENCHMARK(BM_ConvertManyBoxes)->Arg(10000)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_ConvertInstanced(benchmark::State& state) {
+  RunConversion(
+      state, vrmlx::benchmarks::GenerateInstancedScene(64, static_cast<size_t>(state.range(0))), "instanced");
+}
+BENCHMARK(BM_ConvertInstanced)->Arg(256)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+/**
+ * Sequential (`parallel` 0) and pipelined (`parallel` 1) conversion of the same scene with all its geometry under one
+ * root node.
+ */
+static void BM_ConvertGroupedShapes(benchmark::State& state) {
+  RunConversion(state, vrmlx::benchmarks::GenerateGroupedShapesScene(static_cast<size_t>(state.range(0)), 64),
+      "groupedShapes", state.range(1) != 0);
+}
+BENCHMARK(BM_ConvertGroupedShapes)
+    ->ArgNames({"shapes", "parallel"})
+    ->Args({256, 0})
+    ->Args({256, 1})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+#include <BufferView.hpp>
+#include <VrmlNodeManager.hpp>
+#include <VrmlParser.hpp>
+#include <VrmlScanner.hpp>
+
+#include "BenchmarkCommon.hpp"
+#include "SceneGenerators.hpp"
+
+/**
+ * Throughput of parsing (bytes/s) of all kinds of generated scenes. Parsing includes DEF nodes population.
+ */
+
+static void RunParse(benchmark::State& state, const vrmlx::benchmarks::Scene& scene, bool schemaAware = false) {
+  vrml_proc::parser::BufferView buffer(scene.text.data(), scene.text.data() + scene.text.size());
+  for (auto _ : state) {
+    vrml_proc::parser::service::VrmlNodeManager manager;
+    vrml_proc::parser::VrmlParser parser(manager, schemaAware);
+    auto result = parser.Parse(buffer);
+    if (result.has_error()) {
+      state.SkipWithError("Generated scene could not be parsed.");
+      break;
+    }
+    benchmark::DoNotOptimize(result.value());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * scene.text.size()));
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * scene.nodesCount));
+}
+
+static void BM_ParseDeepTransform(benchmark::State& state) {
+  RunParse(state, vrmlx::benchmarks::GenerateDeepTransformScene(static_cast<size_t>(state.range(0))));
+}
+BENCHMARK(BM_ParseDeepTransform)->Arg(64)->Arg(512)->Unit(benchmark::kMillisecond);
+
+static void BM_ParseHugeIndexedFaceSet(benchmark::State& state) {
+  RunParse(state, vrmlx::benchmarks::GenerateHugeIndexedFaceSetScene(static_cast<size_t>(state.range(0))));
+}
+BENCHMARK(BM_ParseHugeIndexedFaceSet)->Arg(256)->Arg(1024)->Unit(benchmark::kMillisecond);
+
+static void BM_ParseManyBoxes(benchmark::State& state) {
+  RunParse(state, vrmlx::benchmarks::GenerateManyBoxesScene(static_cast<size_t>(state.range(0))));
+}
+BENCHMARK(BM_ParseManyBoxes)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void BM_ParseInstanced(benchmark::State& state) {
+  RunParse(state, vrmlx::benchmarks::GenerateInstancedScene(64, static_cast<size_t>(state.range(0))));
+}
+BENCHMARK(BM_ParseInstanced)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+/**
+ * Texture-heavy scene parsed with the generic field value alternative (second argument 0) and with the schema-aware
+ * parsing (second argument 1), which parses every known field by the single grammar of its type.
+ */
+static void BM_ParseTextured(benchmark::State& state) {
+  RunParse(state, vrmlx::benchmarks::GenerateTexturedScene(static_cast<size_t>(state.range(0)), 32),
+      state.range(1) != 0);
+}
+BENCHMARK(BM_ParseTextured)->Args({64, 0})->Args({64, 1})->Unit(benchmark::kMillisecond);
+
+/**
+ * Throughput of the structural scan (bytes/s), which does not build the AST.
+ */
+static void BM_ScanHugeIndexedFaceSet(benchmark::State& state) {
+  auto scene = vrmlx::benchmarks::GenerateHugeIndexedFaceSetScene(static_cast<size_t>(state.range(0)));
+  vrml_proc::parser::BufferView buffer(scene.text.data(), scene.text.data() + scene.text.size());
+  for (auto _ : state) {
+    vrml_proc::parser::VrmlScanner scanner;
+    auto result = scanner.Parse(buffer);
+    if (result.has_error()) {
+      state.SkipWithError("Generated scene could not be scanned.");
+      break;
+    }
+    benchmark::DoNotOptimize(result.value());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * scene.text.size()));
+}
+BENCHMARK(BM_ScanHugeIndexedFaceSet)->Arg(1024)->Unit(benchmark::kMillisecond);
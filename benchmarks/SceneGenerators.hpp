@@ -0,0 +1,218 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+#include <Int32Array.hpp>
+#include <Vec3f.hpp>
+#include <Vec3fArray.hpp>
+
+/**
+ * Generators of synthetic VRML scenes used by the benchmarks. All of them are deterministic: the same parameters always
+ * give byte-identical output on every platform, so that results of different runs (and commits) are comparable.
+ */
+namespace vrmlx::benchmarks {
+  /**
+   * @brief Represents a generated scene.
+   */
+  struct Scene {
+    std::string text;
+    /** @brief Number of nodes in the scene, USE nodes included. */
+    size_t nodesCount = 0;
+    /** @brief Number of triangles of the converted scene. */
+    size_t trianglesCount = 0;
+  };
+
+  /**
+   * @brief Fills grid of `size` x `size` points in the XY plane with a deterministic height field, and its quads split
+   * into triangles (in the form of coordinate indices of IndexedFaceSet).
+   *
+   * @param size number of points along one side of the grid, at least 2
+   * @param coordinates output points
+   * @param coordinateIndices output coordinate indices
+   */
+  inline void GenerateGrid(size_t size,
+      vrml_proc::parser::model::Vec3fArray& coordinates,
+      vrml_proc::parser::model::Int32Array& coordinateIndices) {  //
+
+    coordinates.vectors.clear();
+    coordinates.vectors.reserve(size * size);
+    for (size_t row = 0; row < size; ++row) {
+      for (size_t column = 0; column < size; ++column) {
+        float height = static_cast<float>((row * 7 + column * 13) % 17) * 0.125f;
+        coordinates.vectors.emplace_back(static_cast<float>(column), static_cast<float>(row), height);
+      }
+    }
+
+    coordinateIndices.integers.clear();
+    coordinateIndices.integers.reserve((size - 1) * (size - 1) * 8);
+    for (size_t row = 0; row + 1 < size; ++row) {
+      for (size_t column = 0; column + 1 < size; ++column) {
+        auto index = static_cast<int32_t>(row * size + column);
+        auto width = static_cast<int32_t>(size);
+        coordinateIndices.integers.insert(coordinateIndices.integers.end(),
+            {index, index + 1, index + width + 1, -1, index, index + width + 1, index + width, -1});
+      }
+    }
+  }
+
+  /**
+   * @brief Writes IndexedFaceSet node with a grid (see `GenerateGrid()`).
+   *
+   * @param stream output stream
+   * @param size number of points along one side of the grid
+   * @param textured flag indicating if texture coordinates (one per point, spanning the whole grid) and their indices
+   * are written too
+   */
+  inline void WriteGridIndexedFaceSet(std::ostringstream& stream, size_t size, bool textured = false) {
+    vrml_proc::parser::model::Vec3fArray coordinates;
+    vrml_proc::parser::model::Int32Array coordinateIndices;
+    GenerateGrid(size, coordinates, coordinateIndices);
+
+    stream << "IndexedFaceSet {\n  coord Coordinate {\n    point [\n";
+    stream << std::fixed << std::setprecision(3);
+    for (size_t i = 0; i < coordinates.vectors.size(); ++i) {
+      const auto& point = coordinates.vectors[i];
+      stream << "      " << point.x << " " << point.y << " " << point.z
+             << (i + 1 < coordinates.vectors.size() ? ",\n" : "\n");
+    }
+    stream << "    ]\n  }\n  coordIndex [\n";
+    for (size_t i = 0; i < coordinateIndices.integers.size(); i += 4) {
+      stream << "    " << coordinateIndices.integers[i] << ", " << coordinateIndices.integers[i + 1] << ", "
+             << coordinateIndices.integers[i + 2] << ", -1"
+             << (i + 4 < coordinateIndices.integers.size() ? ",\n" : "\n");
+    }
+    stream << "  ]\n";
+    if (textured) {
+      stream << "  texCoord TextureCoordinate {\n    point [\n";
+      for (size_t i = 0; i < coordinates.vectors.size(); ++i) {
+        stream << "      " << static_cast<float>(i % size) / (size - 1) << " "
+               << static_cast<float>(i / size) / (size - 1) << (i + 1 < coordinates.vectors.size() ? ",\n" : "\n");
+      }
+      stream << "    ]\n  }\n  texCoordIndex [\n";
+      for (size_t i = 0; i < coordinateIndices.integers.size(); i += 4) {
+        stream << "    " << coordinateIndices.integers[i] << ", " << coordinateIndices.integers[i + 1] << ", "
+               << coordinateIndices.integers[i + 2] << ", -1"
+               << (i + 4 < coordinateIndices.integers.size() ? ",\n" : "\n");
+      }
+      stream << "  ]\n";
+    }
+    stream << "}\n";
+  }
+
+  /**
+   * @brief Generates a chain of `depth` nested Transform nodes, each of them translated, rotated and scaled, with a
+   * single Box at the bottom.
+   *
+   * @param depth number of nested Transform nodes
+   * @returns scene
+   */
+  inline Scene GenerateDeepTransformScene(size_t depth) {
+    std::ostringstream stream;
+    stream << "#VRML V2.0 utf8\n";
+    for (size_t level = 0; level < depth; ++level) {
+      stream << "Transform {\n  translation " << (level % 3) << " 1 0\n  rotation 0 0 1 0.1\n  scale 1 1 1\n"
+             << "  children [\n";
+    }
+    stream << "Shape { geometry Box { size 1 2 3 } }\n";
+    for (size_t level = 0; level < depth; ++level) {
+      stream << "  ]\n}\n";
+    }
+    return {stream.str(), depth + 2, 12};
+  }
+
+  /**
+   * @brief Generates a single Shape with one huge IndexedFaceSet (a grid of `size` x `size` points).
+   *
+   * @param size number of points along one side of the grid
+   * @returns scene
+   */
+  inline Scene GenerateHugeIndexedFaceSetScene(size_t size) {
+    std::ostringstream stream;
+    stream << "#VRML V2.0 utf8\nShape {\ngeometry ";
+    WriteGridIndexedFaceSet(stream, size);
+    stream << "}\n";
+    return {stream.str(), 3, (size - 1) * (size - 1) * 2};
+  }
+
+  /**
+   * @brief Generates `count` root Transform nodes, each with one small Box.
+   *
+   * @param count number of boxes
+   * @returns scene
+   */
+  inline Scene GenerateManyBoxesScene(size_t count) {
+    std::ostringstream stream;
+    stream << "#VRML V2.0 utf8\n";
+    for (size_t i = 0; i < count; ++i) {
+      stream << "Transform { translation " << (i % 100) << " " << (i / 100) << " 0 children [ Shape { geometry Box { "
+             << "size 0.5 0.5 " << (1 + i % 5) << " } } ] }\n";
+    }
+    return {stream.str(), count * 3, count * 12};
+  }
+
+  /**
+   * @brief Generates a single root Group with `count` Shape children, each with an IndexedFaceSet (a grid of `size` x
+   * `size` points). All the geometry is under one root node, so it can be pipelined only per geometry node.
+   *
+   * @param count number of shapes
+   * @param size number of points along one side of the grid
+   * @returns scene
+   */
+  inline Scene GenerateGroupedShapesScene(size_t count, size_t size) {
+    std::ostringstream stream;
+    stream << "#VRML V2.0 utf8\nGroup {\nchildren [\n";
+    for (size_t i = 0; i < count; ++i) {
+      stream << "Shape {\ngeometry ";
+      WriteGridIndexedFaceSet(stream, size);
+      stream << "}\n";
+    }
+    stream << "]\n}\n";
+    return {stream.str(), 1 + count * 3, count * (size - 1) * (size - 1) * 2};
+  }
+
+  /**
+   * @brief Generates `count` root Shape nodes, each with a material, an image texture with a texture transform and a
+   * textured IndexedFaceSet (a grid of `size` x `size` points).
+   *
+   * @param count number of shapes
+   * @param size number of points along one side of the grid
+   * @returns scene
+   */
+  inline Scene GenerateTexturedScene(size_t count, size_t size) {
+    std::ostringstream stream;
+    stream << "#VRML V2.0 utf8\n";
+    for (size_t i = 0; i < count; ++i) {
+      stream << "Shape {\nappearance Appearance {\n  material Material { diffuseColor 0.8 0.8 0.8 transparency 0 }\n"
+             << "  texture ImageTexture { url \"texture" << i << ".png\" repeatS TRUE repeatT FALSE }\n"
+             << "  textureTransform TextureTransform { scale 2 2 rotation 0.5 }\n}\ngeometry ";
+      WriteGridIndexedFaceSet(stream, size, true);
+      stream << "}\n";
+    }
+    return {stream.str(), count * 8, count * (size - 1) * (size - 1) * 2};
+  }
+
+  /**
+   * @brief Generates one DEF-ined Shape with an IndexedFaceSet (a grid of `size` x `size` points), which is then
+   * instanced `instancesCount` times by USE nodes in translated Transform nodes.
+   *
+   * @param size number of points along one side of the grid
+   * @param instancesCount number of USE instances
+   * @returns scene
+   */
+  inline Scene GenerateInstancedScene(size_t size, size_t instancesCount) {
+    std::ostringstream stream;
+    stream << "#VRML V2.0 utf8\nDEF Tile Shape {\ngeometry ";
+    WriteGridIndexedFaceSet(stream, size);
+    stream << "}\n";
+    for (size_t i = 0; i < instancesCount; ++i) {
+      stream << "Transform { translation " << (i % 32) * size << " " << (i / 32) * size
+             << " 0 children [ USE Tile ] }\n";
+    }
+    size_t tileTriangles = (size - 1) * (size - 1) * 2;
+    return {stream.str(), 3 + instancesCount * 2, tileTriangles * (instancesCount + 1)};
+  }
+}  // namespace vrmlx::benchmarks
@@ -15,4 +15,19 @@ PYBIND11_MODULE(vrmlxpy, m) {
       py::overload_cast<const std::string&, const std::string&, const std::string&>(&vrmlx::ConvertVrmlToGeom),
       "Converts a VRML file to a geometry format based on a configuration file", py::arg("input_filename"),
       py::arg("output_filename"), py::arg("config_filename"));
+
+  m.def(
+      "convert_vrml_with_metrics",
+      [](const std::string& inputFilename, const std::string& outputFilename, const std::string& configFilename) {
+        vrml_proc::core::metrics::MetricsCollector metrics;
+        vrmlx::ConvertVrmlToGeom(inputFilename, outputFilename, configFilename, metrics);
+        return metrics.ToJson().dump(2);
+      },
+      "Converts a VRML file to a geometry format based on a configuration file and returns a JSON performance report "
+      "of the conversion",
+      py::arg("input_filename"), py::arg("output_filename"), py::arg("config_filename"));
+
+  m.def("scan_vrml", &vrmlx::ScanVrmlFile,
+      "Checks the structure of a VRML file without converting it and prints its statistics", py::arg("input_filename"),
+      py::arg("config_filename") = "");
 }
\ No newline at end of file
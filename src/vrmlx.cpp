@@ -1,16 +1,22 @@
 #include "vrmlx.hpp"
 #include "vrmlx_logo.hpp"
 
+#include <cstdint>
 #include <memory>
 #include <filesystem>
+#include <fstream>
+#include <map>
+#include <optional>
 #include <future>
 #include <iostream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 #include <thread>
 
 #include <BufferView.hpp>
 #include <CalculatorResult.hpp>
+#include <GzipFileReader.hpp>
 #include <Logger.hpp>
 #include <MemoryMappedFileReader.hpp>
 #include <Mesh.hpp>
@@ -22,15 +28,21 @@
 #include <VrmlFileTraversor.hpp>
 #include <VrmlNodeManager.hpp>
 #include <VrmlParser.hpp>
+#include <VrmlScanner.hpp>
 #include <VrmlProcConfig.hpp>
 #include <ToGeomConfig.hpp>
+#include <Tracer.hpp>
 #include <ExportFormats.hpp>
 #include <FileWriter.hpp>
 #include <ManualTimer.hpp>
-#include <ThreadTaskRunner.hpp>
+#include <MetricsCollector.hpp>
+#include <PipelineTaskRunner.hpp>
 #include <MeshTask.hpp>
 #include <MeshSimplificator.hpp>
+#include <NodeDescriptorMap.hpp>
 #include <VrmlHeaders.hpp>
+#include <VrmlFile.hpp>
+#include <VrmlNode.hpp>
 
 static unsigned int g_task = 1;
 
@@ -67,6 +79,115 @@ static void PrintInvalidSubmeshMessage(to_geom::calculator::CalculatorResult mes
   std::cout << "Encountered an invalid submesh:\n" << meshResult.error()->GetMessage() << std::endl;
 }
 
+/**
+ * @brief Reads the input file. Gzip-compressed files (e.g. `.wrl.gz`) are inflated into one contiguous buffer, other
+ * files are memory mapped. Both are then accessed through the same BufferView.
+ *
+ * @param inputFilename input VRML file
+ * @param threads maximal number of threads used for decompression
+ * @param mappedFile storage for memory mapped file, it must outlive the returned view
+ * @param decompressedFile storage for decompressed file, it must outlive the returned view
+ * @returns view into the file content or error
+ */
+static cpp::result<vrml_proc::parser::BufferView, std::shared_ptr<vrml_proc::core::error::Error>> ReadInputFile(
+    const std::string& inputFilename, unsigned int threads,
+    std::optional<vrml_proc::core::io::MemoryMappedFile>& mappedFile,
+    std::optional<vrml_proc::core::io::DecompressedFile>& decompressedFile) {  //
+
+  using namespace vrml_proc::core::io;
+  using vrml_proc::parser::BufferView;
+
+  if (GzipFileReader::IsGzipFile(std::filesystem::path(inputFilename))) {
+    GzipFileReader reader(threads);
+    auto readResult = reader.Read(std::filesystem::path(inputFilename));
+    if (readResult.has_error()) {
+      return cpp::fail(readResult.error());
+    }
+    decompressedFile.emplace(std::move(readResult.value()));
+    return BufferView(decompressedFile->GetBegin(), decompressedFile->GetEnd());
+  }
+
+  MemoryMappedFileReader reader;
+  auto readResult = reader.Read(std::filesystem::path(inputFilename));
+  if (readResult.has_error()) {
+    return cpp::fail(readResult.error());
+  }
+  mappedFile.emplace(readResult.value());
+  return BufferView(mappedFile->GetBegin(), mappedFile->GetEnd());
+}
+
+/**
+ * @brief Counts nodes of each type in the subtree of the node. USE nodes are counted under the type `USE`.
+ *
+ * @param node root of the subtree
+ * @param nodeTypesCount map to which the counts are added
+ */
+static void CountNodeTypes(
+    const vrml_proc::parser::model::VrmlNode& node, std::map<std::string, uint64_t>& nodeTypesCount) {
+  using namespace vrml_proc::parser::model;
+
+  nodeTypesCount[node.header]++;
+  for (const auto& field : node.fields) {
+    if (const auto* child = boost::get<VrmlNode>(&field.value)) {
+      CountNodeTypes(*child, nodeTypesCount);
+    } else if (boost::get<UseNode>(&field.value) != nullptr) {
+      nodeTypesCount["USE"]++;
+    } else if (const auto* children = boost::get<VrmlNodeArray>(&field.value)) {
+      for (const auto& item : *children) {
+        if (const auto* child = boost::get<VrmlNode>(&item)) {
+          CountNodeTypes(*child, nodeTypesCount);
+        } else {
+          nodeTypesCount["USE"]++;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Counts nodes of each type in the whole file.
+ *
+ * @param file parsed VRML file
+ * @returns map from node type to the number of nodes
+ */
+static std::map<std::string, uint64_t> CountNodeTypes(const vrml_proc::parser::model::VrmlFile& file) {
+  std::map<std::string, uint64_t> nodeTypesCount;
+  for (const auto& root : file) {
+    CountNodeTypes(root, nodeTypesCount);
+  }
+  return nodeTypesCount;
+}
+
+/**
+ * @brief Writes the performance report into a JSON file. Failure to write the report does not fail the conversion,
+ * only a warning is printed.
+ *
+ * @param filepath path to the report
+ * @param metrics collected metrics
+ */
+static void WriteMetricsReport(
+    const std::filesystem::path& filepath, const vrml_proc::core::metrics::MetricsCollector& metrics) {
+  std::ofstream stream(filepath);
+  if (!stream.is_open()) {
+    std::cout << "Warning: performance report <" << filepath.string() << "> could not be written." << std::endl;
+    return;
+  }
+  stream << metrics.ToJson().dump(2) << std::endl;
+}
+
+/**
+ * @brief Writes the recorded trace into a JSON file. Failure to write the trace does not fail the conversion, only a
+ * warning is printed.
+ *
+ * @param filepath path to the trace
+ */
+static void WriteTrace(const std::filesystem::path& filepath) {
+  auto result = vrml_proc::core::metrics::Tracer::WriteChromeTrace(filepath);
+  if (result.has_error()) {
+    std::cout << "Warning: trace <" << filepath.string() << "> could not be written." << std::endl;
+  }
+}
+
 namespace vrmlx {
 
   void PrintVersion() {
@@ -102,8 +223,17 @@ namespace vrmlx {
     return "txt";
   }
 
-  bool ConvertVrmlToGeom(
-      const std::string& inputFilename, const std::string& outputFilename, const std::string& configFilename) {  //
+  /**
+   * @brief Runs the conversion, see `ConvertVrmlToGeom()`. Metrics which are only needed for the report (e.g. number
+   * of nodes of each type) are collected only if the report is requested by the caller or by the configuration file.
+   *
+   * @param reportRequested flag indicating that the caller reads the collected metrics
+   */
+  static bool RunConversion(const std::string& inputFilename,
+      const std::string& outputFilename,
+      const std::string& configFilename,
+      vrml_proc::core::metrics::MetricsCollector& metrics,
+      bool reportRequested) {  //
 
     using namespace std::filesystem;
     using namespace to_geom::core::config;
@@ -117,6 +247,8 @@ namespace vrmlx {
     using namespace vrml_proc::core::utils;
     using namespace to_geom::core;
     using namespace to_geom::calculator;
+    using vrml_proc::core::metrics::TraceSpan;
+    using vrml_proc::core::metrics::Tracer;
 
     // -------------------------------------------------------------------------------------------------------------
 
@@ -135,7 +267,26 @@ namespace vrmlx {
       return false;
     }
 
-    InitLogging(config->logFileDirectory, config->logFileName);
+    InitLogging(config->logFileDirectory, config->logFileName, config->loggingSettings);
+    Tracer::SetEnabled(config->tracingSettings.active);
+
+    /**
+     * Ends the conversion: the stage in progress is ended and the performance report and the trace are written if
+     * they are enabled.
+     */
+    auto finish = [&](bool successful) {
+      metrics.EndStage();
+      metrics.SetSuccessful(successful);
+      if (config->metricsReportSettings.active) {
+        WriteMetricsReport(path(outputFilename + ".metrics.json"), metrics);
+      }
+      if (config->tracingSettings.active) {
+        Tracer::SetEnabled(false);
+        WriteTrace(path(outputFilename + ".trace.json"));
+      }
+      return successful;
+    };
+
     PrintProgressInformation(
         FormatString("configuration file <", path(configFilename).string(), "> was succesfully read."));
 
@@ -155,53 +306,144 @@ namespace vrmlx {
 
     // -------------------------------------------------------------------------------------------------------------
 
-    MemoryMappedFileReader reader;
-    auto readResult = reader.Read(path(inputFilename));
+    metrics.StartStage("read");
+
+    std::optional<MemoryMappedFile> mappedFile;
+    std::optional<DecompressedFile> decompressedFile;
+    unsigned int decompressionThreads =
+        config->parallelismSettings.active ? config->parallelismSettings.threadsNumberLimit : 1;
+    auto readResult = [&]() {
+      auto span = TraceSpan("read");
+      return ReadInputFile(inputFilename, decompressionThreads, mappedFile, decompressedFile);
+    }();
     if (readResult.has_error()) {
       PrintApplicationError(readResult.error());
-      return false;
+      return finish(false);
     }
+    BufferView buffer = readResult.value();
+
+    metrics.EndStage().bytesRead = file_size(path(inputFilename));
+    metrics.SetCounter("inputBytes", static_cast<uint64_t>(buffer.end - buffer.begin));
 
     PrintProgressInformation(FormatString("file <", path(inputFilename).string(), "> was succesfully read."));
 
     // -------------------------------------------------------------------------------------------------------------
 
+    metrics.StartStage("parse");
+
     service::VrmlNodeManager manager;
-    VrmlParser parser(manager);
-    auto parseResult = parser.Parse(BufferView(readResult.value().GetBegin(), readResult.value().GetEnd()));
+    grammar::SkippedFields skippedFields;
+    if (config->fieldProjectionSettings.active) {
+      const auto& requestedFields = GetActionMap().GetRequestedFields();
+      if (requestedFields.has_value()) {
+        skippedFields = GetUnrequestedArrayFields(requestedFields.value());
+      }
+      for (const auto& field : config->fieldProjectionSettings.skippedFields) {
+        grammar::AddSkippedField(skippedFields, field);
+      }
+    }
+    VrmlParser parser(manager, config->schemaAwareParsing, skippedFields);
+    if (!config->prunedNodes.empty()) {
+      std::unordered_set<std::string> prunedHeaders(config->prunedNodes.begin(), config->prunedNodes.end());
+      prunedHeaders.merge(headers.GetSynonymsForCanonicalHeaders(prunedHeaders));
+      parser.SetPrunedHeaders(prunedHeaders);
+    }
+    auto parseResult = parser.Parse(buffer);
     if (parseResult.has_error()) {
       PrintApplicationError(parseResult.error());
-      return false;
+      return finish(false);
+    }
+
+    metrics.EndStage();
+    metrics.SetCounter("rootNodes", parseResult.value().size());
+    if (reportRequested || config->metricsReportSettings.active) {
+      metrics.SetNodeTypesCount(CountNodeTypes(parseResult.value()));
     }
 
     PrintProgressInformation(FormatString("file <", path(inputFilename).string(), "> was succesfully parsed."));
 
     // -------------------------------------------------------------------------------------------------------------
 
+    /**
+     * Traversal, mesh generation and merging are pipelined. Each geometry node releases its mesh task to the worker
+     * threads right when it is visited, while the traversal continues with the following nodes. Finished submeshes are
+     * joined into the final mesh by a single consumer in the order in which they finish, so each submesh is freed right
+     * after it is joined. The final mesh consists of the same faces as in the sequential run, only their order may
+     * differ. Tasks are run with the executor of the runner, so a task generating a huge mesh splits its work among the
+     * same worker threads instead of creating its own.
+     */
     auto traversor = VrmlFileTraversor<MeshTaskConversionContext>(manager, config, GetActionMap(), headers);
-    auto convertResult = traversor.Traverse(parseResult.value());
-    if (convertResult.has_error()) {
-      PrintApplicationError(convertResult.error());
-      return false;
-    }
 
-    PrintProgressInformation(FormatString("file <", path(inputFilename).string(), "> was succesfully traversed."));
-
-    // -------------------------------------------------------------------------------------------------------------
+    to_geom::core::Mesh mesh;
+    auto joinSubmesh = [&mesh](CalculatorResult&& submeshResult) {
+      if (submeshResult.has_value()) {
+        auto submesh = submeshResult.value();
+        auto span = TraceSpan("merge submesh", "merge");
+        span.AddArgument("triangles", submesh->number_of_faces());
+        mesh.join(*submesh);
+        submesh.reset();
+      } else {
+        PrintInvalidSubmeshMessage(submeshResult);
+      }
+    };
+
+    /**
+     * Each mesh task is wrapped, so that its generation time is recorded. Its span is annotated with the root node the
+     * task was created from.
+     */
+    auto measureTask = [&metrics, &parseResult](const MeshTask& task, size_t rootIndex, tf::Executor* executor) {
+      auto span = TraceSpan("mesh task", "generation");
+      if (span.IsActive()) {
+        span.AddArgument("rootIndex", rootIndex + 1);
+        span.AddArgument("header", parseResult.value()[rootIndex].header);
+      }
+      ManualTimer taskTimer;
+      taskTimer.Start();
+      auto result = task(executor);
+      metrics.RecordTask(taskTimer.End(), result.has_value());
+      if (span.IsActive() && result.has_value() && result.value() != nullptr) {
+        span.AddArgument("triangles", result.value()->number_of_faces());
+      }
+      return result;
+    };
+
+    /**
+     * In the per-part simplification mode, each submesh is simplified right after it is generated, as a part of its
+     * mesh task. So the simplification runs on the worker threads and the merged mesh is never simplified as a whole.
+     */
+    const auto& simplificationSettings = config->meshSimplificationSettings;
+    const bool simplifySubmeshes =
+        simplificationSettings.active && simplificationSettings.mode == SimplificationMode::PerPart;
+    auto runTask = [&measureTask, &simplificationSettings, simplifySubmeshes](
+                       const MeshTask& task, size_t rootIndex, tf::Executor* executor) {
+      auto result = measureTask(task, rootIndex, executor);
+      if (simplifySubmeshes && result.has_value() && result.value() != nullptr) {
+        auto span = TraceSpan("simplify submesh", "simplification");
+        span.AddArgument("triangles", result.value()->number_of_faces());
+        to_geom::calculator::MeshSimplificator::SimplifySubmesh(*result.value(), simplificationSettings);
+      }
+      return result;
+    };
 
-    LogInfo(
-        FormatString("Generation of total ", convertResult.value()->GetData().size(), " meshes begins."), LOGGING_INFO);
+    metrics.StartStage("convert");
 
     vrml_proc::core::utils::ManualTimer timer;
     timer.Start();
 
-    std::vector<CalculatorResult> submeshesResults;
-    submeshesResults.reserve(convertResult.value()->GetData().size());
+    size_t meshesCount = 0;
+    size_t rootIndex = 0;
+    cpp::result<void, std::shared_ptr<vrml_proc::core::error::Error>> convertResult;
 
     if (!config->parallelismSettings.active) {
-      for (const auto& task : convertResult.value()->GetData()) {
-        submeshesResults.emplace_back(task());
-      }
+      convertResult = traversor.Traverse(
+          parseResult.value(), [&joinSubmesh, &runTask, &meshesCount, &rootIndex](
+                                   std::shared_ptr<MeshTaskConversionContext> context) {
+            context->ForEach([&joinSubmesh, &runTask, &meshesCount, &rootIndex](const MeshTask& task) {
+              joinSubmesh(runTask(task, rootIndex, nullptr));
+              meshesCount++;
+            });
+            rootIndex++;
+          });
     } else {
       unsigned int availableThreadsNumber = std::thread::hardware_concurrency();
       if (availableThreadsNumber > config->parallelismSettings.threadsNumberLimit) {
@@ -211,32 +453,72 @@ namespace vrmlx {
       LogInfo(
           FormatString("Generation will be parallely computed on ", availableThreadsNumber, " threads."), LOGGING_INFO);
 
-      auto runner = vrml_proc::core::parallelism::ThreadTaskRunner<MeshTask, CalculatorResult>(availableThreadsNumber);
-      runner.Run(convertResult.value()->GetData(), submeshesResults);
-    }
-
-    to_geom::core::Mesh mesh;
-    for (auto& submeshResult : submeshesResults) {
-      if (submeshResult.has_value()) {
-        auto submesh = submeshResult.value();
-        mesh.join(*submesh);
-        submesh.reset();
-      } else {
-        PrintInvalidSubmeshMessage(submeshResult);
+      vrml_proc::core::parallelism::PipelineTaskRunner<MeshTask, CalculatorResult> runner(
+          availableThreadsNumber, MeshTask::BatchCost);
+      auto merging = std::async(std::launch::async, [&runner, &joinSubmesh]() { return runner.Consume(joinSubmesh); });
+
+      /**
+       * Each geometry action submits its mesh task to the runner right when it is created, so the meshes are generated
+       * while the traversal is still running, even inside one huge root node. The sink refers to the runner, so it is
+       * removed from the configuration before the runner is destroyed.
+       */
+      config->meshTaskSink = [&runner, &runTask, &rootIndex](MeshTask&& task) {
+        size_t cost = task.GetCost();
+        runner.Submit(
+            [task = std::move(task), &runner, &runTask, rootIndex]() {
+              return runTask(task, rootIndex, &runner.GetExecutor());
+            },
+            cost);
+      };
+
+      /**
+       * The consumer returns only after the runner is closed (and the future of `std::async` blocks in its destructor
+       * until it does), so the runner must be closed even if the traversal throws.
+       */
+      try {
+        convertResult = traversor.Traverse(
+            parseResult.value(), [&rootIndex](std::shared_ptr<MeshTaskConversionContext>) { rootIndex++; });
+      } catch (...) {
+        config->meshTaskSink = nullptr;
+        runner.Close();
+        merging.wait();
+        throw;
       }
+
+      config->meshTaskSink = nullptr;
+      runner.Close();
+      meshesCount = merging.get();
     }
 
     double time = timer.End();
-    LogInfo(
-        FormatString("Generation and merging of meshes ended. The generation took ", time, " seconds."), LOGGING_INFO);
+
+    if (convertResult.has_error()) {
+      PrintApplicationError(convertResult.error());
+      return finish(false);
+    }
+
+    metrics.EndStage();
+    metrics.SetCounter("meshTasks", meshesCount);
+
+    PrintProgressInformation(FormatString("file <", path(inputFilename).string(), "> was succesfully traversed."));
+
+    LogInfo(FormatString("Traversal, generation and merging of total ", meshesCount, " meshes ended. The process took ",
+                time, " seconds."),
+        LOGGING_INFO);
 
     // -------------------------------------------------------------------------------------------------------------
 
-    if (config->meshSimplificationSettings.active) {
-      to_geom::calculator::MeshSimplificator::SimplifyMesh(
-          mesh, config->meshSimplificationSettings.percentageOfAllEdgesToSimplify.GetComplement());
+    if (simplificationSettings.active && simplificationSettings.mode == SimplificationMode::Global) {
+      metrics.StartStage("simplify");
+      auto span = TraceSpan("simplify", "simplification");
+      span.AddArgument("triangles", mesh.number_of_faces());
+      to_geom::calculator::MeshSimplificator::SimplifyMesh(mesh, simplificationSettings);
+      metrics.EndStage();
     }
 
+    metrics.SetCounter("vertices", mesh.number_of_vertices());
+    metrics.SetCounter("faces", mesh.number_of_faces());
+
     PrintProgressInformation(FormatString(
         "mesh was succesfully generated", ((config->meshSimplificationSettings.active) ? " and simplified." : ".")));
 
@@ -258,17 +540,93 @@ namespace vrmlx {
         break;
     }
 
-    auto writeResult = writer->Write(path(outputFilename), mesh);
+    metrics.StartStage("write");
+
+    auto writeResult = [&]() {
+      auto span = TraceSpan("write");
+      return writer->Write(path(outputFilename), mesh);
+    }();
     if (writeResult.has_error()) {
       PrintApplicationError(writeResult.error());
-      return false;
+      return finish(false);
     }
 
+    metrics.EndStage().bytesWritten = file_size(path(outputFilename));
+
     PrintProgressInformation(FormatString("file <", path(outputFilename).string(), "> was succesfully written."));
 
     // -------------------------------------------------------------------------------------------------------------
 
     std::cout << ">>> Conversion of VRML file to geometry format finished succesfully.\n" << std::endl;
+    return finish(true);
+  }
+
+  bool ConvertVrmlToGeom(
+      const std::string& inputFilename, const std::string& outputFilename, const std::string& configFilename) {
+    vrml_proc::core::metrics::MetricsCollector metrics;
+    return RunConversion(inputFilename, outputFilename, configFilename, metrics, false);
+  }
+
+  bool ConvertVrmlToGeom(const std::string& inputFilename,
+      const std::string& outputFilename,
+      const std::string& configFilename,
+      vrml_proc::core::metrics::MetricsCollector& metrics) {
+    return RunConversion(inputFilename, outputFilename, configFilename, metrics, true);
+  }
+
+  bool ScanVrmlFile(const std::string& inputFilename, const std::string& configFilename) {  //
+
+    using namespace std::filesystem;
+    using namespace to_geom::core::config;
+    using namespace vrml_proc::core::io;
+    using namespace vrml_proc::parser;
+
+    // -------------------------------------------------------------------------------------------------------------
+
+    std::cout << "\n>>> Scanning VRML file..." << std::endl;
+
+    ToGeomConfig config;
+    if (!configFilename.empty()) {
+      auto configResult = config.Load(configFilename);
+      if (configResult.has_error()) {
+        PrintApplicationError(configResult.error());
+        return false;
+      }
+    }
+
+    std::optional<MemoryMappedFile> mappedFile;
+    std::optional<DecompressedFile> decompressedFile;
+    unsigned int decompressionThreads =
+        config.parallelismSettings.active ? config.parallelismSettings.threadsNumberLimit : 1;
+    auto readResult = ReadInputFile(inputFilename, decompressionThreads, mappedFile, decompressedFile);
+    if (readResult.has_error()) {
+      PrintApplicationError(readResult.error());
+      return false;
+    }
+
+    VrmlScanner scanner;
+    auto scanResult = scanner.Parse(readResult.value());
+    if (scanResult.has_error()) {
+      PrintApplicationError(scanResult.error());
+      return false;
+    }
+
+    const auto& statistics = scanResult.value();
+    std::cout << "File <" << path(inputFilename).string() << "> has a valid VRML structure.\n"
+              << "  bytes:              " << statistics.bytesCount << "\n"
+              << "  nodes:              " << statistics.nodesCount << " (" << statistics.rootNodesCount
+              << " root nodes, maximal depth " << statistics.maxDepth << ")\n"
+              << "  DEF / USE:          " << statistics.defNodesCount << " / " << statistics.useNodesCount << "\n"
+              << "  fields:             " << statistics.fieldsCount << "\n"
+              << "  numbers:            " << statistics.numbersCount << "\n"
+              << "  coordinates:        " << statistics.coordinatesCount << "\n"
+              << "  coordinate indices: " << statistics.coordinateIndicesCount << " (" << statistics.facesCount
+              << " faces)\n";
+    for (const auto& [type, count] : statistics.nodeTypesCount) {
+      std::cout << "    " << type << ": " << count << "\n";
+    }
+    std::cout << std::endl;
+
     return true;
   }
 }  // namespace vrmlx
\ No newline at end of file
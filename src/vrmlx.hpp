@@ -2,6 +2,8 @@
 
 #include <string>
 
+#include <MetricsCollector.hpp>
+
 namespace vrmlx {
   /**
    * @brief Prints current vrmlx version.
@@ -28,4 +30,34 @@ namespace vrmlx {
    */
   bool ConvertVrmlToGeom(
       const std::string& inputFilename, const std::string& outputFilename, const std::string& configFilename);
+
+  /**
+   * @brief Converts a VRML file (`inputFilename`) into a geometry representation (given by configuration file) and
+   * writes result in `outputFileName`. Performance metrics of each stage of the conversion are collected into
+   * `metrics`, regardless of the configuration file. If the report is enabled in the configuration file, it is also
+   * written next to the output file as `<outputFilename>.metrics.json`.
+   *
+   * @param inputFilename input VRML file
+   * @param outputFilename output file
+   * @param configFilename path to configuration file
+   * @param metrics collector of performance metrics
+   *
+   * @returns true if conversion was successfull, otherwise false
+   */
+  bool ConvertVrmlToGeom(const std::string& inputFilename,
+      const std::string& outputFilename,
+      const std::string& configFilename,
+      vrml_proc::core::metrics::MetricsCollector& metrics);
+
+  /**
+   * @brief Scans a VRML file (`inputFilename`) without building the AST. Checks its structure and prints statistics
+   * about its content (number of nodes, coordinates, faces, etc.) or the position of the first structural error.
+   *
+   * @param inputFilename input VRML file
+   * @param configFilename optional path to configuration file, its parallelism settings limit the number of threads
+   * decompressing the file; default settings are used if it is empty
+   *
+   * @returns true if the file has a valid structure, otherwise false
+   */
+  bool ScanVrmlFile(const std::string& inputFilename, const std::string& configFilename = "");
 }  // namespace vrmlx
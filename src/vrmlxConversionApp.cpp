@@ -1,25 +1,45 @@
 #include "vrmlx.hpp"
 
+#include <algorithm>
 #include <filesystem>
 #include <iostream>
+#include <set>
 #include <string>
+#include <vector>
 
 static inline void PrintHelp(const std::string& app) {
-  std::cout << "\nThere are two modes for this application. Either single conversion (default) or bulk conversion.\n";
+  std::cout << "\nThere are three modes for this application. Either single conversion (default), bulk conversion or "
+               "scan.\n";
   std::cout << "For single conversion, you do not specify the mode:\n";
   std::cout << "\t" << app << " <input_file> <output_file> <config_file>\n\n";
   std::cout << "For bulk conversion, you must specify the mode by adding option '--bulk':\n";
   std::cout << "\t" << app << " --bulk <input_folder> <output_folder>\n";
+  std::cout << "To only check the structure of a VRML file and print its statistics, use option '--scan':\n";
+  std::cout << "\t" << app << " --scan <input_file> [<config_file>]\n";
 
   std::cout << "\n-------------------------------------------------------------------------------------\n\nThe "
                "<config_file> is a JSON file with the "
                "following options (all have default values):\n";
   std::cout << "  \"ignoreUnknownNode\": Whether to ignore unrecognized VRML nodes (default: false).\n";
+  std::cout << "  \"schemaAwareParsing\": Parse values of known fields directly by the grammar of their type (default: "
+               "true).\n";
+  std::cout << "  \"fieldProjection\":\n";
+  std::cout << "    \"active\": Skip parsing of numeric array fields which no conversion action reads (default: "
+               "false).\n";
+  std::cout << "    \"skippedFields\": Additional numeric array fields to skip, written as \"Header.field\" (default: "
+               "empty).\n";
+  std::cout << "  \"prunedNodes\": Headers of nodes whose bodies are not parsed and which are ignored (default: "
+               "empty).\n";
   std::cout << "  \"logFileName\": The base name of the log file (default: \"vrmlproc\").\n";
   std::cout << "  \"logFileDirectory\": Directory where logs will be written (default: \".\").\n";
   std::cout
       << "  \"synonymsFile\": Path to a JSON file defining node name synonyms (default: file './synonymsFile.json').\n";
 
+  std::cout << "  \"loggingSettings\":\n";
+  std::cout << "    \"asynchronous\": Write the log file on a background thread (default: false).\n";
+  std::cout << "    \"flushIntervalMilliseconds\": Interval of periodic log file flushes in asynchronous mode, 0 "
+               "disables them (default: 1000).\n";
+
   std::cout << "  \"exportFormat\":\n";
   std::cout
       << "    \"format\": The output format. Possible values are \"stl\", \"ply\", and \"obj\" (default: \"stl\").\n";
@@ -34,15 +54,91 @@ static inline void PrintHelp(const std::string& app) {
 
   std::cout << "  \"meshSimplification\":\n";
   std::cout << "    \"active\": Whether to simplify meshes after conversion (default: false).\n";
+  std::cout << "    \"mode\": Simplify the merged mesh ('global') or each submesh in parallel ('perPart') "
+               "(default: 'global').\n";
+  std::cout << "    \"stopPredicate\": When to stop simplifying: 'edgeCountRatio', 'faceCount' or 'errorBound' "
+               "(default: 'edgeCountRatio').\n";
   std::cout << "    \"percentageOfAllEdgesToSimplify\": Percentage of edges to simplify if enabled (default: 50).\n";
+  std::cout << "    \"targetFaceCount\": Number of faces for the 'faceCount' predicate, 'global' mode only "
+               "(default: 0).\n";
+  std::cout << "    \"maxError\": Positive error bound required by the 'errorBound' predicate (default: 0).\n";
 
   std::cout << "  \"IFSSettings\":\n";
-  std::cout << "    \"checkRange\": Enable range checking for IndexedFaceSet indices (default: true).\n\n";
+  std::cout << "    \"checkRange\": Enable range checking for IndexedFaceSet indices (default: true).\n";
+  std::cout << "    \"splitThreshold\": IndexedFaceSet with at least this many indices is generated in parallel chunks\n";
+  std::cout << "                      (default: 1048576, 0 disables it).\n";
+
+  std::cout << "  \"pointSet\":\n";
+  std::cout << "    \"alphaValue\": Alpha value of the PointSet reconstruction, not positive value computes the "
+               "optimal one (default: 0).\n";
+
+  std::cout << "  \"tessellation\":\n";
+  std::cout << "    \"segments\": Number of segments of Sphere, Cylinder and Cone around their axis, at least 3 "
+               "(default: 32).\n";
+
+  std::cout << "  \"metricsReport\":\n";
+  std::cout << "    \"active\": Write a JSON performance report as '<output_file>.metrics.json' (default: false).\n";
 
+  std::cout << "  \"tracing\":\n";
+  std::cout
+      << "    \"active\": Write a Chrome trace of the conversion as '<output_file>.trace.json' (default: false).\n\n";
+
+  std::cout << "Input files may be gzip-compressed (e.g. '.wrl.gz' or '.wrz'), they are decompressed in memory.\n";
   std::cout << "Note that <config_file> must be in <input_folder> for bulk conversion!\n" << std::endl;
 }
 
+/**
+ * @brief Checks if the file should be converted in bulk mode. Plain VRML files (`.wrl`, `.vrml`) and gzip-compressed
+ * VRML files (`.wrl.gz`, `.vrml.gz`, `.wrz`) are accepted.
+ *
+ * @param filepath path to the file
+ * @returns true if the file is VRML file, otherwise false
+ */
+static inline bool IsVrmlFile(const std::filesystem::path& filepath) {
+  std::filesystem::path extension = filepath.extension();
+  if (extension == ".gz") {
+    extension = filepath.stem().extension();
+  }
+  return extension == ".wrl" || extension == ".vrml" || extension == ".wrz";
+}
+
+/**
+ * @brief Gets the output file of the input file in bulk mode. It has the name of the input file without its VRML (and
+ * compression) extension.
+ *
+ * @param inputFile path to the input file
+ * @param outputFolder folder of the output files
+ * @param extension extension of the output file (without the dot)
+ * @returns path to the output file
+ */
+static inline std::filesystem::path GetOutputFile(const std::filesystem::path& inputFile,
+    const std::filesystem::path& outputFolder,
+    const std::string& extension) {
+  std::filesystem::path outputFile = outputFolder / inputFile.stem();
+  outputFile.replace_extension(extension);
+  return outputFile;
+}
+
 int main(int argc, char* argv[]) {
+  if ((argc == 3 || argc == 4) && std::string(argv[1]) == "--scan") {
+    if (!std::filesystem::is_regular_file(argv[2])) {
+      std::cout << "Input file does not exist or it is not a valid file!" << std::endl;
+      return -1;
+    }
+
+    if (argc == 4 && !std::filesystem::is_regular_file(argv[3])) {
+      std::cout << "Configuration file does not exist or it is not a valid file!" << std::endl;
+      return -1;
+    }
+
+    vrmlx::PrintVersion();
+
+    if (!vrmlx::ScanVrmlFile(argv[2], argc == 4 ? argv[3] : "")) {
+      return -1;
+    }
+    return 0;
+  }
+
   if (argc != 4) {
     PrintHelp(argv[0]);
     return -1;
@@ -111,17 +207,34 @@ int main(int argc, char* argv[]) {
     std::cout << "\n>>> No files for conversion were found.\n" << std::endl;
   }
 
-  std::string extension = vrmlx::GetExpectedOutputFileExtension(configFilePath.string());
+  /**
+   * Files are converted in the order of their names, so that the names of the output files do not depend on the order
+   * of the directory entries.
+   */
+  std::vector<std::filesystem::path> inputFiles;
   for (const auto& entry : std::filesystem::directory_iterator(inputFolder)) {
-    if (entry.is_regular_file() && (entry.path().extension() == ".wrl" || entry.path().extension() == ".vrml")) {
-      std::string filename = entry.path().filename().string();
-
-      std::filesystem::path outputFile = outputFolder / entry.path().stem();
-      outputFile.replace_extension(extension);
+    if (entry.is_regular_file() && IsVrmlFile(entry.path())) {
+      inputFiles.push_back(entry.path());
+    }
+  }
+  std::sort(inputFiles.begin(), inputFiles.end());
 
-      vrmlx::ConvertVrmlToGeom(entry.path().string(), outputFile.string(), configFilePath.string());
-      std::cout << std::endl;
+  std::string extension = vrmlx::GetExpectedOutputFileExtension(configFilePath.string());
+  std::set<std::filesystem::path> outputFiles;
+  for (const auto& inputFile : inputFiles) {
+    std::filesystem::path outputFile = GetOutputFile(inputFile, outputFolder, extension);
+
+    /** E.g. 'a.wrl' and 'a.wrl.gz' would both be converted to 'a.stl', the latter keeps its full name instead. */
+    if (outputFiles.contains(outputFile)) {
+      std::filesystem::path fullNameOutputFile = outputFolder / (inputFile.filename().string() + "." + extension);
+      std::cout << "Output file <" << outputFile.string() << "> is already used by another input file, <"
+                << inputFile.string() << "> is converted to <" << fullNameOutputFile.string() << "> instead.\n";
+      outputFile = fullNameOutputFile;
     }
+    outputFiles.insert(outputFile);
+
+    vrmlx::ConvertVrmlToGeom(inputFile.string(), outputFile.string(), configFilePath.string());
+    std::cout << std::endl;
   }
 
   return 0;
@@ -1,11 +1,13 @@
 #include "BoxAction.hpp"
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 
 #include "BoxCalculator.hpp"
 #include "GeometryAction.hpp"
 #include "Logger.hpp"
+#include "MeshTask.hpp"
 #include "MeshTaskConversionContext.hpp"
 #include "TransformationMatrix.hpp"
 #include "Vec3f.hpp"
@@ -16,22 +18,26 @@ namespace to_geom::action {
       : to_geom::action::GeometryAction(geometryProperties), m_properties(properties) {}
 
   std::shared_ptr<to_geom::conversion_context::MeshTaskConversionContext> BoxAction::Execute() {
-    vrml_proc::core::logger::LogDebug("Execute BoxAction.", LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Execute BoxAction.");
 
     auto result = std::make_shared<to_geom::conversion_context::MeshTaskConversionContext>();
     if (!m_geometryProperties.containedByShape) {
-      vrml_proc::core::logger::LogDebug(
-          "Return empty data because Box node is not a child of a Shape node.", LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Return empty data because Box node is not a child of a Shape node.");
       return result;
     }
 
     std::reference_wrapper<const vrml_proc::parser::model::Vec3f> size = m_properties.size;
     vrml_proc::math::TransformationMatrix matrix = m_geometryProperties.matrix;
 
-    result->Add([=]() {
-      to_geom::calculator::BoxCalculator calculator = to_geom::calculator::BoxCalculator();
-      return calculator.Generate3DMesh(size, matrix);
-    });
+    /** Box has always 12 triangles. */
+    size_t cost = 12;
+
+    Emit(*result, to_geom::core::MeshTask(
+        [=]() {
+          to_geom::calculator::BoxCalculator calculator = to_geom::calculator::BoxCalculator();
+          return calculator.Generate3DMesh(size, matrix);
+        },
+        cost));
 
     return result;
   }
@@ -0,0 +1,55 @@
+#include "ConeAction.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include "ConeCalculator.hpp"
+#include "GeometryAction.hpp"
+#include "Logger.hpp"
+#include "MeshTask.hpp"
+#include "MeshTaskConversionContext.hpp"
+#include "ToGeomConfig.hpp"
+#include "TransformationMatrix.hpp"
+#include "VrmlUnits.hpp"
+
+namespace to_geom::action {
+
+  ConeAction::ConeAction(Properties properties, GeometryAction::Properties geometryProperties)
+      : to_geom::action::GeometryAction(geometryProperties), m_properties(properties) {}
+
+  std::shared_ptr<to_geom::conversion_context::MeshTaskConversionContext> ConeAction::Execute() {  //
+
+    using vrml_proc::parser::model::float32_t;
+
+    VRMLPROC_LOG_DEBUG("Execute ConeAction.");
+
+    auto result = std::make_shared<to_geom::conversion_context::MeshTaskConversionContext>();
+    if (!m_geometryProperties.containedByShape) {
+      VRMLPROC_LOG_DEBUG("Return empty data because Cone node is not a child of a Shape node.");
+      return result;
+    }
+
+    float32_t bottomRadius = m_properties.bottomRadius.get();
+    float32_t height = m_properties.height.get();
+    bool side = m_properties.side.get();
+    bool bottom = m_properties.bottom.get();
+    unsigned int segments = to_geom::core::config::ToGeomConfig::TessellationSettings().segments;
+    if (m_properties.config != nullptr) {
+      segments = m_properties.config->tessellationSettings.segments;
+    }
+    vrml_proc::math::TransformationMatrix matrix = m_geometryProperties.matrix;
+
+    /** Side and bottom have `segments` * 2 triangles at most. */
+    size_t cost = static_cast<size_t>(segments) * 2;
+
+    Emit(*result, to_geom::core::MeshTask(
+        [=]() {
+          to_geom::calculator::ConeCalculator calculator = to_geom::calculator::ConeCalculator();
+          return calculator.Generate3DMesh(bottomRadius, height, side, bottom, segments, matrix);
+        },
+        cost));
+
+    return result;
+  }
+}  // namespace to_geom::action
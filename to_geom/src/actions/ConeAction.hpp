@@ -0,0 +1,49 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "GeometryAction.hpp"
+#include "MeshTaskConversionContext.hpp"
+#include "ToGeomConfig.hpp"
+#include "VrmlUnits.hpp"
+
+#include "ToGeomExport.hpp"
+
+namespace to_geom::action {
+  /**
+   * @brief Represents an action for the Cone VRML node.
+   *
+   * Converts a VRML `Cone` node into a geometric representation.
+   * Inherits from `GeometryAction` to integrate with the conversion system.
+   */
+  class TOGEOM_API ConeAction : public to_geom::action::GeometryAction {
+   public:
+    /**
+     * @brief Properties for `ConeAction`. See VRML 2.0 specification for more information.
+     */
+    struct Properties {
+      std::reference_wrapper<const vrml_proc::parser::model::float32_t> bottomRadius;
+      std::reference_wrapper<const vrml_proc::parser::model::float32_t> height;
+      std::reference_wrapper<const bool> side;
+      std::reference_wrapper<const bool> bottom;
+      std::shared_ptr<to_geom::core::config::ToGeomConfig> config;
+    };
+
+    /**
+     * @brief Constructs a ConeAction with specified properties.
+     * @param properties properties for ConeAction
+     * @param geometryProperties geometry properties
+     */
+    ConeAction(Properties properties, GeometryAction::Properties geometryProperties);
+
+    /**
+     * @brief Executes the conversion of the Cone node to a mesh representation.
+     * @return A shared pointer to the generated mesh conversion context.
+     */
+    std::shared_ptr<to_geom::conversion_context::MeshTaskConversionContext> Execute() override;
+
+   private:
+    Properties m_properties;
+  };
+}  // namespace to_geom::action
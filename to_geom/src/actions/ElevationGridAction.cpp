@@ -0,0 +1,56 @@
+#include "ElevationGridAction.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include "ElevationGridCalculator.hpp"
+#include "Float32Array.hpp"
+#include "GeometryAction.hpp"
+#include "Logger.hpp"
+#include "MeshTask.hpp"
+#include "MeshTaskConversionContext.hpp"
+#include "ToGeomConfig.hpp"
+#include "TransformationMatrix.hpp"
+#include "VrmlUnits.hpp"
+
+namespace to_geom::action {
+
+  ElevationGridAction::ElevationGridAction(Properties properties, GeometryAction::Properties geometryProperties)
+      : to_geom::action::GeometryAction(geometryProperties), m_properties(properties) {}
+
+  std::shared_ptr<to_geom::conversion_context::MeshTaskConversionContext> ElevationGridAction::Execute() {  //
+
+    using vrml_proc::parser::model::Float32Array;
+    using vrml_proc::parser::model::float32_t;
+
+    VRMLPROC_LOG_DEBUG("Execute ElevationGridAction.");
+
+    auto result = std::make_shared<to_geom::conversion_context::MeshTaskConversionContext>();
+    if (!m_geometryProperties.containedByShape) {
+      VRMLPROC_LOG_DEBUG("Return empty data because ElevationGrid node is not a child of a Shape node.");
+      return result;
+    }
+
+    std::reference_wrapper<const Float32Array> height = m_properties.height;
+    int32_t xDimension = m_properties.xDimension.get();
+    int32_t zDimension = m_properties.zDimension.get();
+    float32_t xSpacing = m_properties.xSpacing.get();
+    float32_t zSpacing = m_properties.zSpacing.get();
+    bool ccw = m_properties.ccw.get();
+    vrml_proc::math::TransformationMatrix matrix = m_geometryProperties.matrix;
+
+    /** Grid has two triangles per cell. */
+    size_t cost = static_cast<size_t>(std::max(xDimension, 1)) * static_cast<size_t>(std::max(zDimension, 1)) * 2;
+
+    Emit(*result, to_geom::core::MeshTask(
+        [=](tf::Executor* executor) {
+          to_geom::calculator::ElevationGridCalculator calculator = to_geom::calculator::ElevationGridCalculator();
+          return calculator.Generate3DMesh(height, xDimension, zDimension, xSpacing, zSpacing, ccw, matrix, executor);
+        },
+        cost));
+
+    return result;
+  }
+}  // namespace to_geom::action
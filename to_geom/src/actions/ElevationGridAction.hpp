@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "Float32Array.hpp"
+#include "GeometryAction.hpp"
+#include "MeshTaskConversionContext.hpp"
+#include "ToGeomConfig.hpp"
+#include "VrmlUnits.hpp"
+
+#include "ToGeomExport.hpp"
+
+namespace to_geom::action {
+  /**
+   * @brief Represents an action for the ElevationGrid VRML node.
+   *
+   * Converts a VRML `ElevationGrid` node into a geometric representation.
+   * Inherits from `GeometryAction` to integrate with the conversion system.
+   */
+  class TOGEOM_API ElevationGridAction : public to_geom::action::GeometryAction {
+   public:
+    /**
+     * @brief Properties for `ElevationGridAction`. See VRML 2.0 specification for more information.
+     */
+    struct Properties {
+      std::reference_wrapper<const vrml_proc::parser::model::Float32Array> height;
+      std::reference_wrapper<const int32_t> xDimension;
+      std::reference_wrapper<const int32_t> zDimension;
+      std::reference_wrapper<const vrml_proc::parser::model::float32_t> xSpacing;
+      std::reference_wrapper<const vrml_proc::parser::model::float32_t> zSpacing;
+      std::reference_wrapper<const bool> ccw;
+      std::shared_ptr<to_geom::core::config::ToGeomConfig> config;
+    };
+
+    /**
+     * @brief Constructs a ElevationGridAction with specified properties.
+     * @param properties properties for ElevationGridAction
+     * @param geometryProperties geometry properties
+     */
+    ElevationGridAction(Properties properties, GeometryAction::Properties geometryProperties);
+
+    /**
+     * @brief Executes the conversion of the ElevationGrid node to a mesh representation.
+     * @return A shared pointer to the generated mesh conversion context.
+     */
+    std::shared_ptr<to_geom::conversion_context::MeshTaskConversionContext> Execute() override;
+
+   private:
+    Properties m_properties;
+  };
+}  // namespace to_geom::action
@@ -0,0 +1,59 @@
+#include "ExtrusionAction.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include "ExtrusionCalculator.hpp"
+#include "Float32Array.hpp"
+#include "GeometryAction.hpp"
+#include "Logger.hpp"
+#include "MeshTask.hpp"
+#include "MeshTaskConversionContext.hpp"
+#include "ToGeomConfig.hpp"
+#include "TransformationMatrix.hpp"
+#include "Vec2fArray.hpp"
+#include "Vec3fArray.hpp"
+
+namespace to_geom::action {
+
+  ExtrusionAction::ExtrusionAction(Properties properties, GeometryAction::Properties geometryProperties)
+      : to_geom::action::GeometryAction(geometryProperties), m_properties(properties) {}
+
+  std::shared_ptr<to_geom::conversion_context::MeshTaskConversionContext> ExtrusionAction::Execute() {  //
+
+    using vrml_proc::parser::model::Float32Array;
+    using vrml_proc::parser::model::Vec2fArray;
+    using vrml_proc::parser::model::Vec3fArray;
+
+    VRMLPROC_LOG_DEBUG("Execute ExtrusionAction.");
+
+    auto result = std::make_shared<to_geom::conversion_context::MeshTaskConversionContext>();
+    if (!m_geometryProperties.containedByShape) {
+      VRMLPROC_LOG_DEBUG("Return empty data because Extrusion node is not a child of a Shape node.");
+      return result;
+    }
+
+    std::reference_wrapper<const Vec2fArray> crossSection = m_properties.crossSection;
+    std::reference_wrapper<const Vec3fArray> spine = m_properties.spine;
+    std::reference_wrapper<const Float32Array> scale = m_properties.scale;
+    std::reference_wrapper<const Float32Array> orientation = m_properties.orientation;
+    bool beginCap = m_properties.beginCap.get();
+    bool endCap = m_properties.endCap.get();
+    bool ccw = m_properties.ccw.get();
+    vrml_proc::math::TransformationMatrix matrix = m_geometryProperties.matrix;
+
+    /** Swept surface has two triangles per cross-section segment and spine segment. */
+    size_t cost = crossSection.get().vectors.size() * spine.get().vectors.size() * 2;
+
+    Emit(*result, to_geom::core::MeshTask(
+        [=](tf::Executor* executor) {
+          to_geom::calculator::ExtrusionCalculator calculator = to_geom::calculator::ExtrusionCalculator();
+          return calculator.Generate3DMesh(
+              crossSection, spine, scale, orientation, beginCap, endCap, ccw, matrix, executor);
+        },
+        cost));
+
+    return result;
+  }
+}  // namespace to_geom::action
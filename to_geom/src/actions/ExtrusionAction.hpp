@@ -0,0 +1,54 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "Float32Array.hpp"
+#include "GeometryAction.hpp"
+#include "MeshTaskConversionContext.hpp"
+#include "ToGeomConfig.hpp"
+#include "Vec2fArray.hpp"
+#include "Vec3fArray.hpp"
+
+#include "ToGeomExport.hpp"
+
+namespace to_geom::action {
+  /**
+   * @brief Represents an action for the Extrusion VRML node.
+   *
+   * Converts a VRML `Extrusion` node into a geometric representation.
+   * Inherits from `GeometryAction` to integrate with the conversion system.
+   */
+  class TOGEOM_API ExtrusionAction : public to_geom::action::GeometryAction {
+   public:
+    /**
+     * @brief Properties for `ExtrusionAction`. See VRML 2.0 specification for more information.
+     */
+    struct Properties {
+      std::reference_wrapper<const vrml_proc::parser::model::Vec2fArray> crossSection;
+      std::reference_wrapper<const vrml_proc::parser::model::Vec3fArray> spine;
+      std::reference_wrapper<const vrml_proc::parser::model::Float32Array> scale;
+      std::reference_wrapper<const vrml_proc::parser::model::Float32Array> orientation;
+      std::reference_wrapper<const bool> beginCap;
+      std::reference_wrapper<const bool> endCap;
+      std::reference_wrapper<const bool> ccw;
+      std::shared_ptr<to_geom::core::config::ToGeomConfig> config;
+    };
+
+    /**
+     * @brief Constructs a ExtrusionAction with specified properties.
+     * @param properties properties for ExtrusionAction
+     * @param geometryProperties geometry properties
+     */
+    ExtrusionAction(Properties properties, GeometryAction::Properties geometryProperties);
+
+    /**
+     * @brief Executes the conversion of the Extrusion node to a mesh representation.
+     * @return A shared pointer to the generated mesh conversion context.
+     */
+    std::shared_ptr<to_geom::conversion_context::MeshTaskConversionContext> Execute() override;
+
+   private:
+    Properties m_properties;
+  };
+}  // namespace to_geom::action
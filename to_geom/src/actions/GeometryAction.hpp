@@ -1,8 +1,11 @@
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <utility>
 
 #include "ConversionContextAction.hpp"
+#include "MeshTask.hpp"
 #include "MeshTaskConversionContext.hpp"
 #include "TransformationMatrix.hpp"
 
@@ -28,6 +31,10 @@ namespace to_geom::action {
        * @brief Transformation matrix that should be applied to geometry nodes.
        */
       vrml_proc::math::TransformationMatrix matrix;
+      /**
+       * @brief Receiver of the created mesh tasks (see `ToGeomConfig::meshTaskSink`), may be empty.
+       */
+      std::function<void(to_geom::core::MeshTask&&)> meshTaskSink;
     };
     /**
      * @brief Constructs a GeometryAction with specified properties.
@@ -46,6 +53,21 @@ namespace to_geom::action {
     virtual std::shared_ptr<to_geom::conversion_context::MeshTaskConversionContext> Execute() = 0;
 
    protected:
+    /**
+     * @brief Hands the created mesh task over to the mesh task sink, so that it may be started right away. If there is
+     * no sink, the task is added to the context returned by the action.
+     *
+     * @param context context returned by the action
+     * @param task created mesh task
+     */
+    void Emit(to_geom::conversion_context::MeshTaskConversionContext& context, to_geom::core::MeshTask&& task) const {
+      if (m_geometryProperties.meshTaskSink) {
+        m_geometryProperties.meshTaskSink(std::move(task));
+        return;
+      }
+      context.Add(std::move(task));
+    }
+
     Properties m_geometryProperties;
   };
 }  // namespace to_geom::action
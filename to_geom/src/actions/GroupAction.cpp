@@ -12,7 +12,7 @@ namespace to_geom::action {
   std::shared_ptr<to_geom::conversion_context::MeshTaskConversionContext> GroupAction::Execute() {
     using to_geom::conversion_context::MeshTaskConversionContext;
 
-    vrml_proc::core::logger::LogDebug("Execute GroupAction.", LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Execute GroupAction.");
 
     auto result = std::make_shared<MeshTaskConversionContext>();
     for (const auto& child : m_properties.children) {
@@ -2,11 +2,12 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 
 #include "GeometryAction.hpp"
 #include "Int32Array.hpp"
 #include "MeshTaskConversionContext.hpp"
-#include "VrmlNode.hpp"
+#include "Vec3fArray.hpp"
 #include "VrmlUnits.hpp"
 #include "ToGeomConfig.hpp"
 
@@ -25,7 +26,7 @@ namespace to_geom::action {
      * @brief Properties for `IndexedFaceSetAction`. See VRML 2.0 specification for more information.
      */
     struct Properties {
-      std::reference_wrapper<const vrml_proc::parser::model::VrmlNode> coord;
+      std::optional<std::reference_wrapper<const vrml_proc::parser::model::Vec3fArray>> coord;
       std::reference_wrapper<const bool> convex;
       std::reference_wrapper<const vrml_proc::parser::model::Int32Array> coordIndex;
       std::shared_ptr<to_geom::core::config::ToGeomConfig> config;
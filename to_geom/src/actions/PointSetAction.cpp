@@ -0,0 +1,71 @@
+#include "PointSetAction.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include <result.hpp>
+
+#include "AlphaShapeCalculator.hpp"
+#include "GeometryAction.hpp"
+#include "Logger.hpp"
+#include "MeshTask.hpp"
+#include "MeshTaskConversionContext.hpp"
+#include "ToGeomConfig.hpp"
+#include "TransformationMatrix.hpp"
+#include "Vec3fArray.hpp"
+
+namespace to_geom::action {
+
+  PointSetAction::PointSetAction(PointSetAction::Properties properties, GeometryAction::Properties geometryProperties)
+      : to_geom::action::GeometryAction(geometryProperties), m_properties(properties) {}
+
+  std::shared_ptr<to_geom::conversion_context::MeshTaskConversionContext> PointSetAction::Execute() {  //
+
+    using to_geom::conversion_context::MeshTaskConversionContext;
+    using vrml_proc::math::TransformationMatrix;
+    using vrml_proc::parser::model::Vec3fArray;
+    using namespace vrml_proc::core::logger;
+
+    VRMLPROC_LOG_DEBUG("Execute PointSetAction.");
+
+    auto result = std::make_shared<MeshTaskConversionContext>();
+
+    if (!m_geometryProperties.containedByShape) {
+      VRMLPROC_LOG_DEBUG("Return empty data because PointSet node is not a child of a Shape node.");
+      return result;
+    }
+
+    /**
+     * Points of the Coordinate VRML node have been resolved already when the PointSet handler validated it.
+     */
+    if (!m_properties.coord.has_value() || m_properties.coord.value().get().vectors.empty()) {
+      VRMLPROC_LOG_DEBUG("Return empty data because PointSet node has no points.");
+      return result;
+    }
+
+    std::reference_wrapper<const Vec3fArray> points = m_properties.coord.value();
+    TransformationMatrix matrix = m_geometryProperties.matrix;
+
+    double alphaValue = 0.0;
+    unsigned int threads = 1;
+    if (m_properties.config != nullptr) {
+      alphaValue = m_properties.config->pointSetSettings.alphaValue;
+      if (m_properties.config->parallelismSettings.active) {
+        threads = m_properties.config->parallelismSettings.threadsNumberLimit;
+      }
+    }
+
+    /** Delaunay triangulation of a point costs much more than processing an index, hence the factor. */
+    size_t cost = points.get().vectors.size() * 16;
+
+    Emit(*result, to_geom::core::MeshTask(
+        [=]() {
+          return to_geom::calculator::AlphaShapeCalculator::Generate3DAlphaShapeMeshForPointCloud(
+              points, alphaValue, matrix, threads);
+        },
+        cost));
+
+    return result;
+  }
+}  // namespace to_geom::action
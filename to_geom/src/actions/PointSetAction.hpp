@@ -0,0 +1,47 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+
+#include "GeometryAction.hpp"
+#include "MeshTaskConversionContext.hpp"
+#include "ToGeomConfig.hpp"
+#include "Vec3fArray.hpp"
+
+#include "ToGeomExport.hpp"
+
+namespace to_geom::action {
+  /**
+   * @brief Represents an action for the PointSet VRML node.
+   *
+   * Converts a VRML `PointSet` node into a mesh reconstructed from its points (alpha shape).
+   * Inherits from `GeometryAction` to integrate with the conversion system.
+   */
+  class TOGEOM_API PointSetAction : public to_geom::action::GeometryAction {
+   public:
+    /**
+     * @brief Properties for `PointSetAction`. See VRML 2.0 specification for more information.
+     */
+    struct Properties {
+      std::optional<std::reference_wrapper<const vrml_proc::parser::model::Vec3fArray>> coord;
+      std::shared_ptr<to_geom::core::config::ToGeomConfig> config;
+    };
+
+    /**
+     * @brief Constructs a PointSetAction with specified properties.
+     * @param properties properties for PointSetAction
+     * @param geometryProperties geometry properties
+     */
+    PointSetAction(Properties properties, GeometryAction::Properties geometryProperties);
+
+    /**
+     * @brief Executes the conversion of the PointSet node to a mesh representation.
+     * @return A shared pointer to the generated mesh conversion context.
+     */
+    std::shared_ptr<to_geom::conversion_context::MeshTaskConversionContext> Execute() override;
+
+   private:
+    Properties m_properties;
+  };
+}  // namespace to_geom::action
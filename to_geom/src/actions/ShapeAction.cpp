@@ -10,7 +10,7 @@ namespace to_geom::action {
   ShapeAction::ShapeAction(Properties properties) : m_properties(properties) {}
 
   std::shared_ptr<to_geom::conversion_context::MeshTaskConversionContext> ShapeAction::Execute() {
-    vrml_proc::core::logger::LogDebug("Execute ShapeAction.", LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Execute ShapeAction.");
     return m_properties.geometry;
   }
 }  // namespace to_geom::action
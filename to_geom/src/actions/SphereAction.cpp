@@ -0,0 +1,52 @@
+#include "SphereAction.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include "SphereCalculator.hpp"
+#include "GeometryAction.hpp"
+#include "Logger.hpp"
+#include "MeshTask.hpp"
+#include "MeshTaskConversionContext.hpp"
+#include "ToGeomConfig.hpp"
+#include "TransformationMatrix.hpp"
+#include "VrmlUnits.hpp"
+
+namespace to_geom::action {
+
+  SphereAction::SphereAction(Properties properties, GeometryAction::Properties geometryProperties)
+      : to_geom::action::GeometryAction(geometryProperties), m_properties(properties) {}
+
+  std::shared_ptr<to_geom::conversion_context::MeshTaskConversionContext> SphereAction::Execute() {  //
+
+    using vrml_proc::parser::model::float32_t;
+
+    VRMLPROC_LOG_DEBUG("Execute SphereAction.");
+
+    auto result = std::make_shared<to_geom::conversion_context::MeshTaskConversionContext>();
+    if (!m_geometryProperties.containedByShape) {
+      VRMLPROC_LOG_DEBUG("Return empty data because Sphere node is not a child of a Shape node.");
+      return result;
+    }
+
+    float32_t radius = m_properties.radius.get();
+    unsigned int segments = to_geom::core::config::ToGeomConfig::TessellationSettings().segments;
+    if (m_properties.config != nullptr) {
+      segments = m_properties.config->tessellationSettings.segments;
+    }
+    vrml_proc::math::TransformationMatrix matrix = m_geometryProperties.matrix;
+
+    /** Sphere has about `segments` * `segments` triangles. */
+    size_t cost = static_cast<size_t>(segments) * segments;
+
+    Emit(*result, to_geom::core::MeshTask(
+        [=]() {
+          to_geom::calculator::SphereCalculator calculator = to_geom::calculator::SphereCalculator();
+          return calculator.Generate3DMesh(radius, segments, matrix);
+        },
+        cost));
+
+    return result;
+  }
+}  // namespace to_geom::action
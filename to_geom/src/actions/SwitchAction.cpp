@@ -10,7 +10,7 @@ namespace to_geom::action {
   SwitchAction::SwitchAction(SwitchProperties properties) : m_properties(properties) {}
 
   std::shared_ptr<to_geom::conversion_context::MeshTaskConversionContext> SwitchAction::Execute() {
-    vrml_proc::core::logger::LogDebug("Execute SwitchAction.", LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Execute SwitchAction.");
     return m_properties.choice;
   }
 }  // namespace to_geom::action
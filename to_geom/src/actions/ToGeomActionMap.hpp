@@ -1,101 +1,253 @@
 #pragma once
 
+#include <array>
 #include <functional>
 #include <memory>
+#include <string_view>
 
 #include "BoxAction.hpp"
+#include "ConeAction.hpp"
 #include "ConversionContextActionMap.hpp"
+#include "CylinderAction.hpp"
+#include "ElevationGridAction.hpp"
+#include "ExtrusionAction.hpp"
 #include "GroupAction.hpp"
+#include "Float32Array.hpp"
 #include "HandlerToActionBundle.hpp"
 #include "IndexedFaceSetAction.hpp"
 #include "IndexedLineSetAction.hpp"
 #include "MeshTaskConversionContext.hpp"
+#include "PointSetAction.hpp"
 #include "ShapeAction.hpp"
+#include "SphereAction.hpp"
 #include "SwitchAction.hpp"
 #include "ToGeomConfig.hpp"
 #include "TransformAction.hpp"
+#include "Vec2fArray.hpp"
 #include "Vec3f.hpp"
+#include "Vec3fArray.hpp"
 #include "VrmlNode.hpp"
 
+namespace to_geom::conversion_context::action_properties {
+  /**
+   * Functions in this namespace read properties of the individual actions from the argument passed from the handler.
+   * They are used to build the static action table, so that each action is created the same way no matter if it is
+   * dispatched statically or through the runtime map.
+   */
+
+  using Argument = vrml_proc::traversor::handler::HandlerToActionBundle<MeshTaskConversionContext>;
+
+  inline std::shared_ptr<to_geom::core::config::ToGeomConfig> GetConfig(const Argument& data) {  //
+
+    return std::static_pointer_cast<to_geom::core::config::ToGeomConfig>(data.config);
+  }
+
+  inline to_geom::action::GeometryAction::Properties Geometry(const Argument& data) {  //
+
+    return to_geom::action::GeometryAction::Properties{data.nodeView->IsNodeShapeDescendant(),
+        data.nodeView->GetTransformationMatrix(), GetConfig(data)->meshTaskSink};
+  }
+
+  inline to_geom::action::BoxAction::Properties Box(const Argument& data) {  //
+
+    using namespace vrml_proc::parser;
+
+    return {data.nodeView->GetField<std::reference_wrapper<const model::Vec3f>>("size")};
+  }
+
+  inline to_geom::action::SphereAction::Properties Sphere(const Argument& data) {  //
+
+    using namespace vrml_proc::parser;
+
+    auto radius = data.nodeView->GetField<std::reference_wrapper<const model::float32_t>>("radius");
+    return {radius, GetConfig(data)};
+  }
+
+  inline to_geom::action::CylinderAction::Properties Cylinder(const Argument& data) {  //
+
+    using namespace vrml_proc::parser;
+
+    auto radius = data.nodeView->GetField<std::reference_wrapper<const model::float32_t>>("radius");
+    auto height = data.nodeView->GetField<std::reference_wrapper<const model::float32_t>>("height");
+    auto side = data.nodeView->GetField<std::reference_wrapper<const bool>>("side");
+    auto top = data.nodeView->GetField<std::reference_wrapper<const bool>>("top");
+    auto bottom = data.nodeView->GetField<std::reference_wrapper<const bool>>("bottom");
+    return {radius, height, side, top, bottom, GetConfig(data)};
+  }
+
+  inline to_geom::action::ConeAction::Properties Cone(const Argument& data) {  //
+
+    using namespace vrml_proc::parser;
+
+    auto bottomRadius = data.nodeView->GetField<std::reference_wrapper<const model::float32_t>>("bottomRadius");
+    auto height = data.nodeView->GetField<std::reference_wrapper<const model::float32_t>>("height");
+    auto side = data.nodeView->GetField<std::reference_wrapper<const bool>>("side");
+    auto bottom = data.nodeView->GetField<std::reference_wrapper<const bool>>("bottom");
+    return {bottomRadius, height, side, bottom, GetConfig(data)};
+  }
+
+  inline to_geom::action::GroupAction::Properties Group(const Argument& data) {  //
+
+    return {data.ccGroup};
+  }
+
+  inline to_geom::action::TransformAction::Properties Transform(const Argument& data) {  //
+
+    return {data.ccGroup};
+  }
+
+  inline to_geom::action::SwitchAction::SwitchProperties Switch(const Argument& data) {  //
+
+    return {data.cc1};
+  }
+
+  inline to_geom::action::ShapeAction::Properties Shape(const Argument& data) {  //
+
+    return {data.cc1, data.cc2};
+  }
+
+  inline to_geom::action::IndexedFaceSetAction::Properties IndexedFaceSet(const Argument& data) {  //
+
+    using namespace vrml_proc::parser;
+
+    auto coord = data.nodeView->GetCoordData();
+    auto coordIndex = data.nodeView->GetField<std::reference_wrapper<const model::Int32Array>>("coordIndex");
+    auto convex = data.nodeView->GetField<std::reference_wrapper<const bool>>("convex");
+    return {coord, convex, coordIndex, GetConfig(data)};
+  }
+
+  inline to_geom::action::IndexedLineSetAction::Properties IndexedLineSet(const Argument& data) {  //
+
+    using namespace vrml_proc::parser;
+
+    auto coord = data.nodeView->GetCoordData();
+    auto coordIndex = data.nodeView->GetField<std::reference_wrapper<const model::Int32Array>>("coordIndex");
+    return {coord, coordIndex};
+  }
+
+  inline to_geom::action::ElevationGridAction::Properties ElevationGrid(const Argument& data) {  //
+
+    using namespace vrml_proc::parser;
+
+    auto height = data.nodeView->GetField<std::reference_wrapper<const model::Float32Array>>("height");
+    auto xDimension = data.nodeView->GetField<std::reference_wrapper<const int32_t>>("xDimension");
+    auto zDimension = data.nodeView->GetField<std::reference_wrapper<const int32_t>>("zDimension");
+    auto xSpacing = data.nodeView->GetField<std::reference_wrapper<const model::float32_t>>("xSpacing");
+    auto zSpacing = data.nodeView->GetField<std::reference_wrapper<const model::float32_t>>("zSpacing");
+    auto ccw = data.nodeView->GetField<std::reference_wrapper<const bool>>("ccw");
+    return {height, xDimension, zDimension, xSpacing, zSpacing, ccw, GetConfig(data)};
+  }
+
+  inline to_geom::action::PointSetAction::Properties PointSet(const Argument& data) {  //
+
+    using namespace vrml_proc::parser;
+
+    auto coord = data.nodeView->GetCoordData();
+    return {coord, GetConfig(data)};
+  }
+
+  inline to_geom::action::ExtrusionAction::Properties Extrusion(const Argument& data) {  //
+
+    using namespace vrml_proc::parser;
+
+    auto crossSection = data.nodeView->GetField<std::reference_wrapper<const model::Vec2fArray>>("crossSection");
+    auto spine = data.nodeView->GetField<std::reference_wrapper<const model::Vec3fArray>>("spine");
+    auto scale = data.nodeView->GetField<std::reference_wrapper<const model::Float32Array>>("scale");
+    auto orientation = data.nodeView->GetField<std::reference_wrapper<const model::Float32Array>>("orientation");
+    auto beginCap = data.nodeView->GetField<std::reference_wrapper<const bool>>("beginCap");
+    auto endCap = data.nodeView->GetField<std::reference_wrapper<const bool>>("endCap");
+    auto ccw = data.nodeView->GetField<std::reference_wrapper<const bool>>("ccw");
+    return {crossSection, spine, scale, orientation, beginCap, endCap, ccw, GetConfig(data)};
+  }
+}  // namespace to_geom::conversion_context::action_properties
+
 namespace to_geom::conversion_context {
+  /**
+   * @brief Static table of all actions provided by togeom. Each entry creates its action from the properties read by
+   * the functions in `action_properties` namespace.
+   */
+  inline constexpr auto StaticActions = [] {
+    using namespace to_geom::action;
+    namespace p = action_properties;
+    using ActionMap = vrml_proc::action::ConversionContextActionMap<MeshTaskConversionContext>;
+
+    return std::array{
+        ActionMap::MakeStaticAction<BoxAction, p::Box, p::Geometry>("Box"),
+        ActionMap::MakeStaticAction<SphereAction, p::Sphere, p::Geometry>("Sphere"),
+        ActionMap::MakeStaticAction<CylinderAction, p::Cylinder, p::Geometry>("Cylinder"),
+        ActionMap::MakeStaticAction<ConeAction, p::Cone, p::Geometry>("Cone"),
+        ActionMap::MakeStaticAction<GroupAction, p::Group>("Group"),
+        ActionMap::MakeStaticAction<TransformAction, p::Transform>("Transform"),
+        ActionMap::MakeStaticAction<SwitchAction, p::Switch>("Switch"),
+        ActionMap::MakeStaticAction<ShapeAction, p::Shape>("Shape"),
+        ActionMap::MakeStaticAction<IndexedFaceSetAction, p::IndexedFaceSet, p::Geometry>("IndexedFaceSet"),
+        ActionMap::MakeStaticAction<IndexedLineSetAction, p::IndexedLineSet, p::Geometry>("IndexedLineSet"),
+        ActionMap::MakeStaticAction<ElevationGridAction, p::ElevationGrid, p::Geometry>("ElevationGrid"),
+        ActionMap::MakeStaticAction<PointSetAction, p::PointSet, p::Geometry>("PointSet"),
+        ActionMap::MakeStaticAction<ExtrusionAction, p::Extrusion, p::Geometry>("Extrusion"),
+    };
+  }();
+
+  /**
+   * @brief Fields read by the actions in `StaticActions`, written as `Header.field`. Fields of geometry primitive nodes
+   * (e.g. `Coordinate.point`) are listed under their own header. Fields of grouping nodes read by the traversor itself
+   * are not numeric arrays, so they are never skipped and need not be listed.
+   */
+  inline constexpr auto RequestedFields = std::to_array<std::string_view>({
+      "Box.size",
+      "Sphere.radius",
+      "Cylinder.radius",
+      "Cylinder.height",
+      "Cylinder.side",
+      "Cylinder.top",
+      "Cylinder.bottom",
+      "Cone.bottomRadius",
+      "Cone.height",
+      "Cone.side",
+      "Cone.bottom",
+      "IndexedFaceSet.coord",
+      "IndexedFaceSet.coordIndex",
+      "IndexedFaceSet.convex",
+      "IndexedLineSet.coord",
+      "IndexedLineSet.coordIndex",
+      "ElevationGrid.height",
+      "ElevationGrid.xDimension",
+      "ElevationGrid.zDimension",
+      "ElevationGrid.xSpacing",
+      "ElevationGrid.zSpacing",
+      "ElevationGrid.ccw",
+      "PointSet.coord",
+      "Extrusion.crossSection",
+      "Extrusion.spine",
+      "Extrusion.scale",
+      "Extrusion.orientation",
+      "Extrusion.beginCap",
+      "Extrusion.endCap",
+      "Extrusion.ccw",
+      "Coordinate.point",
+  });
+
   /**
    * @brief Retrieves action map. Action map maps VRML node name to an corresponding actions. Or rather, it maps it to a
-   * lambda which will create given action class. This given returns a map which is basically a cookbook to create an
+   * function which will create given action class. This given returns a map which is basically a cookbook to create an
    * individual action instance.
    *
+   * All togeom actions are stored as static actions (see `StaticActions`), so they are dispatched without
+   * `std::function` and without allocating the action on the heap. Actions added to the map by `AddAction()` still
+   * override them. Fields read by the actions are set as requested fields (see `RequestedFields`).
+   *
    * @returns action map with MeshTaskConversionContext as conversion context
    */
-  inline vrml_proc::action::ConversionContextActionMap<to_geom::conversion_context::MeshTaskConversionContext>&
-  GetActionMap() {  //
+  inline vrml_proc::action::ConversionContextActionMap<MeshTaskConversionContext>& GetActionMap() {  //
 
-    using to_geom::conversion_context::MeshTaskConversionContext;
     using vrml_proc::action::ConversionContextActionMap;
-    using vrml_proc::math::TransformationMatrix;
-    using namespace vrml_proc::parser;
-    using namespace to_geom::action;
-    using namespace vrml_proc::core::logger;
-
-    static ConversionContextActionMap<MeshTaskConversionContext> actionMap;
-    static bool initialized = false;
-
-    if (initialized) {
-      return actionMap;
-    }
-
-    if (!initialized) {
-      initialized = true;
-    }
-
-    actionMap.AddAction(
-        "Box", [](vrml_proc::traversor::handler::HandlerToActionBundle<MeshTaskConversionContext> data) {
-          return std::make_shared<BoxAction>(
-              BoxAction::Properties{data.nodeView->GetField<std::reference_wrapper<const model::Vec3f>>("size")},
-              GeometryAction::Properties{
-                  data.nodeView->IsNodeShapeDescendant(), data.nodeView->GetTransformationMatrix()});
-        });
-
-    actionMap.AddAction(
-        "Group", [](vrml_proc::traversor::handler::HandlerToActionBundle<MeshTaskConversionContext> data) {
-          return std::make_shared<GroupAction>(GroupAction::Properties{data.ccGroup});
-        });
-
-    actionMap.AddAction(
-        "Transform", [](vrml_proc::traversor::handler::HandlerToActionBundle<MeshTaskConversionContext> data) {
-          return std::make_shared<TransformAction>(TransformAction::Properties{data.ccGroup});
-        });
-
-    actionMap.AddAction(
-        "Switch", [](vrml_proc::traversor::handler::HandlerToActionBundle<MeshTaskConversionContext> data) {
-          return std::make_shared<SwitchAction>(SwitchAction::SwitchProperties{data.cc1});
-        });
-
-    actionMap.AddAction(
-        "Shape", [](vrml_proc::traversor::handler::HandlerToActionBundle<MeshTaskConversionContext> data) {
-          return std::make_shared<ShapeAction>(ShapeAction::Properties{data.cc1, data.cc2});
-        });
-
-    actionMap.AddAction(
-        "IndexedFaceSet", [](vrml_proc::traversor::handler::HandlerToActionBundle<MeshTaskConversionContext> data) {
-          auto coord = data.nodeView->GetField<std::reference_wrapper<const model::VrmlNode>>("coord");
-          auto coordIndex = data.nodeView->GetField<std::reference_wrapper<const model::Int32Array>>("coordIndex");
-          auto convex = data.nodeView->GetField<std::reference_wrapper<const bool>>("convex");
-          auto geomConfig = std::static_pointer_cast<to_geom::core::config::ToGeomConfig>(data.config);
-
-          IndexedFaceSetAction::Properties properties{coord, convex, coordIndex, geomConfig};
-
-          return std::make_shared<IndexedFaceSetAction>(
-              properties, GeometryAction::Properties{
-                              data.nodeView->IsNodeShapeDescendant(), data.nodeView->GetTransformationMatrix()});
-        });
-
-    actionMap.AddAction(
-        "IndexedLineSet", [](vrml_proc::traversor::handler::HandlerToActionBundle<MeshTaskConversionContext> data) {
-          auto coord = data.nodeView->GetField<std::reference_wrapper<const model::VrmlNode>>("coord");
-          auto coordIndex = data.nodeView->GetField<std::reference_wrapper<const model::Int32Array>>("coordIndex");
-          return std::make_shared<IndexedLineSetAction>(IndexedLineSetAction::Properties{coord, coordIndex},
-              GeometryAction::Properties{
-                  data.nodeView->IsNodeShapeDescendant(), data.nodeView->GetTransformationMatrix()});
-        });
+
+    static ConversionContextActionMap<MeshTaskConversionContext> actionMap = [] {
+      ConversionContextActionMap<MeshTaskConversionContext> map;
+      map.SetStaticActions(StaticActions);
+      map.SetRequestedFields(RequestedFields);
+      return map;
+    }();
 
     return actionMap;
   }
@@ -10,7 +10,7 @@ namespace to_geom::action {
   TransformAction::TransformAction(Properties properties) : m_properties(properties) {}
 
   std::shared_ptr<to_geom::conversion_context::MeshTaskConversionContext> TransformAction::Execute() {
-    vrml_proc::core::logger::LogDebug("Execute TransformAction.", LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Execute TransformAction.");
 
     auto result = std::make_shared<to_geom::conversion_context::MeshTaskConversionContext>();
     for (auto child : m_properties.children) {
@@ -0,0 +1,133 @@
+#include "AlphaShapeCalculator.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <CGAL/Alpha_shape_3.h>
+#include <CGAL/Alpha_shape_cell_base_3.h>
+#include <CGAL/Alpha_shape_vertex_base_3.h>
+#include <CGAL/bounding_box.h>
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Triangulation_data_structure_3.h>
+
+#include <result.hpp>
+
+#include "CalculatorError.hpp"
+#include "CGALBaseTypesForVrml.hpp"
+#include "Error.hpp"
+#include "Logger.hpp"
+#include "ManualTimer.hpp"
+#include "Mesh.hpp"
+#include "ModelValidationError.hpp"
+
+#ifdef CGAL_LINKED_WITH_TBB
+using ConcurrencyTag = CGAL::Parallel_tag;
+#else
+using ConcurrencyTag = CGAL::Sequential_tag;
+#endif
+
+using K = vrml_proc::math::cgal::CGALKernel;
+using Vb = CGAL::Alpha_shape_vertex_base_3<K>;
+using Cb = CGAL::Alpha_shape_cell_base_3<K>;
+using Tds = CGAL::Triangulation_data_structure_3<Vb, Cb, ConcurrencyTag>;
+using Delaunay = CGAL::Delaunay_triangulation_3<K, Tds>;
+using AlphaShape = CGAL::Alpha_shape_3<Delaunay>;
+
+/**
+ * @brief Builds Delaunay triangulation of the points. The range insertion sorts points spatially before inserting
+ * them; with TBB and more than one thread, the insertion is also done in parallel under a spatial lock grid.
+ */
+static Delaunay BuildDelaunayTriangulation(
+    const std::vector<vrml_proc::math::cgal::CGALPoint>& points, unsigned int threads) {
+#ifdef CGAL_LINKED_WITH_TBB
+  if (threads > 1) {
+    Delaunay::Lock_data_structure lockingStructure(CGAL::bbox_3(points.begin(), points.end()), 50);
+    Delaunay triangulation(points.begin(), points.end(), &lockingStructure);
+    triangulation.set_lock_data_structure(nullptr);
+    return triangulation;
+  }
+#endif
+  (void)threads;
+  return Delaunay(points.begin(), points.end());
+}
+
+namespace to_geom::calculator::AlphaShapeCalculator {
+  to_geom::calculator::CalculatorResult Generate3DAlphaShapeMeshForPointCloud(
+      std::reference_wrapper<const vrml_proc::parser::model::Vec3fArray> pointCloud,
+      double alphaValue,
+      const vrml_proc::math::TransformationMatrix& matrix,
+      unsigned int threads) {  //
+
+    using vrml_proc::parser::model::validator::error::EmptyArrayError;
+    using to_geom::calculator::error::AlphaShapeCalculatorError;
+    using to_geom::calculator::error::PropertiesError;
+    using namespace vrml_proc::core::logger;
+    using namespace vrml_proc::math::cgal;
+    using VertexIndex = to_geom::core::Mesh::Vertex_index;
+
+    VRMLPROC_LOG_DEBUG("Generate 3D alpha shape mesh from point cloud using AlphaShapeCalculator.");
+
+    auto mesh = std::make_shared<core::Mesh>();
+
+    if (pointCloud.get().vectors.empty()) {
+      return cpp::fail(std::make_shared<AlphaShapeCalculatorError>()
+                       << (std::make_shared<PropertiesError>() << std::make_shared<EmptyArrayError>("pointCloud")));
+    }
+
+    std::vector<CGALPoint> points = Vec3fArrayToCGALPoints(pointCloud.get());
+
+    auto timer = vrml_proc::core::utils::ManualTimer();
+    timer.Start();
+
+    Delaunay triangulation = BuildDelaunayTriangulation(points, threads);
+    if (triangulation.dimension() < 3) {
+      VRMLPROC_LOG_DEBUG("Points of the point cloud are coplanar, empty mesh is returned.");
+      return mesh;
+    }
+
+    AlphaShape alphaShape(triangulation, alphaValue > 0.0 ? alphaValue : 0.0, AlphaShape::GENERAL);
+    if (alphaValue <= 0.0) {
+      auto optimalAlpha = alphaShape.find_optimal_alpha(1);
+      if (optimalAlpha != alphaShape.alpha_end()) {
+        VRMLPROC_LOG_DEBUG("Use optimal alpha value ", *optimalAlpha, ".");
+        alphaShape.set_alpha(*optimalAlpha);
+      }
+    }
+
+    /**
+     * Every vertex of the triangulation is added into the mesh (and transformed) only once, when it is used by the
+     * first boundary facet.
+     */
+    std::unordered_map<AlphaShape::Vertex_handle, VertexIndex> vertices;
+    auto getVertex = [&](AlphaShape::Vertex_handle handle) {
+      auto [it, inserted] = vertices.try_emplace(handle);
+      if (inserted) {
+        it->second = mesh->add_vertex(matrix.transform(handle->point()));
+      }
+      return it->second;
+    };
+
+    for (auto it = alphaShape.alpha_shape_facets_begin(); it != alphaShape.alpha_shape_facets_end(); ++it) {
+      AlphaShape::Facet facet = *it;
+      if (alphaShape.classify(facet) != AlphaShape::REGULAR) {
+        continue;
+      }
+
+      /** Vertices of the facet are ordered so that its normal points into the cell, which is the exterior one. */
+      if (alphaShape.classify(facet.first) != AlphaShape::EXTERIOR) {
+        facet = alphaShape.mirror_facet(facet);
+      }
+      const auto& cell = facet.first;
+      const int i = facet.second;
+      mesh->add_face(getVertex(cell->vertex(AlphaShape::vertex_triangle_index(i, 0))),
+          getVertex(cell->vertex(AlphaShape::vertex_triangle_index(i, 1))),
+          getVertex(cell->vertex(AlphaShape::vertex_triangle_index(i, 2))));
+    }
+
+    double time = timer.End();
+    VRMLPROC_LOG_DEBUG("Mesh was generated successfully. The generation took ", time, " seconds.");
+
+    return mesh;
+  }
+}  // namespace to_geom::calculator::AlphaShapeCalculator
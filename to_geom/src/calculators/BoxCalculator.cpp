@@ -28,7 +28,7 @@ namespace to_geom::calculator {
     using namespace vrml_proc::parser::model::validator;
     using vrml_proc::math::cgal::CGALPoint;
 
-    LogDebug("Generate 3D mesh using BoxCalculator.", LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Generate 3D mesh using BoxCalculator.");
 
     auto checkResult = CheckVec3fIsGreaterThanZero(size.get());
     if (checkResult.has_error()) {
@@ -93,7 +93,7 @@ namespace to_geom::calculator {
     mesh->add_face(v[0], v[7], v[3]);
 
     double time = timer.End();
-    LogDebug(FormatString("Mesh was generated successfully. The generation took ", time, " seconds."), LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Mesh was generated successfully. The generation took ", time, " seconds.");
 
     return mesh;
   }
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CalculatorResult.hpp"
+#include "TransformationMatrix.hpp"
+#include "VrmlUnits.hpp"
+
+#include "ToGeomExport.hpp"
+
+namespace to_geom::calculator {
+  /**
+   * @brief Represents a calculator for Cone VRML node.
+   *
+   * Mesh is an instance of the unit cone cached in `PrimitiveMeshCache`.
+   */
+  class TOGEOM_API ConeCalculator {
+   public:
+    /**
+     * @brief Generates 3D mesh for Cone geometry primitive.
+     *
+     * @param bottomRadius radius of the cone base
+     * @param height height of the cone
+     * @param side flag indicating if the side is generated
+     * @param bottom flag indicating if the base is generated
+     * @param segments number of segments around the Y axis
+     * @param matrix tranformation matrix applied to geometry
+     * @returns calculator result (mesh object or error if generation failed)
+     */
+    to_geom::calculator::CalculatorResult Generate3DMesh(vrml_proc::parser::model::float32_t bottomRadius,
+        vrml_proc::parser::model::float32_t height,
+        bool side,
+        bool bottom,
+        unsigned int segments,
+        const vrml_proc::math::TransformationMatrix& matrix);
+  };
+}  // namespace to_geom::calculator
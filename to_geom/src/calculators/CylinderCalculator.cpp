@@ -0,0 +1,51 @@
+#include "CylinderCalculator.hpp"
+
+#include <memory>
+
+#include <result.hpp>
+
+#include "CalculatorError.hpp"
+#include "CalculatorResult.hpp"
+#include "Error.hpp"
+#include "Logger.hpp"
+#include "ManualTimer.hpp"
+#include "Mesh.hpp"
+#include "ModelValidator.hpp"
+#include "PrimitiveMeshCache.hpp"
+#include "Vec3f.hpp"
+
+namespace to_geom::calculator {
+  to_geom::calculator::CalculatorResult CylinderCalculator::Generate3DMesh(
+      vrml_proc::parser::model::float32_t radius,
+      vrml_proc::parser::model::float32_t height,
+      bool side,
+      bool top,
+      bool bottom,
+      unsigned int segments,
+      const vrml_proc::math::TransformationMatrix& matrix) {  //
+
+    using namespace vrml_proc::core::logger;
+    using namespace vrml_proc::core::utils;
+    using namespace vrml_proc::parser::model::validator;
+
+    VRMLPROC_LOG_DEBUG("Generate 3D mesh using CylinderCalculator.");
+
+    vrml_proc::parser::model::Vec3f scale = {radius, height, radius};
+    auto checkResult = CheckVec3fIsGreaterThanZero(scale);
+    if (checkResult.has_error()) {
+      return cpp::fail(std::make_shared<error::CylinderCalculatorError>()
+                       << (std::make_shared<error::PropertiesError>() << checkResult.error()));
+    }
+
+    auto timer = ManualTimer();
+    timer.Start();
+
+    auto mesh = PrimitiveMeshCache::CreateInstance(
+        PrimitiveMeshCache::Key{PrimitiveMeshCache::Primitive::Cylinder, segments, side, top, bottom}, scale, matrix);
+
+    double time = timer.End();
+    VRMLPROC_LOG_DEBUG("Mesh was generated successfully. The generation took ", time, " seconds.");
+
+    return mesh;
+  }
+}  // namespace to_geom::calculator
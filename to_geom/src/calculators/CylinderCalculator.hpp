@@ -0,0 +1,37 @@
+#pragma once
+
+#include "CalculatorResult.hpp"
+#include "TransformationMatrix.hpp"
+#include "VrmlUnits.hpp"
+
+#include "ToGeomExport.hpp"
+
+namespace to_geom::calculator {
+  /**
+   * @brief Represents a calculator for Cylinder VRML node.
+   *
+   * Mesh is an instance of the unit cylinder cached in `PrimitiveMeshCache`.
+   */
+  class TOGEOM_API CylinderCalculator {
+   public:
+    /**
+     * @brief Generates 3D mesh for Cylinder geometry primitive.
+     *
+     * @param radius radius of the cylinder
+     * @param height height of the cylinder
+     * @param side flag indicating if the side is generated
+     * @param top flag indicating if the top cap is generated
+     * @param bottom flag indicating if the bottom cap is generated
+     * @param segments number of segments around the Y axis
+     * @param matrix tranformation matrix applied to geometry
+     * @returns calculator result (mesh object or error if generation failed)
+     */
+    to_geom::calculator::CalculatorResult Generate3DMesh(vrml_proc::parser::model::float32_t radius,
+        vrml_proc::parser::model::float32_t height,
+        bool side,
+        bool top,
+        bool bottom,
+        unsigned int segments,
+        const vrml_proc::math::TransformationMatrix& matrix);
+  };
+}  // namespace to_geom::calculator
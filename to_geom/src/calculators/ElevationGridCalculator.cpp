@@ -0,0 +1,144 @@
+#include "ElevationGridCalculator.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <CGAL/Kernel/interface_macros.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh/Surface_mesh.h>
+
+#include <result.hpp>
+#include <taskflow/taskflow.hpp>
+
+#include "CalculatorError.hpp"
+#include "CalculatorResult.hpp"
+#include "CGALBaseTypesForVrml.hpp"
+#include "Error.hpp"
+#include "Logger.hpp"
+#include "ManualTimer.hpp"
+#include "Mesh.hpp"
+#include "ModelValidationError.hpp"
+#include "Range.hpp"
+#include "TaskflowUtils.hpp"
+
+namespace to_geom::calculator {
+  to_geom::calculator::CalculatorResult ElevationGridCalculator::Generate3DMesh(
+      std::reference_wrapper<const vrml_proc::parser::model::Float32Array> height,
+      int32_t xDimension,
+      int32_t zDimension,
+      vrml_proc::parser::model::float32_t xSpacing,
+      vrml_proc::parser::model::float32_t zSpacing,
+      bool ccw,
+      const vrml_proc::math::TransformationMatrix& matrix,
+      tf::Executor* executor) {  //
+
+    using to_geom::calculator::error::ElevationGridCalculatorError;
+    using to_geom::calculator::error::InvalidNumberOfHeightsError;
+    using to_geom::calculator::error::PropertiesError;
+    using vrml_proc::core::utils::ManualTimer;
+    using vrml_proc::core::utils::Range;
+    using vrml_proc::parser::model::validator::error::NumberOutOfRangeError;
+    using namespace vrml_proc::core::logger;
+    using vrml_proc::math::cgal::CGALPoint;
+    using vrml_proc::parser::model::float32_t;
+    using VertexIndex = to_geom::core::Mesh::Vertex_index;
+
+    VRMLPROC_LOG_DEBUG("Generate 3D mesh using ElevationGridCalculator.");
+
+    auto mesh = std::make_shared<to_geom::core::Mesh>();
+
+    if (xDimension < 2 || zDimension < 2) {
+      VRMLPROC_LOG_DEBUG("ElevationGrid has no cells, empty mesh is returned.");
+      return mesh;
+    }
+
+    Range<float32_t> spacingRange(0.0f, std::numeric_limits<float32_t>::infinity());
+    for (float32_t spacing : {xSpacing, zSpacing}) {
+      if (!spacingRange.CheckValueInRangeInclusive(spacing)) {
+        return cpp::fail(std::make_shared<ElevationGridCalculatorError>()
+                         << (std::make_shared<PropertiesError>()
+                             << std::make_shared<NumberOutOfRangeError<float32_t>>(spacingRange, spacing)));
+      }
+    }
+
+    const size_t columns = static_cast<size_t>(xDimension);
+    const size_t rows = static_cast<size_t>(zDimension);
+    const size_t verticesCount = columns * rows;
+    const std::vector<float32_t>& heights = height.get().values;
+    if (heights.size() < verticesCount) {
+      return cpp::fail(std::make_shared<ElevationGridCalculatorError>()
+                       << (std::make_shared<PropertiesError>()
+                           << std::make_shared<InvalidNumberOfHeightsError>(verticesCount, heights.size())));
+    }
+
+    auto timer = ManualTimer();
+    timer.Start();
+
+    /**
+     * Vertices are transformed into preallocated buffer. Every row writes only its own slice of the buffer, so rows
+     * can be split into bands and computed in parallel for large grids.
+     */
+    std::vector<CGALPoint> points(verticesCount);
+    auto computeRows = [&](size_t firstRow, size_t lastRow) {
+      for (size_t j = firstRow; j < lastRow; ++j) {
+        const double z = static_cast<double>(j) * zSpacing;
+        const size_t offset = j * columns;
+        for (size_t i = 0; i < columns; ++i) {
+          points[offset + i] = matrix.transform(CGALPoint(static_cast<double>(i) * xSpacing, heights[offset + i], z));
+        }
+      }
+    };
+
+    if (executor != nullptr && executor->num_workers() > 1 && verticesCount >= ParallelVerticesThreshold) {
+      const size_t bands = std::min<size_t>(rows, executor->num_workers() * 4);
+      const size_t rowsPerBand = (rows + bands - 1) / bands;
+
+      tf::Taskflow taskflow;
+      for (size_t firstRow = 0; firstRow < rows; firstRow += rowsPerBand) {
+        size_t lastRow = std::min(rows, firstRow + rowsPerBand);
+        taskflow.emplace([&computeRows, firstRow, lastRow]() { computeRows(firstRow, lastRow); });
+      }
+      vrml_proc::core::parallelism::RunAndWait(*executor, taskflow);
+    } else {
+      computeRows(0, rows);
+    }
+
+    /**
+     * Grid of n vertices with c cells has c * 2 triangles and (columns - 1) * rows + columns * (rows - 1) + c edges
+     * (the last term are diagonals).
+     */
+    const size_t cellsCount = (columns - 1) * (rows - 1);
+    const size_t edgesCount = (columns - 1) * rows + columns * (rows - 1) + cellsCount;
+    mesh->reserve(verticesCount, edgesCount, cellsCount * 2);
+
+    /** Vertices are inserted in the buffer order, so vertex (i, j) has index i + j * columns. */
+    for (const auto& point : points) {
+      mesh->add_vertex(point);
+    }
+
+    for (size_t j = 0; j + 1 < rows; ++j) {
+      for (size_t i = 0; i + 1 < columns; ++i) {
+        VertexIndex a(static_cast<VertexIndex::size_type>(i + j * columns));
+        VertexIndex b(static_cast<VertexIndex::size_type>(i + 1 + j * columns));
+        VertexIndex c(static_cast<VertexIndex::size_type>(i + 1 + (j + 1) * columns));
+        VertexIndex d(static_cast<VertexIndex::size_type>(i + (j + 1) * columns));
+
+        /** Triangles (a, d, c) and (a, c, b) face positive Y. */
+        if (ccw) {
+          mesh->add_face(a, d, c);
+          mesh->add_face(a, c, b);
+        } else {
+          mesh->add_face(a, c, d);
+          mesh->add_face(a, b, c);
+        }
+      }
+    }
+
+    double time = timer.End();
+    VRMLPROC_LOG_DEBUG("Mesh was generated successfully. The generation took ", time, " seconds.");
+
+    return mesh;
+  }
+}  // namespace to_geom::calculator
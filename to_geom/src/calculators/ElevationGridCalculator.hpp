@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include <taskflow/taskflow.hpp>
+
+#include "CalculatorResult.hpp"
+#include "Float32Array.hpp"
+#include "TransformationMatrix.hpp"
+#include "VrmlUnits.hpp"
+
+#include "ToGeomExport.hpp"
+
+namespace to_geom::calculator {
+  /**
+   * @brief Represents a calculator for ElevationGrid VRML node.
+   *
+   * The grid is regular, so vertex (i, j) is always stored at index `i + j * xDimension` and every cell is split into
+   * two triangles. No lookup of already inserted vertices is therefore needed, vertices are written into preallocated
+   * buffer and faces refer to them directly by their index.
+   */
+  class TOGEOM_API ElevationGridCalculator {
+   public:
+    /**
+     * @brief Grids with at least this number of vertices have their vertices computed in parallel, split into bands of
+     * rows.
+     */
+    static constexpr size_t ParallelVerticesThreshold = 1 << 20;
+
+    /**
+     * @brief Generates 3D mesh for ElevationGrid geometry primitive.
+     *
+     * @param height heights of the grid vertices stored row by row (`xDimension` values per row)
+     * @param xDimension number of vertices in X direction
+     * @param zDimension number of vertices in Z direction
+     * @param xSpacing distance between two neighbouring vertices in X direction
+     * @param zSpacing distance between two neighbouring vertices in Z direction
+     * @param ccw flag indicating if faces are counterclockwise when viewed from above (from positive Y)
+     * @param matrix tranformation matrix applied to geometry
+     * @param executor executor computing vertices of large grids, typically the one running the calling task; nullptr
+     * means that the mesh is generated on the calling thread only
+     * @returns calculator result (mesh object or error if generation failed)
+     * @note If any of the dimensions is less than 2, the grid has no cells and empty mesh is returned.
+     */
+    to_geom::calculator::CalculatorResult Generate3DMesh(
+        std::reference_wrapper<const vrml_proc::parser::model::Float32Array> height,
+        int32_t xDimension,
+        int32_t zDimension,
+        vrml_proc::parser::model::float32_t xSpacing,
+        vrml_proc::parser::model::float32_t zSpacing,
+        bool ccw,
+        const vrml_proc::math::TransformationMatrix& matrix,
+        tf::Executor* executor = nullptr);
+  };
+}  // namespace to_geom::calculator
@@ -0,0 +1,309 @@
+#include "ExtrusionCalculator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <CGAL/Kernel/interface_macros.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh/Surface_mesh.h>
+
+#include <result.hpp>
+#include <taskflow/taskflow.hpp>
+
+#include "CalculatorError.hpp"
+#include "CalculatorResult.hpp"
+#include "CGALBaseTypesForVrml.hpp"
+#include "Error.hpp"
+#include "Logger.hpp"
+#include "ManualTimer.hpp"
+#include "Mesh.hpp"
+#include "ModelValidationError.hpp"
+#include "Range.hpp"
+#include "TaskflowUtils.hpp"
+#include "Vec2f.hpp"
+#include "Vec3f.hpp"
+
+using vrml_proc::math::cgal::CGALVector3;
+
+/**
+ * @brief Represents axes of the spine-aligned cross-section plane (SCP) of one spine point.
+ */
+struct SpineFrame {
+  CGALVector3 x;
+  CGALVector3 y;
+  CGALVector3 z;
+};
+
+/**
+ * @brief Returns unit vector of the same direction, or zero vector if the vector is (almost) zero.
+ */
+static CGALVector3 Normalized(const CGALVector3& vector) {
+  double length = std::sqrt(vector.squared_length());
+  if (length < 1e-12) {
+    return CGAL::NULL_VECTOR;
+  }
+  return vector / length;
+}
+
+static bool IsZero(const CGALVector3& vector) { return vector == CGAL::NULL_VECTOR; }
+
+/**
+ * @brief Rotates vector around the axis using Rodrigues' rotation formula.
+ */
+static CGALVector3 Rotate(const CGALVector3& vector, const CGALVector3& axis, double angle) {
+  CGALVector3 k = Normalized(axis);
+  if (IsZero(k)) {
+    return vector;
+  }
+  double cosAngle = std::cos(angle);
+  double sinAngle = std::sin(angle);
+  return vector * cosAngle + CGAL::cross_product(k, vector) * sinAngle + k * ((k * vector) * (1.0 - cosAngle));
+}
+
+static bool AreEqual(const vrml_proc::parser::model::Vec3f& first, const vrml_proc::parser::model::Vec3f& second) {
+  return first.x == second.x && first.y == second.y && first.z == second.z;
+}
+
+static bool AreEqual(const vrml_proc::parser::model::Vec2f& first, const vrml_proc::parser::model::Vec2f& second) {
+  return first.u == second.u && first.v == second.v;
+}
+
+/**
+ * @brief Computes SCP of all spine points in one pass, following VRML 2.0 specification: Y axis is tangent of the
+ * spine, Z axis is normal of the plane of two neighbouring spine segments, X = Y x Z. Undefined axes (coincident or
+ * collinear spine points) are taken from the neighbours; if the whole spine is collinear, Z axis is the image of
+ * (0, 0, 1) under the rotation taking (0, 1, 0) to the spine direction.
+ *
+ * @param spine spine points (at least 2)
+ * @param closed true if the first and the last spine point are identical
+ * @returns frames, one per spine point
+ */
+static std::vector<SpineFrame> ComputeSpineFrames(
+    const std::vector<vrml_proc::parser::model::Vec3f>& spine, bool closed) {  //
+
+  using vrml_proc::math::cgal::Vec3fToCGALVector3;
+
+  const size_t n = spine.size();
+  auto point = [&](size_t i) { return Vec3fToCGALVector3(spine[i]); };
+
+  std::vector<SpineFrame> frames(n);
+  for (size_t i = 0; i < n; ++i) {
+    CGALVector3 y;
+    CGALVector3 z = CGAL::NULL_VECTOR;
+    if (i == 0 || i == n - 1) {
+      if (closed) {
+        y = point(1) - point(n - 2);
+        z = CGAL::cross_product(point(1) - point(0), point(n - 2) - point(0));
+      } else {
+        y = (i == 0) ? point(1) - point(0) : point(n - 1) - point(n - 2);
+      }
+    } else {
+      y = point(i + 1) - point(i - 1);
+      z = CGAL::cross_product(point(i + 1) - point(i), point(i - 1) - point(i));
+    }
+    frames[i].y = Normalized(y);
+    frames[i].z = Normalized(z);
+  }
+
+  CGALVector3 previousY(0.0, 1.0, 0.0);
+  for (auto& frame : frames) {
+    if (IsZero(frame.y)) {
+      frame.y = previousY;
+    }
+    previousY = frame.y;
+  }
+
+  auto firstZ = std::find_if(frames.begin(), frames.end(), [](const SpineFrame& frame) { return !IsZero(frame.z); });
+  if (firstZ == frames.end()) {
+    CGALVector3 y = frames.front().y;
+    CGALVector3 axis = CGAL::cross_product(CGALVector3(0.0, 1.0, 0.0), y);
+    CGALVector3 z;
+    if (IsZero(Normalized(axis))) {
+      z = y.y() > 0.0 ? CGALVector3(0.0, 0.0, 1.0) : CGALVector3(0.0, 0.0, -1.0);
+    } else {
+      z = Rotate(CGALVector3(0.0, 0.0, 1.0), axis, std::acos(std::clamp(y.y(), -1.0, 1.0)));
+    }
+    for (auto& frame : frames) {
+      frame.z = z;
+    }
+  } else {
+    CGALVector3 previousZ = firstZ->z;
+    for (auto& frame : frames) {
+      if (IsZero(frame.z)) {
+        frame.z = previousZ;
+      } else if (frame.z * previousZ < 0.0) {
+        frame.z = -frame.z;
+      }
+      previousZ = frame.z;
+    }
+  }
+
+  for (auto& frame : frames) {
+    frame.x = Normalized(CGAL::cross_product(frame.y, frame.z));
+  }
+
+  return frames;
+}
+
+namespace to_geom::calculator {
+  to_geom::calculator::CalculatorResult ExtrusionCalculator::Generate3DMesh(
+      std::reference_wrapper<const vrml_proc::parser::model::Vec2fArray> crossSection,
+      std::reference_wrapper<const vrml_proc::parser::model::Vec3fArray> spine,
+      std::reference_wrapper<const vrml_proc::parser::model::Float32Array> scale,
+      std::reference_wrapper<const vrml_proc::parser::model::Float32Array> orientation,
+      bool beginCap,
+      bool endCap,
+      bool ccw,
+      const vrml_proc::math::TransformationMatrix& matrix,
+      tf::Executor* executor) {  //
+
+    using to_geom::calculator::error::ExtrusionCalculatorError;
+    using to_geom::calculator::error::InvalidNumberOfValuesError;
+    using to_geom::calculator::error::PropertiesError;
+    using vrml_proc::core::utils::ManualTimer;
+    using vrml_proc::core::utils::Range;
+    using vrml_proc::math::cgal::CGALPoint;
+    using vrml_proc::math::cgal::Vec3fToCGALVector3;
+    using vrml_proc::parser::model::float32_t;
+    using vrml_proc::parser::model::validator::error::NumberOutOfRangeError;
+    using namespace vrml_proc::core::logger;
+    using VertexIndex = to_geom::core::Mesh::Vertex_index;
+
+    VRMLPROC_LOG_DEBUG("Generate 3D mesh using ExtrusionCalculator.");
+
+    const auto& crossSectionPoints = crossSection.get().vectors;
+    const auto& spinePoints = spine.get().vectors;
+    const auto& scales = scale.get().values;
+    const auto& orientations = orientation.get().values;
+
+    auto mesh = std::make_shared<to_geom::core::Mesh>();
+
+    if (crossSectionPoints.size() < 2 || spinePoints.size() < 2) {
+      VRMLPROC_LOG_DEBUG("Extrusion has less than 2 spine or cross-section points, empty mesh is returned.");
+      return mesh;
+    }
+
+    if (scales.size() < 2 || scales.size() % 2 != 0) {
+      return cpp::fail(std::make_shared<ExtrusionCalculatorError>()
+                       << (std::make_shared<PropertiesError>()
+                           << std::make_shared<InvalidNumberOfValuesError>("scale", 2, scales.size())));
+    }
+    if (orientations.size() < 4 || orientations.size() % 4 != 0) {
+      return cpp::fail(std::make_shared<ExtrusionCalculatorError>()
+                       << (std::make_shared<PropertiesError>()
+                           << std::make_shared<InvalidNumberOfValuesError>("orientation", 4, orientations.size())));
+    }
+    Range<float32_t> scaleRange(0.0f, std::numeric_limits<float32_t>::infinity());
+    for (float32_t value : scales) {
+      if (!scaleRange.CheckValueInRangeInclusive(value)) {
+        return cpp::fail(std::make_shared<ExtrusionCalculatorError>()
+                         << (std::make_shared<PropertiesError>()
+                             << std::make_shared<NumberOutOfRangeError<float32_t>>(scaleRange, value)));
+      }
+    }
+
+    auto timer = ManualTimer();
+    timer.Start();
+
+    /**
+     * Closed cross-section and closed spine repeat their first point at the end. The repeated point is not stored
+     * again, so the surface is stitched into a closed tube (or torus).
+     */
+    const size_t spineCount = spinePoints.size();
+    const size_t crossSectionCount = crossSectionPoints.size();
+    const bool spineClosed = spineCount > 2 && AreEqual(spinePoints.front(), spinePoints.back());
+    const bool crossSectionClosed =
+        crossSectionCount > 2 && AreEqual(crossSectionPoints.front(), crossSectionPoints.back());
+    const size_t rings = spineClosed ? spineCount - 1 : spineCount;
+    const size_t ringSize = crossSectionClosed ? crossSectionCount - 1 : crossSectionCount;
+
+    const std::vector<SpineFrame> frames = ComputeSpineFrames(spinePoints, spineClosed);
+
+    std::vector<CGALPoint> points(rings * ringSize);
+    auto computeRings = [&](size_t firstRing, size_t lastRing) {
+      for (size_t i = firstRing; i < lastRing; ++i) {
+        const size_t scaleOffset = std::min(i, scales.size() / 2 - 1) * 2;
+        const size_t orientationOffset = std::min(i, orientations.size() / 4 - 1) * 4;
+        const CGALVector3 axis(
+            orientations[orientationOffset], orientations[orientationOffset + 1], orientations[orientationOffset + 2]);
+        const double angle = orientations[orientationOffset + 3];
+        const CGALVector3 origin = Vec3fToCGALVector3(spinePoints[i]);
+        const SpineFrame& frame = frames[i];
+
+        for (size_t j = 0; j < ringSize; ++j) {
+          CGALVector3 local = Rotate(CGALVector3(crossSectionPoints[j].u * scales[scaleOffset], 0.0,
+                                         crossSectionPoints[j].v * scales[scaleOffset + 1]),
+              axis, angle);
+          CGALVector3 position = origin + frame.x * local.x() + frame.y * local.y() + frame.z * local.z();
+          points[i * ringSize + j] = matrix.transform(CGAL::ORIGIN + position);
+        }
+      }
+    };
+
+    if (executor != nullptr && executor->num_workers() > 1 && points.size() >= ParallelVerticesThreshold) {
+      const size_t bands = std::min<size_t>(rings, executor->num_workers() * 4);
+      const size_t ringsPerBand = (rings + bands - 1) / bands;
+
+      tf::Taskflow taskflow;
+      for (size_t firstRing = 0; firstRing < rings; firstRing += ringsPerBand) {
+        size_t lastRing = std::min(rings, firstRing + ringsPerBand);
+        taskflow.emplace([&computeRings, firstRing, lastRing]() { computeRings(firstRing, lastRing); });
+      }
+      vrml_proc::core::parallelism::RunAndWait(*executor, taskflow);
+    } else {
+      computeRings(0, rings);
+    }
+
+    auto index = [&](size_t i, size_t j) {
+      return VertexIndex(static_cast<VertexIndex::size_type>((i % rings) * ringSize + (j % ringSize)));
+    };
+
+    /** Flat index buffer, three vertices per triangle. */
+    std::vector<VertexIndex> triangles;
+    const bool caps = !spineClosed && ringSize >= 3;
+    const size_t capTriangles =
+        caps ? (static_cast<size_t>(beginCap) + static_cast<size_t>(endCap)) * (ringSize - 2) : 0;
+    triangles.reserve(((spineCount - 1) * (crossSectionCount - 1) * 2 + capTriangles) * 3);
+
+    auto addTriangle = [&](VertexIndex a, VertexIndex b, VertexIndex c) {
+      if (ccw) {
+        triangles.insert(triangles.end(), {a, b, c});
+      } else {
+        triangles.insert(triangles.end(), {a, c, b});
+      }
+    };
+
+    for (size_t i = 0; i + 1 < spineCount; ++i) {
+      for (size_t j = 0; j + 1 < crossSectionCount; ++j) {
+        addTriangle(index(i, j), index(i, j + 1), index(i + 1, j + 1));
+        addTriangle(index(i, j), index(i + 1, j + 1), index(i + 1, j));
+      }
+    }
+    if (caps && beginCap) {
+      for (size_t k = 1; k + 1 < ringSize; ++k) {
+        addTriangle(index(0, 0), index(0, k + 1), index(0, k));
+      }
+    }
+    if (caps && endCap) {
+      for (size_t k = 1; k + 1 < ringSize; ++k) {
+        addTriangle(index(spineCount - 1, 0), index(spineCount - 1, k), index(spineCount - 1, k + 1));
+      }
+    }
+
+    mesh->reserve(points.size(), triangles.size() / 2, triangles.size() / 3);
+    for (const auto& point : points) {
+      mesh->add_vertex(point);
+    }
+    for (size_t t = 0; t < triangles.size(); t += 3) {
+      mesh->add_face(triangles[t], triangles[t + 1], triangles[t + 2]);
+    }
+
+    double time = timer.End();
+    VRMLPROC_LOG_DEBUG("Mesh was generated successfully. The generation took ", time, " seconds.");
+
+    return mesh;
+  }
+}  // namespace to_geom::calculator
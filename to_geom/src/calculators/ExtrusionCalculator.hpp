@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include <taskflow/taskflow.hpp>
+
+#include "CalculatorResult.hpp"
+#include "Float32Array.hpp"
+#include "TransformationMatrix.hpp"
+#include "Vec2fArray.hpp"
+#include "Vec3fArray.hpp"
+
+#include "ToGeomExport.hpp"
+
+namespace to_geom::calculator {
+  /**
+   * @brief Represents a calculator for Extrusion VRML node.
+   *
+   * The spine-aligned cross-section plane of every spine point is evaluated in one pass first. The cross-section is
+   * then placed at all spine points into a flat vertex buffer (in parallel for large extrusions, split into bands of
+   * spine points) and triangles of the swept surface and caps are emitted into a flat index buffer.
+   */
+  class TOGEOM_API ExtrusionCalculator {
+   public:
+    /**
+     * @brief Extrusions with at least this number of vertices have their vertices computed in parallel.
+     */
+    static constexpr size_t ParallelVerticesThreshold = 1 << 16;
+
+    /**
+     * @brief Generates 3D mesh for Extrusion geometry node.
+     *
+     * @param crossSection 2D cross-section in XZ plane of the spine-aligned cross-section plane
+     * @param spine piecewise linear curve along which the cross-section is swept
+     * @param scale flat array of (x, z) scale pairs, one per spine point (the last one is reused if there are fewer)
+     * @param orientation flat array of (axis x, axis y, axis z, angle) rotations, one per spine point (the last one is
+     * reused if there are fewer)
+     * @param beginCap flag indicating if the cap at the first spine point is generated
+     * @param endCap flag indicating if the cap at the last spine point is generated
+     * @param ccw flag indicating if faces are counterclockwise
+     * @param matrix tranformation matrix applied to geometry
+     * @param executor executor computing vertices of large extrusions, typically the one running the calling task;
+     * nullptr means that the mesh is generated on the calling thread only
+     * @returns calculator result (mesh object or error if generation failed)
+     * @note Caps are triangulated as fans, so they are correct for convex cross-sections only. Caps are not generated
+     * for closed spines.
+     */
+    to_geom::calculator::CalculatorResult Generate3DMesh(
+        std::reference_wrapper<const vrml_proc::parser::model::Vec2fArray> crossSection,
+        std::reference_wrapper<const vrml_proc::parser::model::Vec3fArray> spine,
+        std::reference_wrapper<const vrml_proc::parser::model::Float32Array> scale,
+        std::reference_wrapper<const vrml_proc::parser::model::Float32Array> orientation,
+        bool beginCap,
+        bool endCap,
+        bool ccw,
+        const vrml_proc::math::TransformationMatrix& matrix,
+        tf::Executor* executor = nullptr);
+  };
+}  // namespace to_geom::calculator
@@ -1,7 +1,10 @@
 #include "IndexedFaceSetCalculator.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -11,6 +14,7 @@
 #include <CGAL/Surface_mesh/Surface_mesh.h>
 
 #include <result.hpp>
+#include <taskflow/taskflow.hpp>
 
 #include "CalculatorError.hpp"
 #include "CalculatorResult.hpp"
@@ -23,17 +27,200 @@
 #include "ManualTimer.hpp"
 #include "Mesh.hpp"
 #include "Range.hpp"
+#include "TaskflowUtils.hpp"
 #include "UnsupportedOperationError.hpp"
 #include "Vec3f.hpp"
 #include "Vec3fArray.hpp"
 
+/**
+ * @brief Represents face-aligned part of the coordinate indices stream processed by one task of the split mode.
+ */
+struct IndicesChunk {
+  /** @brief Index of the first coordinate index of the chunk. */
+  size_t begin = 0;
+  /** @brief Index after the last -1 delimiter of the chunk. */
+  size_t end = 0;
+  /** @brief Points used by the chunk in the order of their first use. Local vertex `i` is point `usedPoints[i]`. */
+  std::vector<int32_t> usedPoints;
+  /** @brief Triangles made of local vertices. */
+  std::vector<uint32_t> triangles;
+  /** @brief The first error found in the chunk. */
+  cpp::result<void, std::shared_ptr<vrml_proc::core::error::Error>> status;
+};
+
+/**
+ * @brief Splits the indices into at most `count` chunks ending with a -1 delimiter. Each chunk boundary is found
+ * independently (and so in parallel) by scanning from an evenly spaced position to the nearest delimiter. Indices after
+ * the last delimiter do not form a face, so they are not part of any chunk.
+ */
+static std::vector<IndicesChunk> SplitIntoChunks(
+    const std::vector<int32_t>& indices, size_t count, tf::Executor& executor) {
+  /** Position after the last delimiter. */
+  size_t last = static_cast<size_t>(std::find(indices.rbegin(), indices.rend(), -1).base() - indices.begin());
+
+  std::vector<size_t> boundaries(count, last);
+  tf::Taskflow taskflow;
+  taskflow.for_each_index(size_t(1), count, size_t(1), [&indices, &boundaries, count, last](size_t k) {
+    auto from = indices.begin() + static_cast<std::ptrdiff_t>(indices.size() * k / count);
+    auto delimiter = std::find(from, indices.end(), -1);
+    boundaries[k - 1] = std::min(static_cast<size_t>(delimiter - indices.begin()) + 1, last);
+  });
+  vrml_proc::core::parallelism::RunAndWait(executor, taskflow);
+
+  std::vector<IndicesChunk> chunks;
+  size_t begin = 0;
+  for (size_t end : boundaries) {
+    if (end > begin) {
+      IndicesChunk chunk;
+      chunk.begin = begin;
+      chunk.end = end;
+      chunks.push_back(std::move(chunk));
+      begin = end;
+    }
+  }
+  return chunks;
+}
+
+/**
+ * @brief Validates faces of the chunk and remaps the points used by them to local vertices.
+ */
+static void ProcessChunk(
+    const std::vector<int32_t>& indices, const vrml_proc::core::utils::Range<int32_t>& range, IndicesChunk& chunk) {
+  using to_geom::calculator::error::IndexedFaceSetCalculatorError;
+  using to_geom::calculator::error::InvalidNumberOfCoordinatesForFaceError;
+  using to_geom::calculator::error::PropertiesError;
+  using vrml_proc::core::error::UnsupportedOperationError;
+
+  std::unordered_map<int32_t, uint32_t> pointToLocalVertex;
+  chunk.triangles.reserve((chunk.end - chunk.begin) / 4 * 3);
+
+  size_t start = chunk.begin;
+  for (size_t i = chunk.begin; i < chunk.end; ++i) {
+    if (indices[i] != -1) {
+      continue;
+    }
+
+    size_t coordinatesPerFace = i - start;
+    if (coordinatesPerFace <= 2) {
+      chunk.status = cpp::fail(std::make_shared<IndexedFaceSetCalculatorError>()
+                               << (std::make_shared<PropertiesError>()
+                                      << std::make_shared<InvalidNumberOfCoordinatesForFaceError>(coordinatesPerFace)));
+      return;
+    }
+    if (coordinatesPerFace > 3) {
+      chunk.status = cpp::fail(
+          std::make_shared<IndexedFaceSetCalculatorError>() << std::make_shared<UnsupportedOperationError>(
+              "Face is constructed from more than 3 coordinates. IndexedFaceSetCalculator does not support fan "
+              "triangulation or any other algorithms for such a task yet. Thus, mesh cannot be generated fully."));
+      return;
+    }
+
+    for (size_t j = start; j < i; ++j) {
+      auto [it, inserted] = pointToLocalVertex.try_emplace(indices[j], static_cast<uint32_t>(chunk.usedPoints.size()));
+      if (inserted) {
+        /** Range is always checked here, because points are remapped through a vector indexed by them. */
+        if (!range.CheckValueInRangeInclusive(indices[j])) {
+          auto outOfRange = to_geom::calculator::CalculatorUtils::ReturnVertexIndexOutOfRangeError<
+              IndexedFaceSetCalculatorError>(range, indices[j]);
+          chunk.status = cpp::fail(outOfRange.error());
+          return;
+        }
+        chunk.usedPoints.push_back(indices[j]);
+      }
+      chunk.triangles.push_back(it->second);
+    }
+
+    start = i + 1;
+  }
+}
+
+/**
+ * @brief Generates mesh of a huge IndexedFaceSet in the split mode. Faces are split into chunks which are validated and
+ * remapped to their own local vertices in parallel. Chunks are then stitched together in their order through a global
+ * point-to-vertex map, so the vertices and faces of the mesh are in the same order as if they were generated at once.
+ */
+static cpp::result<void, std::shared_ptr<vrml_proc::core::error::Error>> GenerateMeshInChunks(
+    const std::vector<int32_t>& indices,
+    const std::vector<vrml_proc::parser::model::Vec3f>& points,
+    const vrml_proc::math::TransformationMatrix& matrix,
+    tf::Executor& executor,
+    to_geom::core::Mesh& mesh) {
+  using vrml_proc::math::cgal::CGALPoint;
+  using VertexIndex = to_geom::core::Mesh::Vertex_index;
+
+  std::vector<IndicesChunk> chunks = SplitIntoChunks(indices, executor.num_workers() * 4, executor);
+  VRMLPROC_LOG_DEBUG("IndexedFaceSet is split into ", chunks.size(), " chunks.");
+
+  vrml_proc::core::utils::Range<int32_t> range(0, static_cast<int32_t>(points.size()) - 1);
+  {
+    tf::Taskflow taskflow;
+    for (auto& chunk : chunks) {
+      taskflow.emplace([&indices, &range, &chunk]() { ProcessChunk(indices, range, chunk); });
+    }
+    vrml_proc::core::parallelism::RunAndWait(executor, taskflow);
+  }
+
+  /** The first error in the stream order is reported, as if the faces were processed one by one. */
+  for (const auto& chunk : chunks) {
+    if (chunk.status.has_error()) {
+      return chunk.status;
+    }
+  }
+
+  constexpr uint32_t Unassigned = std::numeric_limits<uint32_t>::max();
+  std::vector<uint32_t> pointToVertex(points.size(), Unassigned);
+  std::vector<int32_t> vertexToPoint;
+  std::vector<std::vector<uint32_t>> localToGlobal(chunks.size());
+  for (size_t c = 0; c < chunks.size(); ++c) {
+    localToGlobal[c].reserve(chunks[c].usedPoints.size());
+    for (int32_t point : chunks[c].usedPoints) {
+      if (pointToVertex[point] == Unassigned) {
+        pointToVertex[point] = static_cast<uint32_t>(vertexToPoint.size());
+        vertexToPoint.push_back(point);
+      }
+      localToGlobal[c].push_back(pointToVertex[point]);
+    }
+  }
+
+  std::vector<CGALPoint> transformed(vertexToPoint.size());
+  {
+    tf::Taskflow taskflow;
+    taskflow.for_each_index(size_t(0), vertexToPoint.size(), size_t(1), [&](size_t v) {
+      const auto& point = points[vertexToPoint[v]];
+      transformed[v] = matrix.transform(CGALPoint(point.x, point.y, point.z));
+    });
+    vrml_proc::core::parallelism::RunAndWait(executor, taskflow);
+  }
+
+  size_t facesCount = 0;
+  for (const auto& chunk : chunks) {
+    facesCount += chunk.triangles.size() / 3;
+  }
+  mesh.reserve(transformed.size(), facesCount * 3 / 2, facesCount);
+  for (const auto& point : transformed) {
+    mesh.add_vertex(point);
+  }
+  for (size_t c = 0; c < chunks.size(); ++c) {
+    const auto& triangles = chunks[c].triangles;
+    const auto& toGlobal = localToGlobal[c];
+    for (size_t t = 0; t + 2 < triangles.size(); t += 3) {
+      mesh.add_face(VertexIndex(toGlobal[triangles[t]]), VertexIndex(toGlobal[triangles[t + 1]]),
+          VertexIndex(toGlobal[triangles[t + 2]]));
+    }
+  }
+
+  return {};
+}
+
 namespace to_geom::calculator {
 
   to_geom::calculator::CalculatorResult IndexedFaceSetCalculator::Generate3DMesh(
       std::reference_wrapper<const vrml_proc::parser::model::Int32Array> coordinateIndices,
       std::reference_wrapper<const vrml_proc::parser::model::Vec3fArray> coordinates,
       const vrml_proc::math::TransformationMatrix& matrix,
-      bool checkRange) {  //
+      bool checkRange,
+      tf::Executor* executor,
+      size_t splitThreshold) {  //
 
     using to_geom::calculator::error::IndexedFaceSetCalculatorError;
     using to_geom::calculator::error::InvalidNumberOfCoordinatesForFaceError;
@@ -44,7 +231,7 @@ namespace to_geom::calculator {
     using namespace vrml_proc::core::logger;
     using vrml_proc::math::cgal::CGALPoint;
 
-    LogDebug("Generate 3D mesh using IndexedFaceSetCalculator.", LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Generate 3D mesh using IndexedFaceSetCalculator.");
 
     auto mesh = std::make_shared<to_geom::core::Mesh>();
     auto error = std::make_shared<IndexedFaceSetCalculatorError>();
@@ -65,6 +252,16 @@ namespace to_geom::calculator {
     auto timer = vrml_proc::core::utils::ManualTimer();
     timer.Start();
 
+    if (executor != nullptr && executor->num_workers() > 1 && splitThreshold > 0 && indices.size() >= splitThreshold) {
+      auto result = GenerateMeshInChunks(indices, points, matrix, *executor, *mesh);
+      if (result.has_error()) {
+        return cpp::fail(result.error());
+      }
+      double time = timer.End();
+      VRMLPROC_LOG_DEBUG("Mesh was generated successfully in split mode. The generation took ", time, " seconds.");
+      return mesh;
+    }
+
     // Map indices to CGAL vertices.
     std::unordered_map<int32_t, typename to_geom::core::Mesh::Vertex_index> indexToVertex;
 
@@ -156,27 +353,26 @@ namespace to_geom::calculator {
     }
 
     double time = timer.End();
-    LogDebug(FormatString("Mesh was generated successfully. The generation took ", time, " seconds."), LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Mesh was generated successfully. The generation took ", time, " seconds.");
 
 #ifdef DEBUG
-    LogDebug(FormatString(
-                 "Mesh contains ", mesh->number_of_vertices(), " vertices and ", mesh->number_of_faces(), " faces."),
-        LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Mesh contains ", mesh->number_of_vertices(), " vertices and ", mesh->number_of_faces(),
+        " faces.");
 
-    LogDebug("Vertex coordinates:", LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Vertex coordinates:");
     for (auto v : mesh->vertices()) {
       auto point = mesh->point(v);
-      LogDebug(FormatString("Vertex ", v, ": (", point.x(), ", ", point.y(), ", ", point.z(), ")"), LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Vertex ", v, ": (", point.x(), ", ", point.y(), ", ", point.z(), ")");
     }
 
-    LogDebug("Face data:", LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Face data:");
     for (auto f : mesh->faces()) {
       std::ostringstream oss;
       oss << "Face " << f << " contains vertices: ";
       for (auto v : vertices_around_face(mesh->halfedge(f), *mesh)) {
         oss << v << " ";
       }
-      LogDebug(oss.str(), LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG(oss.str());
     }
 #endif
 
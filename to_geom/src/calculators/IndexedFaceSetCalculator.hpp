@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cstddef>
 #include <functional>
 
+#include <taskflow/taskflow.hpp>
+
 #include "CalculatorResult.hpp"
 #include "Int32Array.hpp"
 #include "TransformationMatrix.hpp"
@@ -12,9 +15,19 @@
 namespace to_geom::calculator {
   /**
    * @brief Represents a calculator for generating 3D meshes from IndexedFaceSet VRML node.
+   *
+   * Huge IndexedFaceSets may be generated in the split mode: coordinate indices are split into face-aligned chunks,
+   * which are validated and remapped to their own local vertices in parallel, and then stitched together through a
+   * global vertex map. The resulting mesh is the same as if it was generated on a single thread.
    */
   class TOGEOM_API IndexedFaceSetCalculator {
    public:
+    /**
+     * @brief IndexedFaceSets with at least this number of coordinate indices are generated in the split mode by
+     * default.
+     */
+    static constexpr size_t DefaultSplitThreshold = 1 << 20;
+
     /**
      * @brief Generates 3D mesh from coordinates and coordinates indices lists.
      *
@@ -23,14 +36,20 @@ namespace to_geom::calculator {
      * @param matrix transformation matrix applied to points
      * @param checkRange flag indicating if coordinate index should be checked for range when accessing `coordinates`
      * list
+     * @param executor executor running the split mode, typically the one running the calling task; nullptr means that
+     * the mesh is generated on the calling thread only
+     * @param splitThreshold minimal number of coordinate indices for the split mode (0 disables it); the split mode is
+     * used only if `executor` has more than 1 worker
      * @note You may want to set `checkRange` to false, if you know the indicis in your file are valid, as the
-     * calculations are (slightly) optimzed for this case.
+     * calculations are (slightly) optimzed for this case. The split mode checks the range always.
      * @returns calculator result (mesh object or error if generation failed)
      */
     to_geom::calculator::CalculatorResult Generate3DMesh(
         std::reference_wrapper<const vrml_proc::parser::model::Int32Array> coordinateIndices,
         std::reference_wrapper<const vrml_proc::parser::model::Vec3fArray> coordinates,
         const vrml_proc::math::TransformationMatrix& matrix,
-        bool checkRange = true);
+        bool checkRange = true,
+        tf::Executor* executor = nullptr,
+        size_t splitThreshold = DefaultSplitThreshold);
   };
 }  // namespace to_geom::calculator
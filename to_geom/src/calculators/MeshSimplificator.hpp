@@ -1,58 +1,136 @@
 #pragma once
 
+#include <cstddef>
+
+#include <CGAL/Kernel_traits.h>
 #include <CGAL/Surface_mesh_simplification/edge_collapse.h>
-#if __has_include(<CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_count_ratio_stop_predicate.h>)
-#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_count_ratio_stop_predicate.h>
-#else
-#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Count_ratio_stop_predicate.h>
+#if __has_include(<CGAL/Surface_mesh_simplification/Policies/Edge_collapse/GarlandHeckbert_plane_policies.h>)
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/GarlandHeckbert_plane_policies.h>
+#define TOGEOM_HAS_GARLAND_HECKBERT_POLICIES
 #endif
 
 #include "FormatString.hpp"
 #include "Logger.hpp"
 #include "ManualTimer.hpp"
 #include "Mesh.hpp"
+#include "ToGeomConfig.hpp"
 #include "UnitInterval.hpp"
 
 namespace to_geom::calculator::MeshSimplificator {
   /**
-   * @brief Simplifies the mesh by reducing the number of edges.
+   * @brief Stop predicate of the edge collapse which finishes the simplification according to simplification settings.
+   *
+   * - `EdgeCountRatio` stops when the ratio of the remaining and the original number of edges drops below `stopRatio`,
+   * - `FaceCount` stops when the number of faces drops to `targetFaceCount`,
+   * - `ErrorBound` stops when the cheapest remaining collapse costs more than `maxError`.
+   */
+  class StopPredicate {
+   public:
+    StopPredicate(const to_geom::core::config::ToGeomConfig::MeshSimplificationSettings& settings)
+        : m_predicate(settings.stopPredicate),
+          m_stopRatio(settings.percentageOfAllEdgesToSimplify.GetComplement().GetValue()),
+          m_targetFaceCount(settings.targetFaceCount),
+          m_maxError(settings.maxError) {}
+
+    template <typename FT, typename Profile>
+    bool operator()(const FT& currentCost,
+        const Profile& profile,
+        std::size_t initialEdgeCount,
+        std::size_t currentEdgeCount) const {
+      using to_geom::core::config::SimplificationStopPredicate;
+
+      switch (m_predicate) {
+        case SimplificationStopPredicate::FaceCount:
+          return profile.surface_mesh().number_of_faces() <= m_targetFaceCount;
+        case SimplificationStopPredicate::ErrorBound:
+          return static_cast<double>(currentCost) > m_maxError;
+        case SimplificationStopPredicate::EdgeCountRatio:
+        default:
+          return static_cast<double>(currentEdgeCount) < m_stopRatio * static_cast<double>(initialEdgeCount);
+      }
+    }
+
+   private:
+    to_geom::core::config::SimplificationStopPredicate m_predicate;
+    double m_stopRatio;
+    std::size_t m_targetFaceCount;
+    double m_maxError;
+  };
+
+  /**
+   * @brief Collapses edges of the mesh until the stop predicate given by the settings is satisfied.
+   *
+   * With the `ErrorBound` predicate, Garland-Heckbert plane quadrics are used as the cost if they are available, so
+   * `maxError` bounds the squared distance of the new vertices to the planes of the original faces. Otherwise the
+   * default Lindstrom-Turk cost is bounded.
    *
    * @param mesh mesh to simplify
-   * @param stopRatio number <0.0, 1.0> indicating when the simplification must finish, meaning that in the end 1.0 -
-   * `stopRatio` of the original mesh edges are collapsed
+   * @param settings simplification settings
+   * @returns number of collapsed edges, or -1 if the mesh cannot be simplified (it is not a valid triangle mesh)
    */
-  inline void SimplifyMesh(to_geom::core::Mesh& mesh, vrml_proc::core::utils::UnitInterval stopRatio) {  //
+  inline int CollapseEdges(
+      to_geom::core::Mesh& mesh, const to_geom::core::config::ToGeomConfig::MeshSimplificationSettings& settings) {  //
 
-    using namespace vrml_proc::core::logger;
-    using namespace vrml_proc::core::utils;
+    if (!CGAL::is_triangle_mesh(mesh) || !CGAL::is_valid_polygon_mesh(mesh)) {
+      return -1;
+    }
 
-    LogInfo(
-        FormatString("Simplify the mesh (stop ratio is set to ", stopRatio.GetValue(), " - stopping simplifying when ",
-            100.0 - stopRatio.GetAsPercentage(), "% of the original number of edges are collapsed)."),
-        LOGGING_INFO);
+    namespace SMS = CGAL::Surface_mesh_simplification;
 
-    if (!CGAL::is_triangle_mesh(mesh)) {
-      LogError("Mesh cannot be simplified, because the mesh is not a pure triangular mesh.", LOGGING_INFO);
-      return;
+    StopPredicate stop(settings);
+
+#ifdef TOGEOM_HAS_GARLAND_HECKBERT_POLICIES
+    if (settings.stopPredicate == to_geom::core::config::SimplificationStopPredicate::ErrorBound) {
+      using Kernel = typename CGAL::Kernel_traits<to_geom::core::Mesh::Point>::Kernel;
+      SMS::GarlandHeckbert_plane_policies<to_geom::core::Mesh, Kernel> policies(mesh);
+      return SMS::edge_collapse(
+          mesh, stop, CGAL::parameters::get_cost(policies.get_cost()).get_placement(policies.get_placement()));
     }
+#endif
 
-    if (!CGAL::is_valid_polygon_mesh(mesh)) {
-      LogError("Mesh cannot be simplified, because the mesh is not a valid polygon mesh.", LOGGING_INFO);
-      return;
+    return SMS::edge_collapse(mesh, stop);
+  }
+
+  /**
+   * @brief Simplifies the whole (merged) mesh by reducing the number of edges.
+   *
+   * @param mesh mesh to simplify
+   * @param settings simplification settings
+   */
+  inline void SimplifyMesh(
+      to_geom::core::Mesh& mesh, const to_geom::core::config::ToGeomConfig::MeshSimplificationSettings& settings) {  //
+
+    using namespace vrml_proc::core::logger;
+    using namespace vrml_proc::core::utils;
+    using to_geom::core::config::SimplificationStopPredicate;
+
+    switch (settings.stopPredicate) {
+      case SimplificationStopPredicate::FaceCount:
+        LogInfo(FormatString("Simplify the mesh (stopping simplifying when the mesh has ", settings.targetFaceCount,
+                    " faces)."),
+            LOGGING_INFO);
+        break;
+      case SimplificationStopPredicate::ErrorBound:
+        LogInfo(FormatString("Simplify the mesh (stopping simplifying when the error of the next collapse exceeds ",
+                    settings.maxError, ")."),
+            LOGGING_INFO);
+        break;
+      default:
+        LogInfo(FormatString("Simplify the mesh (stopping simplifying when ",
+                    settings.percentageOfAllEdgesToSimplify.GetAsPercentage(),
+                    "% of the original number of edges are collapsed)."),
+            LOGGING_INFO);
+        break;
     }
 
     ManualTimer timer;
     timer.Start();
 
-    namespace SMS = CGAL::Surface_mesh_simplification;
-
-#if __has_include(<CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_count_ratio_stop_predicate.h>)
-    SMS::Edge_count_ratio_stop_predicate<to_geom::core::Mesh> stop(stopRatio.GetValue());
-#else
-    SMS::Count_ratio_stop_predicate<to_geom::core::Mesh> stop(stopRatio.GetValue());
-#endif
-
-    int collapsedEdgesCount = SMS::edge_collapse(mesh, stop);
+    int collapsedEdgesCount = CollapseEdges(mesh, settings);
+    if (collapsedEdgesCount < 0) {
+      LogError("Mesh cannot be simplified, because the mesh is not a valid pure triangular mesh.", LOGGING_INFO);
+      return;
+    }
 
     double time = timer.End();
 
@@ -60,4 +138,25 @@ namespace to_geom::calculator::MeshSimplificator {
                 "Simplification took ", time, " seconds. In total, ", collapsedEdgesCount, " edges were collapsed."),
         LOGGING_INFO);
   }
+
+  /**
+   * @brief Simplifies one submesh by reducing the number of edges. It is meant to be called from mesh tasks, so the
+   * submeshes are simplified in parallel and the validity checks run on small meshes only.
+   *
+   * @param mesh submesh to simplify
+   * @param settings simplification settings (`ToGeomConfig` rejects the `FaceCount` predicate in the per-part mode)
+   */
+  inline void SimplifySubmesh(
+      to_geom::core::Mesh& mesh, const to_geom::core::config::ToGeomConfig::MeshSimplificationSettings& settings) {  //
+
+    using namespace vrml_proc::core::logger;
+
+    int collapsedEdgesCount = CollapseEdges(mesh, settings);
+    if (collapsedEdgesCount < 0) {
+      VRMLPROC_LOG_DEBUG("Submesh is not a valid pure triangular mesh, it is not simplified.");
+      return;
+    }
+
+    VRMLPROC_LOG_DEBUG("Submesh was simplified, ", collapsedEdgesCount, " edges were collapsed.");
+  }
 }  // namespace to_geom::calculator::MeshSimplificator
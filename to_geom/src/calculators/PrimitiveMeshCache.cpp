@@ -0,0 +1,226 @@
+#include "PrimitiveMeshCache.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numbers>
+#include <shared_mutex>
+#include <vector>
+
+#include <CGAL/Kernel/interface_macros.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Surface_mesh/Surface_mesh.h>
+
+#include "CGALBaseTypesForVrml.hpp"
+#include "Logger.hpp"
+#include "Mesh.hpp"
+#include "TransformationMatrix.hpp"
+#include "Vec3f.hpp"
+
+using to_geom::calculator::PrimitiveMeshCache;
+using to_geom::core::Mesh;
+using vrml_proc::math::cgal::CGALPoint;
+
+/**
+ * @brief Adds ring of `segments` vertices around the Y axis into the mesh.
+ *
+ * @returns index of the first vertex of the ring, the other vertices follow it
+ */
+static Mesh::Vertex_index AddRing(Mesh& mesh, double radius, double y, unsigned int segments) {
+  Mesh::Vertex_index first;
+  for (unsigned int s = 0; s < segments; ++s) {
+    double angle = 2.0 * std::numbers::pi * s / segments;
+    auto vertex = mesh.add_vertex(CGALPoint(radius * std::sin(angle), y, radius * std::cos(angle)));
+    if (s == 0) {
+      first = vertex;
+    }
+  }
+  return first;
+}
+
+/**
+ * @brief Returns vertex of the ring at given (wrapped) position.
+ */
+static Mesh::Vertex_index RingVertex(Mesh::Vertex_index first, unsigned int position, unsigned int segments) {
+  return Mesh::Vertex_index(static_cast<Mesh::Vertex_index::size_type>(first.idx() + position % segments));
+}
+
+/**
+ * @brief Adds disc made of a triangle fan around a new center vertex. Disc faces positive Y if `up` is true.
+ */
+static void AddDisc(Mesh& mesh, Mesh::Vertex_index ring, double y, unsigned int segments, bool up) {
+  auto center = mesh.add_vertex(CGALPoint(0.0, y, 0.0));
+  for (unsigned int s = 0; s < segments; ++s) {
+    auto current = RingVertex(ring, s, segments);
+    auto next = RingVertex(ring, s + 1, segments);
+    if (up) {
+      mesh.add_face(center, current, next);
+    } else {
+      mesh.add_face(center, next, current);
+    }
+  }
+}
+
+/**
+ * @brief Creates sphere of radius 1. It has `segments` slices and `segments / 2` (at least 2) stacks.
+ */
+static std::shared_ptr<Mesh> CreateUnitSphere(unsigned int segments) {
+  auto mesh = std::make_shared<Mesh>();
+  unsigned int stacks = std::max(2u, segments / 2);
+
+  auto north = mesh->add_vertex(CGALPoint(0.0, 1.0, 0.0));
+  std::vector<Mesh::Vertex_index> rings;
+  rings.reserve(stacks - 1);
+  for (unsigned int k = 1; k < stacks; ++k) {
+    double angle = std::numbers::pi * k / stacks;
+    rings.push_back(AddRing(*mesh, std::sin(angle), std::cos(angle), segments));
+  }
+  auto south = mesh->add_vertex(CGALPoint(0.0, -1.0, 0.0));
+
+  for (unsigned int s = 0; s < segments; ++s) {
+    mesh->add_face(north, RingVertex(rings.front(), s, segments), RingVertex(rings.front(), s + 1, segments));
+  }
+  for (size_t k = 0; k + 1 < rings.size(); ++k) {
+    for (unsigned int s = 0; s < segments; ++s) {
+      auto upperCurrent = RingVertex(rings[k], s, segments);
+      auto upperNext = RingVertex(rings[k], s + 1, segments);
+      auto lowerCurrent = RingVertex(rings[k + 1], s, segments);
+      auto lowerNext = RingVertex(rings[k + 1], s + 1, segments);
+      mesh->add_face(upperCurrent, lowerCurrent, lowerNext);
+      mesh->add_face(upperCurrent, lowerNext, upperNext);
+    }
+  }
+  for (unsigned int s = 0; s < segments; ++s) {
+    mesh->add_face(south, RingVertex(rings.back(), s + 1, segments), RingVertex(rings.back(), s, segments));
+  }
+
+  return mesh;
+}
+
+/**
+ * @brief Creates cylinder of radius 1 and height 1. Side and caps share the vertices of their rings.
+ */
+static std::shared_ptr<Mesh> CreateUnitCylinder(unsigned int segments, bool side, bool top, bool bottom) {
+  auto mesh = std::make_shared<Mesh>();
+
+  Mesh::Vertex_index bottomRing;
+  Mesh::Vertex_index topRing;
+  if (side || bottom) {
+    bottomRing = AddRing(*mesh, 1.0, -0.5, segments);
+  }
+  if (side || top) {
+    topRing = AddRing(*mesh, 1.0, 0.5, segments);
+  }
+
+  if (side) {
+    for (unsigned int s = 0; s < segments; ++s) {
+      auto bottomCurrent = RingVertex(bottomRing, s, segments);
+      auto bottomNext = RingVertex(bottomRing, s + 1, segments);
+      auto topCurrent = RingVertex(topRing, s, segments);
+      auto topNext = RingVertex(topRing, s + 1, segments);
+      mesh->add_face(bottomCurrent, bottomNext, topNext);
+      mesh->add_face(bottomCurrent, topNext, topCurrent);
+    }
+  }
+  if (top) {
+    AddDisc(*mesh, topRing, 0.5, segments, true);
+  }
+  if (bottom) {
+    AddDisc(*mesh, bottomRing, -0.5, segments, false);
+  }
+
+  return mesh;
+}
+
+/**
+ * @brief Creates cone of bottom radius 1 and height 1 with its apex pointing to positive Y.
+ */
+static std::shared_ptr<Mesh> CreateUnitCone(unsigned int segments, bool side, bool bottom) {
+  auto mesh = std::make_shared<Mesh>();
+  if (!side && !bottom) {
+    return mesh;
+  }
+
+  auto bottomRing = AddRing(*mesh, 1.0, -0.5, segments);
+  if (side) {
+    auto apex = mesh->add_vertex(CGALPoint(0.0, 0.5, 0.0));
+    for (unsigned int s = 0; s < segments; ++s) {
+      mesh->add_face(apex, RingVertex(bottomRing, s, segments), RingVertex(bottomRing, s + 1, segments));
+    }
+  }
+  if (bottom) {
+    AddDisc(*mesh, bottomRing, -0.5, segments, false);
+  }
+
+  return mesh;
+}
+
+/**
+ * @brief Tessellates unit mesh for the key.
+ */
+static std::shared_ptr<Mesh> CreateUnitMesh(const PrimitiveMeshCache::Key& key) {
+  switch (key.primitive) {
+    case PrimitiveMeshCache::Primitive::Sphere:
+      return CreateUnitSphere(key.segments);
+    case PrimitiveMeshCache::Primitive::Cylinder:
+      return CreateUnitCylinder(key.segments, key.side, key.top, key.bottom);
+    case PrimitiveMeshCache::Primitive::Cone:
+      return CreateUnitCone(key.segments, key.side, key.bottom);
+  }
+  return std::make_shared<Mesh>();
+}
+
+/** @brief Guards `cache`. */
+static std::shared_mutex cacheMutex;
+/** @brief Cached unit meshes. */
+static std::map<PrimitiveMeshCache::Key, std::shared_ptr<const Mesh>> cache;
+
+namespace to_geom::calculator {
+  std::shared_ptr<const to_geom::core::Mesh> PrimitiveMeshCache::GetUnitMesh(Key key) {  //
+
+    /** Normalize the key, so that flags which do not apply to the primitive do not create duplicate entries. */
+    key.segments = std::max(key.segments, MinimalSegments);
+    if (key.primitive == Primitive::Sphere) {
+      key.side = key.top = key.bottom = true;
+    } else if (key.primitive == Primitive::Cone) {
+      key.top = false;
+    }
+
+    {
+      std::shared_lock lock(cacheMutex);
+      auto it = cache.find(key);
+      if (it != cache.end()) {
+        return it->second;
+      }
+    }
+
+    VRMLPROC_LOG_DEBUG("Tessellate unit primitive with ", key.segments, " segments.");
+
+    /** Tessellation runs outside of the lock. If two threads race, the first inserted mesh wins. */
+    std::shared_ptr<const to_geom::core::Mesh> mesh = CreateUnitMesh(key);
+    std::unique_lock lock(cacheMutex);
+    return cache.try_emplace(key, mesh).first->second;
+  }
+
+  std::shared_ptr<to_geom::core::Mesh> PrimitiveMeshCache::CreateInstance(
+      Key key, const vrml_proc::parser::model::Vec3f& scale, const vrml_proc::math::TransformationMatrix& matrix) {  //
+
+    using vrml_proc::math::TransformationMatrix;
+
+    auto mesh = std::make_shared<to_geom::core::Mesh>(*GetUnitMesh(key));
+
+    TransformationMatrix instanceMatrix = matrix * TransformationMatrix(scale.x, 0, 0, 0, scale.y, 0, 0, 0, scale.z);
+    for (auto vertex : mesh->vertices()) {
+      mesh->point(vertex) = instanceMatrix.transform(mesh->point(vertex));
+    }
+
+    return mesh;
+  }
+
+  void PrimitiveMeshCache::Clear() {
+    std::unique_lock lock(cacheMutex);
+    cache.clear();
+  }
+}  // namespace to_geom::calculator
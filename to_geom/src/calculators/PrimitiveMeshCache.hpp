@@ -0,0 +1,70 @@
+#pragma once
+
+#include <compare>
+#include <memory>
+
+#include "Mesh.hpp"
+#include "TransformationMatrix.hpp"
+#include "Vec3f.hpp"
+
+#include "ToGeomExport.hpp"
+
+namespace to_geom::calculator {
+  /**
+   * @brief Represents a process-wide cache of tessellated unit primitives (Sphere, Cylinder and Cone).
+   *
+   * Unit primitive is centered in the origin and has all its dimensions (radius, height) equal to 1. Every instance of
+   * a primitive in a VRML file is then only a copy of the cached unit mesh, scaled and transformed in one pass over its
+   * vertices. The cache is thread-safe.
+   */
+  class TOGEOM_API PrimitiveMeshCache {
+   public:
+    /**
+     * @brief Type of the cached primitive.
+     */
+    enum class Primitive { Sphere, Cylinder, Cone };
+
+    /**
+     * @brief Key identifying one unit mesh.
+     */
+    struct Key {
+      Primitive primitive;
+      /** @brief Number of segments around the Y axis. */
+      unsigned int segments;
+      bool side;
+      bool top;
+      bool bottom;
+
+      auto operator<=>(const Key&) const = default;
+    };
+
+    /**
+     * @brief Minimal number of segments, smaller values are clamped to it.
+     */
+    static constexpr unsigned int MinimalSegments = 3;
+
+    /**
+     * @brief Returns unit mesh for the key, the mesh is tessellated only when it is requested for the first time.
+     *
+     * @param key key of the mesh
+     * @returns unit mesh
+     */
+    static std::shared_ptr<const to_geom::core::Mesh> GetUnitMesh(Key key);
+
+    /**
+     * @brief Creates an instance of the unit mesh: copies it and applies `scale` and then `matrix` to its vertices.
+     *
+     * @param key key of the unit mesh
+     * @param scale scale of the unit mesh in each axis
+     * @param matrix transformation matrix applied to the scaled mesh
+     * @returns new mesh
+     */
+    static std::shared_ptr<to_geom::core::Mesh> CreateInstance(
+        Key key, const vrml_proc::parser::model::Vec3f& scale, const vrml_proc::math::TransformationMatrix& matrix);
+
+    /**
+     * @brief Removes all cached meshes.
+     */
+    static void Clear();
+  };
+}  // namespace to_geom::calculator
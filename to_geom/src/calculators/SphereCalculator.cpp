@@ -0,0 +1,47 @@
+#include "SphereCalculator.hpp"
+
+#include <memory>
+
+#include <result.hpp>
+
+#include "CalculatorError.hpp"
+#include "CalculatorResult.hpp"
+#include "Error.hpp"
+#include "Logger.hpp"
+#include "ManualTimer.hpp"
+#include "Mesh.hpp"
+#include "ModelValidator.hpp"
+#include "PrimitiveMeshCache.hpp"
+#include "Vec3f.hpp"
+
+namespace to_geom::calculator {
+  to_geom::calculator::CalculatorResult SphereCalculator::Generate3DMesh(
+      vrml_proc::parser::model::float32_t radius,
+      unsigned int segments,
+      const vrml_proc::math::TransformationMatrix& matrix) {  //
+
+    using namespace vrml_proc::core::logger;
+    using namespace vrml_proc::core::utils;
+    using namespace vrml_proc::parser::model::validator;
+
+    VRMLPROC_LOG_DEBUG("Generate 3D mesh using SphereCalculator.");
+
+    vrml_proc::parser::model::Vec3f scale = {radius, radius, radius};
+    auto checkResult = CheckVec3fIsGreaterThanZero(scale);
+    if (checkResult.has_error()) {
+      return cpp::fail(std::make_shared<error::SphereCalculatorError>()
+                       << (std::make_shared<error::PropertiesError>() << checkResult.error()));
+    }
+
+    auto timer = ManualTimer();
+    timer.Start();
+
+    auto mesh = PrimitiveMeshCache::CreateInstance(
+        PrimitiveMeshCache::Key{PrimitiveMeshCache::Primitive::Sphere, segments, true, true, true}, scale, matrix);
+
+    double time = timer.End();
+    VRMLPROC_LOG_DEBUG("Mesh was generated successfully. The generation took ", time, " seconds.");
+
+    return mesh;
+  }
+}  // namespace to_geom::calculator
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CalculatorResult.hpp"
+#include "TransformationMatrix.hpp"
+#include "VrmlUnits.hpp"
+
+#include "ToGeomExport.hpp"
+
+namespace to_geom::calculator {
+  /**
+   * @brief Represents a calculator for Sphere VRML node.
+   *
+   * Mesh is an instance of the unit sphere cached in `PrimitiveMeshCache`.
+   */
+  class TOGEOM_API SphereCalculator {
+   public:
+    /**
+     * @brief Generates 3D mesh for Sphere geometry primitive.
+     *
+     * @param radius radius of the sphere
+     * @param segments number of segments around the Y axis
+     * @param matrix tranformation matrix applied to geometry
+     * @returns calculator result (mesh object or error if generation failed)
+     */
+    to_geom::calculator::CalculatorResult Generate3DMesh(vrml_proc::parser::model::float32_t radius,
+        unsigned int segments,
+        const vrml_proc::math::TransformationMatrix& matrix);
+  };
+}  // namespace to_geom::calculator
@@ -67,6 +67,51 @@ namespace to_geom::calculator::error {
     }
   };
 
+  /**
+   * @brief Concrete error in the calculator stating that number of heights does not match the grid dimensions.
+   */
+  class InvalidNumberOfHeightsError : public vrml_proc::core::error::Error {
+   public:
+    InvalidNumberOfHeightsError(size_t expectedNumberOfHeights, size_t numberOfHeights)
+        : m_expectedNumberOfHeights(expectedNumberOfHeights), m_numberOfHeights(numberOfHeights) {}
+
+   protected:
+    virtual std::string GetMessageInternal() const {
+      std::ostringstream stream;
+      stream << "[InvalidNumberOfHeightsError]: grid requires at least <" << m_expectedNumberOfHeights
+             << "> heights (xDimension * zDimension)! The actual number received is <" << m_numberOfHeights << ">.\n";
+      return stream.str();
+    }
+
+   private:
+    size_t m_expectedNumberOfHeights;
+    size_t m_numberOfHeights;
+  };
+
+  /**
+   * @brief Concrete error in the calculator stating that array does not hold a whole number of its elements (e.g.
+   * MFVec2f stored as a flat array of floats).
+   */
+  class InvalidNumberOfValuesError : public vrml_proc::core::error::Error {
+   public:
+    InvalidNumberOfValuesError(std::string name, size_t valuesPerElement, size_t numberOfValues)
+        : m_name(name), m_valuesPerElement(valuesPerElement), m_numberOfValues(numberOfValues) {}
+
+   protected:
+    virtual std::string GetMessageInternal() const {
+      std::ostringstream stream;
+      stream << "[InvalidNumberOfValuesError]: array <" << m_name << "> must contain at least one element of <"
+             << m_valuesPerElement << "> values and no partial element! The actual number of values is <"
+             << m_numberOfValues << ">.\n";
+      return stream.str();
+    }
+
+   private:
+    std::string m_name;
+    size_t m_valuesPerElement;
+    size_t m_numberOfValues;
+  };
+
   /**
    * @brief Represents an error for BoxCalculator.
    */
@@ -152,4 +197,86 @@ namespace to_geom::calculator::error {
       return stream.str();
     }
   };
+
+  /**
+   * @brief Represents an error for ElevationGridCalculator.
+   */
+  class ElevationGridCalculatorError : public CalculatorError {
+   public:
+    ElevationGridCalculatorError(std::shared_ptr<vrml_proc::core::error::Error> innerError) {
+      SetInnerError(innerError);
+    }
+    ElevationGridCalculatorError() = default;
+
+   protected:
+    std::string GetMessageInternal() const override {
+      std::ostringstream stream;
+      stream << CalculatorError::GetMessageInternal() << "[ElevationGridCalculatorError]: error occured!\n";
+      return stream.str();
+    }
+  };
+
+  /**
+   * @brief Represents an error for SphereCalculator.
+   */
+  class SphereCalculatorError : public CalculatorError {
+   public:
+    SphereCalculatorError(std::shared_ptr<vrml_proc::core::error::Error> innerError) { SetInnerError(innerError); }
+    SphereCalculatorError() = default;
+
+   protected:
+    std::string GetMessageInternal() const override {
+      std::ostringstream stream;
+      stream << CalculatorError::GetMessageInternal() << "[SphereCalculatorError]: error occured!\n";
+      return stream.str();
+    }
+  };
+
+  /**
+   * @brief Represents an error for CylinderCalculator.
+   */
+  class CylinderCalculatorError : public CalculatorError {
+   public:
+    CylinderCalculatorError(std::shared_ptr<vrml_proc::core::error::Error> innerError) { SetInnerError(innerError); }
+    CylinderCalculatorError() = default;
+
+   protected:
+    std::string GetMessageInternal() const override {
+      std::ostringstream stream;
+      stream << CalculatorError::GetMessageInternal() << "[CylinderCalculatorError]: error occured!\n";
+      return stream.str();
+    }
+  };
+
+  /**
+   * @brief Represents an error for ConeCalculator.
+   */
+  class ConeCalculatorError : public CalculatorError {
+   public:
+    ConeCalculatorError(std::shared_ptr<vrml_proc::core::error::Error> innerError) { SetInnerError(innerError); }
+    ConeCalculatorError() = default;
+
+   protected:
+    std::string GetMessageInternal() const override {
+      std::ostringstream stream;
+      stream << CalculatorError::GetMessageInternal() << "[ConeCalculatorError]: error occured!\n";
+      return stream.str();
+    }
+  };
+
+  /**
+   * @brief Represents an error for ExtrusionCalculator.
+   */
+  class ExtrusionCalculatorError : public CalculatorError {
+   public:
+    ExtrusionCalculatorError(std::shared_ptr<vrml_proc::core::error::Error> innerError) { SetInnerError(innerError); }
+    ExtrusionCalculatorError() = default;
+
+   protected:
+    std::string GetMessageInternal() const override {
+      std::ostringstream stream;
+      stream << CalculatorError::GetMessageInternal() << "[ExtrusionCalculatorError]: error occured!\n";
+      return stream.str();
+    }
+  };
 }  // namespace to_geom::calculator::error
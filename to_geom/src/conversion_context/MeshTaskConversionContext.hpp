@@ -1,11 +1,15 @@
 #pragma once
 
+#include "ChunkedVectorConversionContext.hpp"
 #include "MeshTask.hpp"
-#include "VectorConversionContext.hpp"
 
 namespace to_geom::conversion_context {
   /**
    * @brief Represents a conversion context which stores a collection of mesh tasks.
+   *
+   * Contexts are merged at every level of the VRML node hierarchy, so chunked storage is used to merge them in
+   * constant time.
    */
-  using MeshTaskConversionContext = vrml_proc::conversion_context::VectorConversionContext<to_geom::core::MeshTask>;
+  using MeshTaskConversionContext =
+      vrml_proc::conversion_context::ChunkedVectorConversionContext<to_geom::core::MeshTask>;
 }  // namespace to_geom::conversion_context
@@ -1,12 +1,87 @@
 #pragma once
 
+#include <concepts>
+#include <cstddef>
 #include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <taskflow/taskflow.hpp>
 
 #include "CalculatorResult.hpp"
 
 namespace to_geom::core {
   /**
    * @brief Represents a task (function) which returns CalculatorResult.
+   *
+   * Each task carries a cheap estimate of its cost, which is filled in by the action creating it (it is roughly the
+   * number of processed indices, points or generated triangles). Runners use it to start the most expensive tasks
+   * first and to pack the cheap ones into batches.
+   *
+   * A task is run with the executor of the runner running it (or with nullptr if it is run on the calling thread), so
+   * that a task generating a huge mesh may split its work among the worker threads of the same executor.
    */
-  using MeshTask = std::function<to_geom::calculator::CalculatorResult()>;
+  class MeshTask {
+   public:
+    /**
+     * @brief Cost of a task whose cost was not estimated.
+     */
+    static constexpr size_t DefaultCost = 1;
+
+    /**
+     * @brief Recommended minimal total cost of a batch of cheap tasks run at once by one thread.
+     */
+    static constexpr size_t BatchCost = 1 << 12;
+
+    /**
+     * @brief Constructs an empty task.
+     */
+    MeshTask() = default;
+
+    /**
+     * @brief Constructs a task which may run its work on the given executor.
+     *
+     * @param function function generating the mesh, it receives the executor the task is run with (may be nullptr)
+     * @param cost estimated cost of the task
+     */
+    template <typename Function>
+      requires(!std::same_as<std::remove_cvref_t<Function>, MeshTask> &&
+               std::is_invocable_r_v<to_geom::calculator::CalculatorResult, Function&, tf::Executor*>)
+    MeshTask(Function&& function, size_t cost = DefaultCost)
+        : m_function(std::forward<Function>(function)), m_cost(cost) {}
+
+    /**
+     * @brief Constructs a task which always runs on the calling thread.
+     *
+     * @param function function generating the mesh
+     * @param cost estimated cost of the task
+     */
+    template <typename Function>
+      requires(!std::same_as<std::remove_cvref_t<Function>, MeshTask> &&
+               std::is_invocable_r_v<to_geom::calculator::CalculatorResult, Function&>)
+    MeshTask(Function&& function, size_t cost = DefaultCost)
+        : m_function([function = std::forward<Function>(function)](tf::Executor*) mutable { return function(); }),
+          m_cost(cost) {}
+
+    /**
+     * @brief Runs the task.
+     *
+     * @param executor executor whose worker threads the task may use, nullptr means the calling thread only
+     * @returns calculator result
+     */
+    to_geom::calculator::CalculatorResult operator()(tf::Executor* executor = nullptr) const {
+      return m_function(executor);
+    }
+
+    /**
+     * @brief Gets estimated cost of the task.
+     *
+     * @returns estimated cost
+     */
+    size_t GetCost() const { return m_cost; }
+
+   private:
+    std::function<to_geom::calculator::CalculatorResult(tf::Executor*)> m_function;
+    size_t m_cost = DefaultCost;
+  };
 }  // namespace to_geom::core
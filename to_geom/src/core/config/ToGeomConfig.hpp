@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <filesystem>
+#include <functional>
 #include <memory>
 #include <string>
 #include <thread>
@@ -19,6 +21,10 @@
 #include "VrmlProcConfig.hpp"
 #include "UnitInterval.hpp"
 
+namespace to_geom::core {
+  class MeshTask;
+}
+
 namespace to_geom::core::config {
 
   /**
@@ -42,15 +48,74 @@ namespace to_geom::core::config {
     return format;
   }
 
+  /**
+   * @brief Represents whether the final merged mesh is simplified (`Global`), or each submesh right after it is
+   * generated (`PerPart`).
+   */
+  enum class SimplificationMode { Global, PerPart };
+
+  /**
+   * @brief Represents a condition which finishes the mesh simplification.
+   */
+  enum class SimplificationStopPredicate { EdgeCountRatio, FaceCount, ErrorBound };
+
+  /**
+   * @brief Helper function which converts string to SimplificationMode and logs the process.
+   *
+   * @param string string to convert
+   * @returns SimplificationMode after conversion
+   */
+  inline SimplificationMode ConvertStringToSimplificationMode(const std::string& string) {
+    if (string == "global") {
+      return SimplificationMode::Global;
+    }
+    if (string == "perPart") {
+      return SimplificationMode::PerPart;
+    }
+
+    vrml_proc::core::logger::LogWarning(
+        vrml_proc::core::utils::FormatString("While parsing JSON field <mode>, an error occured. The value <", string,
+            "> is not an expected value! The default value (<global>) will be used."),
+        LOGGING_INFO);
+    return SimplificationMode::Global;
+  }
+
+  /**
+   * @brief Helper function which converts string to SimplificationStopPredicate and logs the process.
+   *
+   * @param string string to convert
+   * @returns SimplificationStopPredicate after conversion
+   */
+  inline SimplificationStopPredicate ConvertStringToSimplificationStopPredicate(const std::string& string) {
+    if (string == "edgeCountRatio") {
+      return SimplificationStopPredicate::EdgeCountRatio;
+    }
+    if (string == "faceCount") {
+      return SimplificationStopPredicate::FaceCount;
+    }
+    if (string == "errorBound") {
+      return SimplificationStopPredicate::ErrorBound;
+    }
+
+    vrml_proc::core::logger::LogWarning(
+        vrml_proc::core::utils::FormatString("While parsing JSON field <stopPredicate>, an error occured. The value <",
+            string, "> is not an expected value! The default value (<edgeCountRatio>) will be used."),
+        LOGGING_INFO);
+    return SimplificationStopPredicate::EdgeCountRatio;
+  }
+
   /**
    * @brief Represents a configuration file for `togeom` library.
    *
    * Configuration file for `togeom` has following properties:
    *  - vrmlProcConfig (inherited properties from VrmlProcConfig class).
    *  - IndexedFaceSet settings
+   *  - PointSet settings
    *  - parallelism settings
    *  - exportFormat settings
    *  - meshSimplification settings
+   *  - metricsReport settings
+   *  - tracing settings
    *
    * @implements `Config` class with Load() method.
    */
@@ -60,6 +125,23 @@ namespace to_geom::core::config {
      */
     struct IfsSettigs {
       bool checkRange = true;
+      /** @brief IndexedFaceSets with at least this number of coordinate indices are generated in parallel chunks. */
+      size_t splitThreshold = 1 << 20;
+    };
+
+    /**
+     * @brief Represents settings for reconstruction of PointSet nodes. Not positive alpha value means that the optimal
+     * one is computed for every point cloud.
+     */
+    struct PointSetSettings {
+      double alphaValue = 0.0;
+    };
+
+    /**
+     * @brief Represents settings for tessellation of Sphere, Cylinder and Cone nodes.
+     */
+    struct TessellationSettings {
+      unsigned int segments = 32;
     };
 
     /**
@@ -75,8 +157,26 @@ namespace to_geom::core::config {
      */
     struct MeshSimplificationSettings {
       bool active = false;
+      SimplificationMode mode = SimplificationMode::Global;
+      SimplificationStopPredicate stopPredicate = SimplificationStopPredicate::EdgeCountRatio;
       vrml_proc::core::utils::UnitInterval percentageOfAllEdgesToSimplify =
           vrml_proc::core::utils::UnitInterval::Create(0.5).value();
+      size_t targetFaceCount = 0;
+      double maxError = 0.0;
+    };
+
+    /**
+     * @brief Represents settings for the performance report of the conversion.
+     */
+    struct MetricsReportSettings {
+      bool active = false;
+    };
+
+    /**
+     * @brief Represents settings for the Chrome trace of the conversion.
+     */
+    struct TracingSettings {
+      bool active = false;
     };
 
     /**
@@ -98,8 +198,21 @@ namespace to_geom::core::config {
     to_geom::core::io::ExportFormat exportFormat = to_geom::core::io::ExportFormat::Stl;
     ExportFormatOptions exportFormatOptions;
     IfsSettigs ifsSettings;
+    PointSetSettings pointSetSettings;
+    TessellationSettings tessellationSettings;
     ParallelismSettings parallelismSettings;
     MeshSimplificationSettings meshSimplificationSettings;
+    MetricsReportSettings metricsReportSettings;
+    TracingSettings tracingSettings;
+
+    /**
+     * @brief Receives each mesh task as soon as a geometry action creates it, so that the application may start
+     * generating the mesh while the traversal is still running. If it is empty, the tasks are collected in the
+     * conversion contexts returned by the traversal.
+     *
+     * It is not loaded from the JSON file, it is set by the application for the duration of one traversal.
+     */
+    std::function<void(to_geom::core::MeshTask&&)> meshTaskSink;
 
     /**
      * @brief Loads configuration file from JSON file.
@@ -131,6 +244,18 @@ namespace to_geom::core::config {
           if (json.value().contains("IFSSettings") && (json.value())["IFSSettings"].is_object()) {
             const auto& ifs = (json.value())["IFSSettings"];
             ifsSettings.checkRange = ifs.value("checkRange", true);
+            ifsSettings.splitThreshold = ifs.value("splitThreshold", size_t(1) << 20);
+          }
+          if (json.value().contains("pointSet") && (json.value())["pointSet"].is_object()) {
+            const auto& pointSet = (json.value())["pointSet"];
+            pointSetSettings.alphaValue = pointSet.value("alphaValue", 0.0);
+          }
+          if (json.value().contains("tessellation") && (json.value())["tessellation"].is_object()) {
+            const auto& tessellation = (json.value())["tessellation"];
+            tessellationSettings.segments = tessellation.value("segments", 32u);
+            if (tessellationSettings.segments < 3) {
+              tessellationSettings.segments = 3;
+            }
           }
           if (json.value().contains("parallelismSettings") && (json.value())["parallelismSettings"].is_object()) {
             const auto& parallelism = (json.value())["parallelismSettings"];
@@ -152,6 +277,24 @@ namespace to_geom::core::config {
               meshSimplificationSettings.percentageOfAllEdgesToSimplify =
                   vrml_proc::core::utils::UnitInterval::Create(0.5).value();
             }
+            meshSimplificationSettings.mode =
+                ConvertStringToSimplificationMode(simplification.value("mode", "global"));
+            meshSimplificationSettings.stopPredicate =
+                ConvertStringToSimplificationStopPredicate(simplification.value("stopPredicate", "edgeCountRatio"));
+            meshSimplificationSettings.targetFaceCount = simplification.value("targetFaceCount", size_t{0});
+            meshSimplificationSettings.maxError = simplification.value("maxError", 0.0);
+            auto validation = ValidateMeshSimplificationSettings();
+            if (validation.has_error()) {
+              return validation;
+            }
+          }
+          if (json.value().contains("metricsReport") && (json.value())["metricsReport"].is_object()) {
+            const auto& metricsReport = (json.value())["metricsReport"];
+            metricsReportSettings.active = metricsReport.value("active", false);
+          }
+          if (json.value().contains("tracing") && (json.value())["tracing"].is_object()) {
+            const auto& tracing = (json.value())["tracing"];
+            tracingSettings.active = tracing.value("active", false);
           }
         } catch (const nlohmann::json::exception& e) {
           return cpp::fail(std::make_shared<vrml_proc::core::io::error::JsonError>(e.what()));
@@ -162,5 +305,37 @@ namespace to_geom::core::config {
 
       return cpp::fail(json.error());
     }
+
+   private:
+    /**
+     * @brief Rejects combinations of mesh simplification settings which cannot work as requested.
+     *
+     * - `faceCount` in the `perPart` mode would apply the target to every submesh, as the submeshes are simplified
+     * independently in parallel before the total number of faces is known.
+     * - `errorBound` needs a positive `maxError`, otherwise no edge is collapsed.
+     *
+     * @returns result containing error if the settings are invalid, else empty
+     */
+    cpp::result<void, std::shared_ptr<vrml_proc::core::error::Error>> ValidateMeshSimplificationSettings() const {  //
+
+      if (!meshSimplificationSettings.active) {
+        return {};
+      }
+
+      if (meshSimplificationSettings.mode == SimplificationMode::PerPart &&
+          meshSimplificationSettings.stopPredicate == SimplificationStopPredicate::FaceCount) {
+        return cpp::fail(std::make_shared<vrml_proc::core::io::error::JsonError>(
+            "meshSimplification: stopPredicate <faceCount> is not supported in the <perPart> mode, use the <global> "
+            "mode instead"));
+      }
+
+      if (meshSimplificationSettings.stopPredicate == SimplificationStopPredicate::ErrorBound &&
+          !(meshSimplificationSettings.maxError > 0.0)) {
+        return cpp::fail(std::make_shared<vrml_proc::core::io::error::JsonError>(
+            "meshSimplification: stopPredicate <errorBound> requires a positive <maxError>"));
+      }
+
+      return {};
+    }
   };
 }  // namespace to_geom::core::config
@@ -3,20 +3,32 @@
 
 #include <algorithm>
 #include <filesystem>
+#include <fstream>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include <BoxCalculator.hpp>
 #include <CalculatorError.hpp>
+#include <ConeCalculator.hpp>
+#include <CylinderCalculator.hpp>
+#include <ElevationGridCalculator.hpp>
+#include <ExtrusionCalculator.hpp>
+#include <Float32Array.hpp>
 #include <IndexedFaceSetCalculator.hpp>
 #include <Int32Array.hpp>
 #include <Logger.hpp>
+#include <MeshSimplificator.hpp>
 #include <ModelValidationError.hpp>
+#include <PrimitiveMeshCache.hpp>
+#include <SphereCalculator.hpp>
 #include <StlFileWriter.hpp>
+#include <ToGeomConfig.hpp>
 #include <Transformation.hpp>
 #include <TransformationMatrix.hpp>
+#include <Vec2fArray.hpp>
 #include <Vec3f.hpp>
+#include <Vec3fArray.hpp>
 #include <VrmlUnits.hpp>
 #include <AlphaShapeCalculator.hpp>
 
@@ -629,6 +641,62 @@ TEST_CASE("IndexedFaceSetCalculator - valid III.", "[valid]") {
   }
 }
 
+TEST_CASE("IndexedFaceSetCalculator - split mode", "[valid]") {
+  using vrml_proc::parser::model::Vec3f;
+
+  to_geom::calculator::IndexedFaceSetCalculator calculator = to_geom::calculator::IndexedFaceSetCalculator();
+
+  const int32_t size = 20;
+  vrml_proc::parser::model::Vec3fArray points;
+  for (int32_t row = 0; row < size; ++row) {
+    for (int32_t column = 0; column < size; ++column) {
+      points.vectors.emplace_back(Vec3f(static_cast<float>(column), static_cast<float>(row), 0.0f));
+    }
+  }
+  vrml_proc::parser::model::Int32Array indices;
+  for (int32_t row = 0; row + 1 < size; ++row) {
+    for (int32_t column = 0; column + 1 < size; ++column) {
+      int32_t index = row * size + column;
+      indices.integers.insert(indices.integers.end(),
+          {index, index + 1, index + size + 1, -1, index, index + size + 1, index + size, -1});
+    }
+  }
+  /** Indices after the last delimiter do not form a face. */
+  indices.integers.insert(indices.integers.end(), {0, 1});
+
+  vrml_proc::math::TransformationMatrix matrix;
+
+  auto expected = calculator.Generate3DMesh(std::cref(indices), std::cref(points), matrix);
+  REQUIRE(expected.has_value());
+  tf::Executor executor(4);
+  auto split = calculator.Generate3DMesh(std::cref(indices), std::cref(points), matrix, true, &executor, 1);
+  REQUIRE(split.has_value());
+
+  CHECK(split.value()->number_of_vertices() == expected.value()->number_of_vertices());
+  CHECK(split.value()->number_of_faces() == expected.value()->number_of_faces());
+  CHECK(split.value()->number_of_faces() == (size - 1) * (size - 1) * 2);
+  for (auto vertex : expected.value()->vertices()) {
+    CHECK(split.value()->point(vertex) == expected.value()->point(vertex));
+  }
+
+  {
+    auto invalid = indices;
+    invalid.integers[invalid.integers.size() / 2 + 3] = static_cast<int32_t>(points.vectors.size());
+    auto result = calculator.Generate3DMesh(std::cref(invalid), std::cref(points), matrix, false, &executor, 1);
+    REQUIRE(result.has_error());
+    CHECK(CheckInnermostError<vrml_proc::parser::model::validator::error::NumberOutOfRangeError<int32_t>>(
+        result.error()));
+  }
+
+  {
+    auto invalid = indices;
+    invalid.integers.insert(invalid.integers.begin() + static_cast<std::ptrdiff_t>(invalid.integers.size() / 2), -1);
+    auto result = calculator.Generate3DMesh(std::cref(invalid), std::cref(points), matrix, true, &executor, 1);
+    REQUIRE(result.has_error());
+    CHECK(CheckInnermostError<to_geom::calculator::error::InvalidNumberOfCoordinatesForFaceError>(result.error()));
+  }
+}
+
 TEST_CASE("AlphaShapeCalculator - valid I.", "[valid]") {
   using vrml_proc::parser::model::Vec3f;
 
@@ -656,6 +724,42 @@ TEST_CASE("AlphaShapeCalculator - valid I.", "[valid]") {
   }
 }
 
+TEST_CASE("AlphaShapeCalculator - valid II.", "[valid]") {
+  vrml_proc::parser::model::Vec3fArray pointCloud;
+  pointCloud.vectors = {{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {0.0f, 1.0f, 0.0f},
+      {0.0f, 0.0f, 1.0f}, {1.0f, 0.0f, 1.0f}, {1.0f, 1.0f, 1.0f}, {0.0f, 1.0f, 1.0f}};
+  vrml_proc::math::TransformationMatrix matrix;
+
+  /** Facets share vertices of the triangulation, so the cube hull is an indexed mesh. */
+  for (unsigned int threads : {1u, 4u}) {
+    auto result = to_geom::calculator::AlphaShapeCalculator::Generate3DAlphaShapeMeshForPointCloud(
+        std::cref(pointCloud), 100.0, matrix, threads);
+    REQUIRE(result.has_value());
+    CHECK(result.value()->number_of_vertices() == 8);
+    CHECK(result.value()->number_of_faces() == 12);
+    CHECK(result.value()->is_valid());
+  }
+
+  {
+    pointCloud.vectors.resize(4);
+    auto result = to_geom::calculator::AlphaShapeCalculator::Generate3DAlphaShapeMeshForPointCloud(
+        std::cref(pointCloud), 0.0, matrix);
+    REQUIRE(result.has_value());
+    CHECK(result.value()->is_empty());
+  }
+}
+
+TEST_CASE("AlphaShapeCalculator - invalid", "[invalid]") {
+  vrml_proc::parser::model::Vec3fArray pointCloud;
+  vrml_proc::math::TransformationMatrix matrix;
+
+  auto result = to_geom::calculator::AlphaShapeCalculator::Generate3DAlphaShapeMeshForPointCloud(
+      std::cref(pointCloud), 0.5, matrix);
+  REQUIRE(result.has_error());
+  CHECK(CheckInnermostError<vrml_proc::parser::model::validator::error::EmptyArrayError>(result.error()));
+  LogError(result.error());
+}
+
 TEST_CASE("IndexedFaceSetCalculator (only triangular faces without their range check) - valid I.", "[valid]") {
   to_geom::calculator::IndexedFaceSetCalculator calculator = to_geom::calculator::IndexedFaceSetCalculator();
 
@@ -1055,3 +1159,316 @@ TEST_CASE("IndexedFaceSetCalculator (only triangular faces with their range chec
     LogError(result.error());
   }
 }
+
+TEST_CASE("ElevationGridCalculator - valid I.", "[valid]") {
+  to_geom::calculator::ElevationGridCalculator calculator = to_geom::calculator::ElevationGridCalculator();
+
+  vrml_proc::parser::model::Float32Array height;
+  height.values = {0.0f, 1.0f, 0.5f, 0.25f, 2.0f, 0.0f, 1.5f, 0.75f, 0.0f, 0.0f, 1.0f, 0.5f};
+
+  vrml_proc::math::TransformationMatrix matrix;
+
+  {
+    auto result = calculator.Generate3DMesh(std::cref(height), 4, 3, 1.0f, 2.0f, true, matrix);
+    REQUIRE(result.has_value());
+    CHECK(result.value()->number_of_vertices() == 12);
+    CHECK(result.value()->number_of_faces() == 12);
+    CHECK(result.value()->is_valid());
+  }
+
+  {
+    tf::Executor executor(4);
+    auto result = calculator.Generate3DMesh(std::cref(height), 4, 3, 1.0f, 2.0f, false, matrix, &executor);
+    REQUIRE(result.has_value());
+    CHECK(result.value()->number_of_vertices() == 12);
+    CHECK(result.value()->number_of_faces() == 12);
+  }
+
+  {
+    auto result = calculator.Generate3DMesh(std::cref(height), 1, 12, 1.0f, 1.0f, true, matrix);
+    REQUIRE(result.has_value());
+    CHECK(result.value()->is_empty());
+  }
+}
+
+TEST_CASE("ElevationGridCalculator - valid II.", "[valid]") {
+  to_geom::calculator::ElevationGridCalculator calculator = to_geom::calculator::ElevationGridCalculator();
+
+  const int32_t dimension = 1025;
+  vrml_proc::parser::model::Float32Array height;
+  height.values.resize(static_cast<size_t>(dimension) * dimension, 1.0f);
+
+  vrml_proc::math::TransformationMatrix matrix;
+
+  {
+    tf::Executor executor(4);
+    auto result =
+        calculator.Generate3DMesh(std::cref(height), dimension, dimension, 0.5f, 0.5f, true, matrix, &executor);
+    REQUIRE(result.has_value());
+    CHECK(result.value()->number_of_vertices() == static_cast<size_t>(dimension) * dimension);
+    CHECK(result.value()->number_of_faces() == static_cast<size_t>(dimension - 1) * (dimension - 1) * 2);
+  }
+}
+
+TEST_CASE("ElevationGridCalculator - invalid", "[invalid]") {
+  to_geom::calculator::ElevationGridCalculator calculator = to_geom::calculator::ElevationGridCalculator();
+
+  vrml_proc::parser::model::Float32Array height;
+  height.values = {0.0f, 1.0f, 0.5f, 0.25f, 2.0f};
+
+  vrml_proc::math::TransformationMatrix matrix;
+
+  {
+    auto result = calculator.Generate3DMesh(std::cref(height), 3, 2, 1.0f, 1.0f, true, matrix);
+    REQUIRE(result.has_error());
+    CHECK(CheckInnermostError<to_geom::calculator::error::InvalidNumberOfHeightsError>(result.error()));
+    LogError(result.error());
+  }
+
+  {
+    auto result = calculator.Generate3DMesh(std::cref(height), 2, 2, -1.0f, 1.0f, true, matrix);
+    REQUIRE(result.has_error());
+    CHECK(CheckInnermostError<
+        vrml_proc::parser::model::validator::error::NumberOutOfRangeError<vrml_proc::parser::model::float32_t>>(
+        result.error()));
+    LogError(result.error());
+  }
+}
+
+TEST_CASE("MeshSimplificator - stop predicates", "[valid]") {
+  using to_geom::core::config::SimplificationStopPredicate;
+  using to_geom::core::config::ToGeomConfig;
+
+  to_geom::calculator::ElevationGridCalculator calculator = to_geom::calculator::ElevationGridCalculator();
+
+  const int32_t dimension = 20;
+  vrml_proc::parser::model::Float32Array height;
+  height.values.resize(static_cast<size_t>(dimension) * dimension, 0.0f);
+  const size_t originalFacesCount = static_cast<size_t>(dimension - 1) * (dimension - 1) * 2;
+
+  vrml_proc::math::TransformationMatrix matrix;
+
+  {
+    auto result = calculator.Generate3DMesh(std::cref(height), dimension, dimension, 1.0f, 1.0f, true, matrix);
+    REQUIRE(result.has_value());
+
+    ToGeomConfig::MeshSimplificationSettings settings;
+    settings.stopPredicate = SimplificationStopPredicate::FaceCount;
+    settings.targetFaceCount = 100;
+    to_geom::calculator::MeshSimplificator::SimplifySubmesh(*result.value(), settings);
+    CHECK(result.value()->number_of_faces() <= 100);
+    CHECK(result.value()->is_valid());
+  }
+
+  {
+    auto result = calculator.Generate3DMesh(std::cref(height), dimension, dimension, 1.0f, 1.0f, true, matrix);
+    REQUIRE(result.has_value());
+
+    ToGeomConfig::MeshSimplificationSettings settings;
+    settings.stopPredicate = SimplificationStopPredicate::EdgeCountRatio;
+    to_geom::calculator::MeshSimplificator::SimplifyMesh(*result.value(), settings);
+    CHECK(result.value()->number_of_faces() < originalFacesCount);
+    CHECK(result.value()->is_valid());
+  }
+
+  {
+    auto result = calculator.Generate3DMesh(std::cref(height), dimension, dimension, 1.0f, 1.0f, true, matrix);
+    REQUIRE(result.has_value());
+
+    ToGeomConfig::MeshSimplificationSettings settings;
+    settings.stopPredicate = SimplificationStopPredicate::ErrorBound;
+    settings.maxError = -1.0;
+    to_geom::calculator::MeshSimplificator::SimplifySubmesh(*result.value(), settings);
+    CHECK(result.value()->number_of_faces() == originalFacesCount);
+  }
+}
+
+TEST_CASE("ToGeomConfig - invalid mesh simplification settings", "[invalid]") {
+  std::filesystem::path filepath = std::filesystem::current_path() / "meshSimplificationConfig.json";
+
+  auto load = [&filepath](const std::string& simplification) {
+    {
+      std::ofstream file(filepath);
+      file << R"({ "meshSimplification": )" << simplification << " }";
+    }
+    to_geom::core::config::ToGeomConfig config;
+    auto result = config.Load(filepath);
+    std::filesystem::remove(filepath);
+    return result;
+  };
+
+  CHECK(load(R"({ "active": true, "mode": "perPart", "stopPredicate": "faceCount", "targetFaceCount": 10 })")
+            .has_error());
+  CHECK(load(R"({ "active": true, "mode": "global", "stopPredicate": "faceCount", "targetFaceCount": 10 })")
+            .has_value());
+  CHECK(load(R"({ "active": true, "stopPredicate": "errorBound" })").has_error());
+  CHECK(load(R"({ "active": true, "stopPredicate": "errorBound", "maxError": 0.01 })").has_value());
+  CHECK(load(R"({ "active": false, "stopPredicate": "errorBound" })").has_value());
+}
+
+TEST_CASE("PrimitiveMeshCache - unit meshes are shared", "[valid]") {
+  using to_geom::calculator::PrimitiveMeshCache;
+
+  auto sphere = PrimitiveMeshCache::GetUnitMesh({PrimitiveMeshCache::Primitive::Sphere, 8, true, true, true});
+  CHECK(sphere == PrimitiveMeshCache::GetUnitMesh({PrimitiveMeshCache::Primitive::Sphere, 8, false, false, false}));
+  CHECK(sphere != PrimitiveMeshCache::GetUnitMesh({PrimitiveMeshCache::Primitive::Sphere, 16, true, true, true}));
+  CHECK(PrimitiveMeshCache::GetUnitMesh({PrimitiveMeshCache::Primitive::Cylinder, 8, true, true, true}) !=
+        PrimitiveMeshCache::GetUnitMesh({PrimitiveMeshCache::Primitive::Cylinder, 8, true, false, true}));
+  CHECK(PrimitiveMeshCache::GetUnitMesh({PrimitiveMeshCache::Primitive::Cylinder, 1, true, true, true}) ==
+        PrimitiveMeshCache::GetUnitMesh(
+            {PrimitiveMeshCache::Primitive::Cylinder, PrimitiveMeshCache::MinimalSegments, true, true, true}));
+}
+
+TEST_CASE("SphereCalculator, CylinderCalculator, ConeCalculator - valid", "[valid]") {
+  vrml_proc::math::TransformationMatrix matrix;
+
+  {
+    auto result = to_geom::calculator::SphereCalculator().Generate3DMesh(2.0f, 8, matrix);
+    REQUIRE(result.has_value());
+    CHECK(result.value()->number_of_vertices() == 26);
+    CHECK(result.value()->number_of_faces() == 48);
+    CHECK(result.value()->is_valid());
+  }
+
+  {
+    auto result = to_geom::calculator::CylinderCalculator().Generate3DMesh(0.5f, 4.0f, true, true, true, 8, matrix);
+    REQUIRE(result.has_value());
+    CHECK(result.value()->number_of_vertices() == 18);
+    CHECK(result.value()->number_of_faces() == 32);
+
+    double maxY = 0.0;
+    for (auto vertex : result.value()->vertices()) {
+      maxY = std::max(maxY, result.value()->point(vertex).y());
+    }
+    CHECK(maxY == 2.0);
+  }
+
+  {
+    auto result = to_geom::calculator::CylinderCalculator().Generate3DMesh(0.5f, 4.0f, true, false, false, 8, matrix);
+    REQUIRE(result.has_value());
+    CHECK(result.value()->number_of_vertices() == 16);
+    CHECK(result.value()->number_of_faces() == 16);
+  }
+
+  {
+    auto result = to_geom::calculator::ConeCalculator().Generate3DMesh(1.0f, 2.0f, true, true, 8, matrix);
+    REQUIRE(result.has_value());
+    CHECK(result.value()->number_of_vertices() == 10);
+    CHECK(result.value()->number_of_faces() == 16);
+  }
+
+  {
+    auto result = to_geom::calculator::ConeCalculator().Generate3DMesh(1.0f, 2.0f, false, false, 8, matrix);
+    REQUIRE(result.has_value());
+    CHECK(result.value()->is_empty());
+  }
+}
+
+TEST_CASE("SphereCalculator, CylinderCalculator, ConeCalculator - invalid", "[invalid]") {
+  vrml_proc::math::TransformationMatrix matrix;
+
+  {
+    auto result = to_geom::calculator::SphereCalculator().Generate3DMesh(0.0f, 8, matrix);
+    REQUIRE(result.has_error());
+    CHECK(CheckInnermostError<
+        vrml_proc::parser::model::validator::error::NumberOutOfRangeError<vrml_proc::parser::model::float32_t>>(
+        result.error()));
+    LogError(result.error());
+  }
+
+  {
+    auto result = to_geom::calculator::CylinderCalculator().Generate3DMesh(1.0f, -2.0f, true, true, true, 8, matrix);
+    REQUIRE(result.has_error());
+    CHECK(CheckInnermostError<
+        vrml_proc::parser::model::validator::error::NumberOutOfRangeError<vrml_proc::parser::model::float32_t>>(
+        result.error()));
+    LogError(result.error());
+  }
+
+  {
+    auto result = to_geom::calculator::ConeCalculator().Generate3DMesh(-1.0f, 2.0f, true, true, 8, matrix);
+    REQUIRE(result.has_error());
+    CHECK(CheckInnermostError<
+        vrml_proc::parser::model::validator::error::NumberOutOfRangeError<vrml_proc::parser::model::float32_t>>(
+        result.error()));
+    LogError(result.error());
+  }
+}
+
+TEST_CASE("ExtrusionCalculator - valid", "[valid]") {
+  to_geom::calculator::ExtrusionCalculator calculator = to_geom::calculator::ExtrusionCalculator();
+
+  vrml_proc::parser::model::Vec2fArray crossSection;
+  crossSection.vectors = {{1.0f, 1.0f}, {1.0f, -1.0f}, {-1.0f, -1.0f}, {-1.0f, 1.0f}, {1.0f, 1.0f}};
+  vrml_proc::parser::model::Vec3fArray spine;
+  spine.vectors = {{0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+  vrml_proc::parser::model::Float32Array scale;
+  scale.values = {1.0f, 1.0f};
+  vrml_proc::parser::model::Float32Array orientation;
+  orientation.values = {0.0f, 0.0f, 1.0f, 0.0f};
+
+  vrml_proc::math::TransformationMatrix matrix;
+
+  {
+    auto result = calculator.Generate3DMesh(std::cref(crossSection), std::cref(spine), std::cref(scale),
+        std::cref(orientation), true, true, true, matrix);
+    REQUIRE(result.has_value());
+    CHECK(result.value()->number_of_vertices() == 8);
+    CHECK(result.value()->number_of_faces() == 12);
+    CHECK(result.value()->is_valid());
+  }
+
+  {
+    auto result = calculator.Generate3DMesh(std::cref(crossSection), std::cref(spine), std::cref(scale),
+        std::cref(orientation), false, false, false, matrix);
+    REQUIRE(result.has_value());
+    CHECK(result.value()->number_of_vertices() == 8);
+    CHECK(result.value()->number_of_faces() == 8);
+  }
+
+  {
+    tf::Executor executor(4);
+    /** Closed spine of 4 segments makes a closed square torus without caps. */
+    spine.vectors = {{0.0f, 0.0f, 0.0f}, {4.0f, 0.0f, 0.0f}, {4.0f, 0.0f, 4.0f}, {0.0f, 0.0f, 4.0f},
+        {0.0f, 0.0f, 0.0f}};
+    auto result = calculator.Generate3DMesh(std::cref(crossSection), std::cref(spine), std::cref(scale),
+        std::cref(orientation), true, true, true, matrix, &executor);
+    REQUIRE(result.has_value());
+    CHECK(result.value()->number_of_vertices() == 16);
+    CHECK(result.value()->number_of_faces() == 32);
+  }
+}
+
+TEST_CASE("ExtrusionCalculator - invalid", "[invalid]") {
+  to_geom::calculator::ExtrusionCalculator calculator = to_geom::calculator::ExtrusionCalculator();
+
+  vrml_proc::parser::model::Vec2fArray crossSection;
+  crossSection.vectors = {{1.0f, 1.0f}, {1.0f, -1.0f}, {-1.0f, -1.0f}, {-1.0f, 1.0f}, {1.0f, 1.0f}};
+  vrml_proc::parser::model::Vec3fArray spine;
+  spine.vectors = {{0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+  vrml_proc::parser::model::Float32Array scale;
+  vrml_proc::parser::model::Float32Array orientation;
+  orientation.values = {0.0f, 0.0f, 1.0f, 0.0f};
+
+  vrml_proc::math::TransformationMatrix matrix;
+
+  {
+    scale.values = {1.0f, 1.0f, 1.0f};
+    auto result = calculator.Generate3DMesh(std::cref(crossSection), std::cref(spine), std::cref(scale),
+        std::cref(orientation), true, true, true, matrix);
+    REQUIRE(result.has_error());
+    CHECK(CheckInnermostError<to_geom::calculator::error::InvalidNumberOfValuesError>(result.error()));
+    LogError(result.error());
+  }
+
+  {
+    scale.values = {1.0f, -1.0f};
+    auto result = calculator.Generate3DMesh(std::cref(crossSection), std::cref(spine), std::cref(scale),
+        std::cref(orientation), true, true, true, matrix);
+    REQUIRE(result.has_error());
+    CHECK(CheckInnermostError<
+        vrml_proc::parser::model::validator::error::NumberOutOfRangeError<vrml_proc::parser::model::float32_t>>(
+        result.error()));
+    LogError(result.error());
+  }
+}
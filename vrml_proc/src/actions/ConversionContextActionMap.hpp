@@ -1,19 +1,35 @@
 #pragma once
 
 #include <any>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
+#include <span>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "ConversionContextable.hpp"
 #include "ConversionContextAction.hpp"
 #include "FormatString.hpp"
 #include "HandlerToActionBundle.hpp"
+#include "Hash.hpp"
 #include "Logger.hpp"
 
 namespace vrml_proc::action {
   /**
    * @brief Represents class which is responsible for storing and mapping `Action` functor value to a string key.
+   *
+   * Besides the runtime actions (added by `AddAction()`), the map may hold a fixed table of static actions (set by
+   * `SetStaticActions()`). Static action is dispatched through a plain function pointer and its Action object is
+   * created on the stack, so no `std::function` call and no heap allocation of the Action is needed per node. Static
+   * actions are stored in an open addressing table indexed by hash of their key, which is the canonical id of the node
+   * (see `NodeView::GetId()`), so the traversal finds the action without hashing the node name again. Runtime action
+   * with the same key always takes precedence over the static one.
    */
   template <vrml_proc::core::contract::ConversionContextable ConversionContext>
   class ConversionContextActionMap {
@@ -29,6 +45,50 @@ namespace vrml_proc::action {
      */
     using ActionFunctor = std::function<std::shared_ptr<ConversionContextAction<ConversionContext>>(Argument)>;
 
+    /**
+     * @brief Function creating an Action object owned by a shared pointer.
+     */
+    using StaticActionCreator = std::shared_ptr<ConversionContextAction<ConversionContext>> (*)(const Argument&);
+
+    /**
+     * @brief Function creating an Action object on the stack and executing it right away.
+     */
+    using StaticActionExecutor = std::shared_ptr<ConversionContext> (*)(const Argument&);
+
+    /**
+     * @brief Entry of the static action table.
+     */
+    struct StaticAction {
+      /** @brief Key of the action. */
+      std::string_view key;
+      /** @brief Hash of the key, the table is indexed by it. */
+      uint32_t id;
+      StaticActionCreator create;
+      StaticActionExecutor execute;
+    };
+
+    /**
+     * @brief Creates entry of the static action table for `Action`. Action is constructed from the results of
+     * `PropertiesFactories` called (in the given order) with the argument passed from the handler.
+     *
+     * @tparam Action type of the action
+     * @tparam PropertiesFactories functions taking `const Argument&` and returning constructor arguments of `Action`
+     * @param key key of the action
+     * @returns static action entry
+     */
+    template <typename Action, auto... PropertiesFactories>
+    static constexpr StaticAction MakeStaticAction(std::string_view key) {  //
+
+      return StaticAction{key, vrml_proc::core::utils::Hash(key),
+          [](const Argument& arg) -> std::shared_ptr<ConversionContextAction<ConversionContext>> {
+            return std::make_shared<Action>(PropertiesFactories(arg)...);
+          },
+          [](const Argument& arg) -> std::shared_ptr<ConversionContext> {
+            Action action(PropertiesFactories(arg)...);
+            return action.Execute();
+          }};
+    }
+
     /**
      * @brief Adds new action to the ActionMap mapped to a string key.
      * Duplicated key will be rewritten.
@@ -38,11 +98,96 @@ namespace vrml_proc::action {
      */
     void AddAction(const std::string& key, ActionFunctor action) {  //
 
-      vrml_proc::core::logger::LogDebug(
-          vrml_proc::core::utils::FormatString("Add new action with key <", key, ">."), LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Add new action with key <", key, ">.");
       m_actions[key] = std::move(action);
+      m_requestedFields.reset();
+
+      for (auto& entry : m_staticActions) {
+        if (entry.used && entry.action.key == key) {
+          entry.overridden = true;
+        }
+      }
     }
 
+    /**
+     * @brief Sets the table of static actions. Previously set static actions are replaced. Static actions whose key
+     * is already mapped to a runtime action are ignored.
+     *
+     * @param actions static actions
+     */
+    void SetStaticActions(std::span<const StaticAction> actions) {  //
+
+      VRMLPROC_LOG_DEBUG("Set ", actions.size(), " static actions.");
+
+      /** The table is kept at most half full, so the probing sequences stay short. */
+      size_t tableSize = 1;
+      while (tableSize < 2 * actions.size()) {
+        tableSize <<= 1;
+      }
+
+      m_staticActions.assign(tableSize, StaticActionEntry{});
+      for (const auto& action : actions) {
+        m_staticActions[FindSlot(action.id, action.key)] = {
+            action, m_actions.find(std::string(action.key)) != m_actions.end(), true};
+      }
+    }
+
+    /**
+     * @brief Finds static action by its key. Static action overridden by a runtime action is not returned.
+     *
+     * @param key key identifying the given Action
+     * @returns pointer to the static action entry or nullptr if there is no such static action
+     */
+    const StaticAction* FindStaticAction(std::string_view key) const {  //
+
+      return FindStaticAction(vrml_proc::core::utils::Hash(key), key);
+    }
+
+    /**
+     * @brief Finds static action by its key and the already computed hash of the key. Static action overridden by a
+     * runtime action is not returned.
+     *
+     * @param id hash of the key (canonical id of the node)
+     * @param key key identifying the given Action
+     * @returns pointer to the static action entry or nullptr if there is no such static action
+     */
+    const StaticAction* FindStaticAction(uint32_t id, std::string_view key) const {  //
+
+      if (m_staticActions.empty()) {
+        return nullptr;
+      }
+
+      const auto& entry = m_staticActions[FindSlot(id, key)];
+      if (!entry.used || entry.overridden) {
+        return nullptr;
+      }
+      return &entry.action;
+    }
+
+    /**
+     * @brief Sets fields which are read by the actions of this map. Each field is written as `Header.field`, where
+     * `Header` is a header of the node owning the field (fields of nodes read through another node, e.g.
+     * `Coordinate.point`, are listed under their own header). Parser may skip fields which are not listed.
+     *
+     * Adding a runtime action by `AddAction()` clears the set, because fields read by a runtime action are not known.
+     *
+     * @param fields fields read by the actions
+     */
+    void SetRequestedFields(std::span<const std::string_view> fields) {  //
+
+      m_requestedFields.emplace();
+      for (const auto& field : fields) {
+        m_requestedFields->emplace(field);
+      }
+    }
+
+    /**
+     * @brief Gets fields which are read by the actions of this map.
+     *
+     * @returns set of fields written as `Header.field`, or empty optional if the fields are not known
+     */
+    const std::optional<std::unordered_set<std::string>>& GetRequestedFields() const { return m_requestedFields; }
+
     /**
      * @brief Verifies if the given key exists in the ActionMap.
      *
@@ -51,11 +196,10 @@ namespace vrml_proc::action {
      */
     bool VerifyKey(const std::string& key) const {  //
 
-      bool result = (m_actions.find(key) != m_actions.end());
-      vrml_proc::core::logger::LogTrace(vrml_proc::core::utils::FormatString("Verify key <", key, ">."), LOGGING_INFO);
+      bool result = (m_actions.find(key) != m_actions.end()) || FindStaticAction(key) != nullptr;
+      VRMLPROC_LOG_TRACE("Verify key <", key, ">.");
       if (result) {
-        vrml_proc::core::logger::LogTrace(
-            vrml_proc::core::utils::FormatString("Key <", key, "> was not found!"), LOGGING_INFO);
+        VRMLPROC_LOG_TRACE("Key <", key, "> was not found!");
       }
       return result;
     }
@@ -72,14 +216,18 @@ namespace vrml_proc::action {
     std::shared_ptr<ConversionContextAction<ConversionContext>> GetAction(
         const std::string& key, Argument arg) const {  //
 
-      vrml_proc::core::logger::LogDebug(
-          vrml_proc::core::utils::FormatString("Retrieve action by key <", key, ">."), LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Retrieve action by key <", key, ">.");
 
       auto iterator = m_actions.find(key);
       if (iterator != m_actions.end()) {
         return iterator->second(arg);
       }
 
+      auto staticAction = FindStaticAction(key);
+      if (staticAction != nullptr) {
+        return staticAction->create(arg);
+      }
+
       vrml_proc::core::logger::LogWarning(
           vrml_proc::core::utils::FormatString("Action with key <", key, "> was not found!"), LOGGING_INFO);
 
@@ -87,6 +235,30 @@ namespace vrml_proc::action {
     }
 
    private:
+    struct StaticActionEntry {
+      StaticAction action{};
+      bool overridden = false;
+      bool used = false;
+    };
+
+    /**
+     * @brief Finds slot of the static action table which holds the action with the given key, or the empty slot where
+     * such action belongs. The table size is a power of two and the table always has an empty slot.
+     */
+    size_t FindSlot(uint32_t id, std::string_view key) const {  //
+
+      const size_t mask = m_staticActions.size() - 1;
+      size_t slot = id & mask;
+      /** Hashes of different keys may collide, so the key itself is compared as well. */
+      while (m_staticActions[slot].used &&
+             (m_staticActions[slot].action.id != id || m_staticActions[slot].action.key != key)) {
+        slot = (slot + 1) & mask;
+      }
+      return slot;
+    }
+
     std::unordered_map<std::string, ActionFunctor> m_actions;
+    std::vector<StaticActionEntry> m_staticActions;
+    std::optional<std::unordered_set<std::string>> m_requestedFields;
   };
 }  // namespace vrml_proc::action
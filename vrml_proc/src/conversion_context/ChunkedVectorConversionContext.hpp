@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "BaseConversionContext.hpp"
+
+namespace vrml_proc::conversion_context {
+  /**
+   * @brief Templated child of `BaseConversionContext`. It is a specialized ConversionContext with the same interface as
+   * `VectorConversionContext`, but its data are stored in a list of chunks (vectors).
+   *
+   * Merging splices the chunks of the other context into this one, so it takes constant time no matter how many data
+   * entities the other context holds and no data entity is moved. This matters when contexts are merged at every level
+   * of a deep hierarchy. Chunks are flattened into a single vector only when `GetData()` is called.
+   */
+  template <typename T>
+  class ChunkedVectorConversionContext : public BaseConversionContext {
+   public:
+    /**
+     * @brief Default constructor.
+     */
+    ChunkedVectorConversionContext() = default;
+    /**
+     * @brief Virtual default destructor.
+     */
+    virtual ~ChunkedVectorConversionContext() = default;
+    /**
+     * @brief Gets const reference to the vector of all data entities. Chunks are flattened into a single one first, so
+     * the call takes linear time if the context has more chunks. Prefer `ForEach()` when data only need to be read.
+     *
+     * @returns const reference to std::vector<T>
+     */
+    const std::vector<T>& GetData() {  //
+
+      if (m_chunks.empty()) {
+        m_chunks.emplace_back();
+      } else if (m_chunks.size() > 1) {
+        std::vector<T> data;
+        data.reserve(m_size);
+        for (auto& chunk : m_chunks) {
+          data.insert(data.end(), std::make_move_iterator(chunk.begin()), std::make_move_iterator(chunk.end()));
+        }
+        m_chunks.clear();
+        m_chunks.push_back(std::move(data));
+      }
+      return m_chunks.front();
+    }
+    /**
+     * @brief Calls `function` for every data entity, in the order in which they would be stored by `GetData()`.
+     *
+     * @param function function taking const reference to the data entity
+     */
+    template <typename Function>
+    void ForEach(Function&& function) const {  //
+
+      for (const auto& chunk : m_chunks) {
+        for (const auto& entity : chunk) {
+          function(entity);
+        }
+      }
+    }
+    /**
+     * @brief Adds new data entity.
+     *
+     * @param entity new data entity
+     */
+    inline void Add(T&& entity) {
+      LastChunk().push_back(std::move(entity));
+      m_size++;
+    }
+    /**
+     * @brief Adds new data entity by a copy.
+     *
+     * @param entity new data entity
+     */
+    inline void CopyAndAdd(T entity) { Add(std::move(entity)); }
+    /**
+     * @brief Checks if there is any data entity present.
+     *
+     * @returns true if there are no data entities present otherwise false
+     */
+    inline bool IsEmpty() const { return m_size == 0; }
+    /**
+     * @brief Gets number of data entities.
+     *
+     * @returns number of data entities
+     */
+    inline size_t GetSize() const { return m_size; }
+    /**
+     * @brief Overriden implemented interface method.
+     * The `Merge` method splices the chunks of the passed pointer to the end of the actual object in constant time.
+     * Passed pointer is left empty.
+     *
+     * @param other pointer to another `Mergeable` object, must be of type ChunkedVectorConversionContext; if other is
+     * nullptr, nothing will be merged
+     *
+     * @throws std::invalid_argument if the objects cannot be merged due to incompatibility.
+     */
+    void Merge(Mergeable* other) override {
+      if (other == nullptr) {
+        return;
+      }
+      auto* otherContext = dynamic_cast<ChunkedVectorConversionContext<T>*>(other);
+      if (otherContext == nullptr) {
+        throw std::invalid_argument("Merge called with incompatible type!");
+      }
+      if (otherContext->IsEmpty()) {
+        return;
+      }
+      m_chunks.splice(m_chunks.end(), otherContext->m_chunks);
+      m_size += otherContext->m_size;
+      otherContext->m_size = 0;
+    }
+
+   private:
+    std::vector<T>& LastChunk() {  //
+
+      if (m_chunks.empty()) {
+        m_chunks.emplace_back();
+      }
+      return m_chunks.back();
+    }
+
+    std::list<std::vector<T>> m_chunks;
+    size_t m_size = 0;
+
+    ChunkedVectorConversionContext(const ChunkedVectorConversionContext&) = delete;
+    ChunkedVectorConversionContext& operator=(const ChunkedVectorConversionContext&) = delete;
+    ChunkedVectorConversionContext(ChunkedVectorConversionContext&&) = delete;
+    ChunkedVectorConversionContext& operator=(ChunkedVectorConversionContext&&) = delete;
+  };
+}  // namespace vrml_proc::conversion_context
@@ -2,6 +2,8 @@
 
 #include <filesystem>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <result.hpp>
 
@@ -11,16 +13,33 @@
 #include "Error.hpp"
 #include "JsonError.hpp"
 #include "JsonFileReader.hpp"
+#include "Logger.hpp"
 
 namespace vrml_proc::core::config {
+  /**
+   * @brief Represents settings of field projection.
+   *
+   * When field projection is active, numeric array fields which are not read by any registered action are not parsed
+   * (their text is only kept), so that the parser does not spend time on data nobody uses. Fields listed in
+   * `skippedFields` (written as `Header.field`) are skipped as well.
+   */
+  struct FieldProjectionSettings {
+    bool active = false;
+    std::vector<std::string> skippedFields;
+  };
+
   /**
    * @brief Represents a configuration file for `vrmlproc` library.
    *
    * Configuration file for `vrmlproc` has following properties:
    *  - ignoreUnknownNode (bool),
+   *  - schemaAwareParsing (bool),
+   *  - fieldProjection (object),
+   *  - prunedNodes (array of strings),
    *  - logFileDirectory (string),
    *  - logFileName (string),
-   *  - synonymsFile (string).
+   *  - synonymsFile (string),
+   *  - loggingSettings (object).
    *
    * @implements `Config` class with Load() method.
    */
@@ -52,10 +71,15 @@ namespace vrml_proc::core::config {
           synonymsFile(synonymsFile){};
 
     bool ignoreUnknownNode = false;
+    bool schemaAwareParsing = true;
     std::string logFileDirectory = std::filesystem::current_path().string();
     std::string logFileName = "vrmlproc";
     std::string synonymsFile =
         (std::filesystem::current_path() / std::filesystem::path("vrmlprocSynonyms.json")).string();
+    FieldProjectionSettings fieldProjectionSettings;
+    /** @brief Canonical headers of nodes whose bodies are not parsed. Their synonyms are pruned as well. */
+    std::vector<std::string> prunedNodes;
+    vrml_proc::core::logger::LoggingSettings loggingSettings;
 
     /**
      * @brief Loads configuration file from JSON file.
@@ -80,9 +104,21 @@ namespace vrml_proc::core::config {
     cpp::result<void, std::shared_ptr<vrml_proc::core::error::Error>> LoadJson(const nlohmann::json& json) {
       try {
         ignoreUnknownNode = json.value("ignoreUnknownNode", false);
+        schemaAwareParsing = json.value("schemaAwareParsing", true);
         logFileDirectory = json.value("logFileDirectory", std::filesystem::current_path().string());
         logFileName = json.value("logFileName", "vrmlproc");
         synonymsFile = json.value("synonymsFile", std::filesystem::current_path().string());
+        if (json.contains("fieldProjection") && json["fieldProjection"].is_object()) {
+          const auto& projection = json["fieldProjection"];
+          fieldProjectionSettings.active = projection.value("active", false);
+          fieldProjectionSettings.skippedFields = projection.value("skippedFields", std::vector<std::string>());
+        }
+        prunedNodes = json.value("prunedNodes", std::vector<std::string>());
+        if (json.contains("loggingSettings") && json["loggingSettings"].is_object()) {
+          const auto& logging = json["loggingSettings"];
+          loggingSettings.asynchronous = logging.value("asynchronous", false);
+          loggingSettings.flushIntervalMilliseconds = logging.value("flushIntervalMilliseconds", 1000u);
+        }
       } catch (const nlohmann::json::exception& e) {
         return cpp::fail(std::make_shared<vrml_proc::core::io::error::JsonError>(e.what()));
       }
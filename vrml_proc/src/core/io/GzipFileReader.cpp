@@ -0,0 +1,334 @@
+#include "GzipFileReader.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <taskflow/algorithm/for_each.hpp>
+#include <taskflow/taskflow.hpp>
+#include <zlib.h>
+
+#include "Error.hpp"
+#include "FileReader.hpp"
+#include "FormatString.hpp"
+#include "IoError.hpp"
+#include "Logger.hpp"
+#include "ManualTimer.hpp"
+#include "MemoryMappedFileReader.hpp"
+
+namespace {
+  /**
+   * @brief Size of gzip header without optional fields.
+   */
+  constexpr size_t GzipHeaderSize = 10;
+
+  /**
+   * @brief Size of gzip trailer (CRC32 and ISIZE).
+   */
+  constexpr size_t GzipTrailerSize = 8;
+
+  /**
+   * @brief Maximal size of decompressed data of one BGZF member.
+   */
+  constexpr size_t BgzfMaxBlockSize = 65536;
+
+  /**
+   * @brief Maximal ratio of decompressed and compressed size of deflate stream. Bigger ISIZE field is not trusted.
+   */
+  constexpr size_t MaxCompressionRatio = 1032;
+
+  /**
+   * @brief Maximal size of output reserved in advance according to the ISIZE field.
+   */
+  constexpr size_t MaxReservedSize = size_t(1) << 30;
+
+  /**
+   * @brief Size by which the output grows during sequential inflation.
+   */
+  constexpr size_t OutputChunkSize = size_t(1) << 20;
+
+  /**
+   * @brief Represents one gzip member with known position in compressed and decompressed data.
+   */
+  struct GzipMember {
+    size_t compressedOffset;
+    size_t compressedSize;
+    size_t decompressedOffset;
+    size_t decompressedSize;
+  };
+
+  inline uint32_t ReadLittleEndian32(const unsigned char* data) {
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+           (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+  }
+
+  inline uint16_t ReadLittleEndian16(const unsigned char* data) {
+    return static_cast<uint16_t>(data[0] | (data[1] << 8));
+  }
+
+  inline bool HasGzipMagic(const unsigned char* data, size_t size) {
+    return size >= 3 && data[0] == 0x1f && data[1] == 0x8b && data[2] == 0x08;
+  }
+
+  /**
+   * @brief Reads the total member size from the `BC` extra subfield of a BGZF member.
+   *
+   * @param data pointer to the start of the member
+   * @param available number of bytes available from `data`
+   * @returns total size of the member in bytes, or 0 if the member is not a BGZF member
+   */
+  size_t ReadBgzfMemberSize(const unsigned char* data, size_t available) {
+    if (available < GzipHeaderSize + 2 || !HasGzipMagic(data, available) || (data[3] & 0x04) == 0) {
+      return 0;
+    }
+
+    size_t extraLength = ReadLittleEndian16(data + GzipHeaderSize);
+    size_t position = GzipHeaderSize + 2;
+    size_t extraEnd = position + extraLength;
+    if (extraEnd > available) {
+      return 0;
+    }
+
+    while (position + 4 <= extraEnd) {
+      size_t subfieldLength = ReadLittleEndian16(data + position + 2);
+      if (data[position] == 'B' && data[position + 1] == 'C' && subfieldLength == 2 && position + 6 <= extraEnd) {
+        return static_cast<size_t>(ReadLittleEndian16(data + position + 4)) + 1;
+      }
+      position += 4 + subfieldLength;
+    }
+
+    return 0;
+  }
+
+  /**
+   * @brief Tries to split the compressed data into BGZF members.
+   *
+   * @param data compressed data
+   * @param size size of compressed data
+   * @param members output list of members
+   * @returns true if the whole stream consists of BGZF members, otherwise false
+   */
+  bool SplitIntoBgzfMembers(const unsigned char* data, size_t size, std::vector<GzipMember>& members) {
+    size_t compressedOffset = 0;
+    size_t decompressedOffset = 0;
+    while (compressedOffset < size) {
+      size_t memberSize = ReadBgzfMemberSize(data + compressedOffset, size - compressedOffset);
+      if (memberSize < GzipHeaderSize + GzipTrailerSize || compressedOffset + memberSize > size) {
+        members.clear();
+        return false;
+      }
+
+      size_t decompressedSize = ReadLittleEndian32(data + compressedOffset + memberSize - 4);
+      if (decompressedSize > BgzfMaxBlockSize) {
+        members.clear();
+        return false;
+      }
+      members.push_back({compressedOffset, memberSize, decompressedOffset, decompressedSize});
+      compressedOffset += memberSize;
+      decompressedOffset += decompressedSize;
+    }
+
+    return !members.empty();
+  }
+
+  /**
+   * @brief Inflates one gzip member into preallocated output.
+   *
+   * @returns empty string on success, otherwise description of the error
+   */
+  std::string InflateMember(const unsigned char* input, size_t inputSize, char* output, size_t outputSize) {
+    z_stream stream{};
+    if (inflateInit2(&stream, 16 + MAX_WBITS) != Z_OK) {
+      return "zlib could not be initialized";
+    }
+
+    stream.next_in = const_cast<Bytef*>(input);
+    stream.avail_in = static_cast<uInt>(inputSize);
+    /** Empty member (e.g. BGZF end-of-file marker) still needs a valid output pointer. */
+    char empty = 0;
+    stream.next_out = reinterpret_cast<Bytef*>(outputSize > 0 ? output : &empty);
+    stream.avail_out = static_cast<uInt>(outputSize);
+
+    int status = inflate(&stream, Z_FINISH);
+    std::string error;
+    if (status != Z_STREAM_END) {
+      error = stream.msg != nullptr ? stream.msg : "member is truncated";
+    } else if (stream.total_out != outputSize) {
+      error = "decompressed size of member does not match its ISIZE field";
+    }
+
+    inflateEnd(&stream);
+    return error;
+  }
+
+  /**
+   * @brief Inflates gzip stream (possibly consisting of several members) sequentially.
+   *
+   * @returns empty string on success, otherwise description of the error
+   */
+  std::string InflateSequentially(const unsigned char* input, size_t inputSize, std::vector<char>& output) {
+    z_stream stream{};
+    if (inflateInit2(&stream, 16 + MAX_WBITS) != Z_OK) {
+      return "zlib could not be initialized";
+    }
+
+    /**
+     * The last four bytes hold the size of the last member modulo 2^32. For the usual single-member file it is the
+     * exact size of the output, otherwise it is only a lower bound. It comes from the file, so it is only used to
+     * reserve the output, up to a limit. The output grows by chunks as the data are inflated, so no more than one
+     * chunk is zero-filled in advance.
+     */
+    size_t expectedSize = inputSize >= 4 ? ReadLittleEndian32(input + inputSize - 4) : 0;
+    output.clear();
+    output.reserve(std::min({expectedSize, inputSize * MaxCompressionRatio, MaxReservedSize}) + 1);
+
+    /** zlib counts bytes in 32-bit integers, so very large buffers are passed in chunks. */
+    constexpr size_t maxChunkSize = std::numeric_limits<uInt>::max();
+
+    stream.next_in = const_cast<Bytef*>(input);
+    stream.avail_in = 0;
+
+    size_t written = 0;
+    std::string error;
+    while (true) {
+      if (written == output.size()) {
+        /** The last chunk ends at the reserved capacity, so that the buffer is not reallocated just before the end. */
+        size_t size = output.size() + OutputChunkSize;
+        if (output.size() < output.capacity()) {
+          size = std::min(size, output.capacity());
+        }
+        output.resize(size);
+      }
+
+      if (stream.avail_in == 0) {
+        size_t consumed = static_cast<size_t>(stream.next_in - input);
+        stream.avail_in = static_cast<uInt>(std::min(inputSize - consumed, maxChunkSize));
+      }
+
+      stream.next_out = reinterpret_cast<Bytef*>(output.data() + written);
+      stream.avail_out = static_cast<uInt>(std::min(output.size() - written, maxChunkSize));
+      size_t availableBefore = stream.avail_out;
+
+      int status = inflate(&stream, Z_NO_FLUSH);
+      written += availableBefore - stream.avail_out;
+
+      if (status == Z_STREAM_END) {
+        /** Next gzip member may follow. Trailing bytes which are not a member are ignored as gzip does. */
+        size_t consumed = static_cast<size_t>(stream.next_in - input);
+        if (!HasGzipMagic(stream.next_in, inputSize - consumed)) {
+          break;
+        }
+        inflateReset(&stream);
+        continue;
+      }
+
+      if (status == Z_BUF_ERROR && stream.avail_in == 0 && static_cast<size_t>(stream.next_in - input) == inputSize) {
+        error = "stream is truncated";
+        break;
+      }
+
+      if (status != Z_OK && status != Z_BUF_ERROR) {
+        error = stream.msg != nullptr ? stream.msg : "stream is corrupted";
+        break;
+      }
+    }
+
+    inflateEnd(&stream);
+    output.resize(written);
+    return error;
+  }
+}  // namespace
+
+bool vrml_proc::core::io::GzipFileReader::IsGzipFile(const std::filesystem::path& filepath) {
+  std::ifstream file(filepath, std::ios::binary);
+  unsigned char magic[3] = {0, 0, 0};
+  if (!file.read(reinterpret_cast<char*>(magic), sizeof(magic))) {
+    return false;
+  }
+  return HasGzipMagic(magic, sizeof(magic));
+}
+
+vrml_proc::core::io::FileReader<vrml_proc::core::io::DecompressedFile>::LoadFileResult
+vrml_proc::core::io::GzipFileReader::Read(const std::filesystem::path& filepath) {  //
+
+  using namespace vrml_proc::core::error;
+  using namespace vrml_proc::core::io::error;
+  using namespace vrml_proc::core::logger;
+  using namespace vrml_proc::core::utils;
+
+  LogInfo(FormatString("Read gzip-compressed file <", filepath.string(), ">."), LOGGING_INFO);
+
+  std::shared_ptr<Error> error = std::make_shared<IoError>();
+
+  if (!std::filesystem::exists(filepath)) {
+    LogError(FormatString("File <", filepath.string(), "> does not exits and thus cannot be read!"), LOGGING_INFO);
+    return cpp::fail(error << (std::make_shared<FileNotFoundError>(filepath.string())));
+  }
+
+  vrml_proc::core::utils::ManualTimer timer;
+  timer.Start();
+
+  vrml_proc::core::io::MemoryMappedFile compressed(filepath.string());
+  const auto* input = reinterpret_cast<const unsigned char*>(compressed.GetBegin());
+  size_t inputSize = compressed.GetSize();
+
+  if (!HasGzipMagic(input, inputSize)) {
+    return cpp::fail(error << (std::make_shared<DecompressionError>(filepath.string(), "file is not gzip-compressed")));
+  }
+
+  std::vector<char> output;
+  std::vector<GzipMember> members;
+
+  if (m_threads > 1 && SplitIntoBgzfMembers(input, inputSize, members) && members.size() > 1) {
+    VRMLPROC_LOG_DEBUG("File consists of ", members.size(), " BGZF members, they will be inflated on ", m_threads,
+        " threads.");
+
+    output.resize(members.back().decompressedOffset + members.back().decompressedSize);
+
+    std::atomic<bool> failed = false;
+    std::string failure;
+    std::mutex failureMutex;
+
+    tf::Executor executor(m_threads);
+    tf::Taskflow taskflow;
+    taskflow.for_each_index(size_t(0), members.size(), size_t(1), [&](size_t i) {
+      if (failed) {
+        return;
+      }
+      const auto& member = members[i];
+      auto memberError = InflateMember(input + member.compressedOffset, member.compressedSize,
+          output.data() + member.decompressedOffset, member.decompressedSize);
+      if (!memberError.empty()) {
+        std::scoped_lock lock(failureMutex);
+        failed = true;
+        failure = FormatString(i + 1, ". member: ", memberError);
+      }
+    });
+    executor.run(taskflow).wait();
+
+    if (failed) {
+      LogError(FormatString("Decompression of file <", filepath.string(), "> failed: ", failure, "."), LOGGING_INFO);
+      return cpp::fail(error << (std::make_shared<DecompressionError>(filepath.string(), failure)));
+    }
+  } else {
+    auto inflateError = InflateSequentially(input, inputSize, output);
+    if (!inflateError.empty()) {
+      LogError(
+          FormatString("Decompression of file <", filepath.string(), "> failed: ", inflateError, "."), LOGGING_INFO);
+      return cpp::fail(error << (std::make_shared<DecompressionError>(filepath.string(), inflateError)));
+    }
+  }
+
+  double time = timer.End();
+  LogInfo(FormatString("Time to read and decompress file <", filepath.string(), "> of size ", inputSize,
+              " bytes into ", output.size(), " bytes took ", time, " seconds."),
+      LOGGING_INFO);
+
+  return vrml_proc::core::io::DecompressedFile(std::move(output));
+}
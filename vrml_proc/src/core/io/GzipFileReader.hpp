@@ -0,0 +1,88 @@
+#pragma once
+
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+#include "FileReader.hpp"
+
+#include "VrmlProcExport.hpp"
+
+namespace vrml_proc::core::io {
+
+  /**
+   * @brief Represents a decompressed file held in one contiguous memory buffer.
+   *
+   * It provides the same pointer interface as `MemoryMappedFile`, so it can be directly viewed by `BufferView`.
+   */
+  struct DecompressedFile {
+    /**
+     * @brief Constructs a new decompressed file taking ownership of the data.
+     *
+     * @param data decompressed content of the file
+     */
+    explicit DecompressedFile(std::vector<char>&& data) : m_data(std::move(data)) {}
+
+    /**
+     * @brief Retrieve a pointer to the start of file's content.
+     *
+     * @returns begin pointer
+     */
+    const char* GetBegin() const { return m_data.data(); }
+
+    /**
+     * @brief Retrieve a pointer to the end of file's content.
+     *
+     * @returns end pointer
+     */
+    const char* GetEnd() const { return m_data.data() + m_data.size(); }
+
+    /**
+     * @brief Gets a total size of the decompressed content in bytes.
+     *
+     * @returns size of content in bytes
+     */
+    size_t GetSize() const { return m_data.size(); }
+
+   private:
+    std::vector<char> m_data;
+  };
+
+  /**
+   * @brief File reader for gzip-compressed files (e.g. `.wrl.gz` or `.wrz`).
+   *
+   * The file is memory mapped and inflated directly with zlib into one contiguous buffer. Single-member and
+   * multi-member gzip streams are inflated sequentially. If the stream consists of BGZF blocks (gzip members carrying
+   * their compressed size in the `BC` extra subfield), the member boundaries are known without inflating and all
+   * members are inflated in parallel directly into their final place in the output buffer.
+   */
+  class VRMLPROC_API GzipFileReader : public FileReader<DecompressedFile> {
+   public:
+    /**
+     * @brief Constructs new reader.
+     *
+     * @param threads maximal number of threads used for parallel decompression
+     */
+    explicit GzipFileReader(unsigned int threads = std::thread::hardware_concurrency())
+        : m_threads(threads == 0 ? 1 : threads) {}
+
+    /**
+     * @brief Reads and decompresses a gzip file at the specified path.
+     *
+     * @param filepath path to the gzip file
+     * @return result containing the decompressed file or an error on failure
+     */
+    LoadFileResult Read(const std::filesystem::path& filepath) override;
+
+    /**
+     * @brief Checks if the file starts with gzip magic bytes.
+     *
+     * @param filepath path to the file
+     * @returns true if the file exists and is gzip-compressed, otherwise false
+     */
+    static bool IsGzipFile(const std::filesystem::path& filepath);
+
+   private:
+    unsigned int m_threads;
+  };
+}  // namespace vrml_proc::core::io
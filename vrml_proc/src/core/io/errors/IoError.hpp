@@ -119,4 +119,25 @@ namespace vrml_proc::core::io::error {
     std::string m_filepath;
     std::string m_details;
   };
+
+  /**
+   * @brief Represents a conrete IO error meaning that compressed file could not be decompressed.
+   */
+  class DecompressionError : public IoError {
+   public:
+    DecompressionError(const std::string& filepath, const std::string& details)
+        : m_filepath(filepath), m_details(details) {}
+
+   protected:
+    std::string GetMessageInternal() const override {
+      std::ostringstream oss;
+      oss << "[DecompressionError]: file <" << m_filepath << "> could not be decompressed! Details: <" << m_details
+          << ">.\n";
+      return oss.str();
+    }
+
+   private:
+    std::string m_filepath;
+    std::string m_details;
+  };
 }  // namespace vrml_proc::core::io::error
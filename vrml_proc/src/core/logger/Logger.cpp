@@ -1,13 +1,20 @@
 #include "Logger.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
 #include <ios>
+#include <mutex>
 #include <sstream>
+#include <thread>
 #include <vector>
 #include <string>
 
 #include <boost/date_time/posix_time/ptime.hpp>
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/operations.hpp>
+#include <boost/log/core.hpp>
 #include <boost/log/expressions.hpp>
 #include <boost/log/expressions/attr.hpp>
 #include <boost/log/expressions/formatters/date_time.hpp>
@@ -18,13 +25,16 @@
 #include <boost/log/keywords/format.hpp>
 #include <boost/log/keywords/open_mode.hpp>
 #include <boost/log/keywords/time_based_rotation.hpp>
+#include <boost/log/sinks/async_frontend.hpp>
 #include <boost/log/sinks/text_file_backend.hpp>
+#include <boost/log/sinks/unbounded_fifo_queue.hpp>
 #include <boost/log/sources/global_logger_storage.hpp>
 #include <boost/log/sources/severity_logger.hpp>
 #include <boost/log/support/date_time.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/log/utility/setup/common_attributes.hpp>
 #include <boost/log/utility/setup/file.hpp>
+#include <boost/make_shared.hpp>
 
 #include "FormatString.hpp"
 
@@ -66,6 +76,11 @@ static std::vector<BufferedMessage> g_logBuffer;
  */
 static bool g_loggingInitialized = false;
 
+/**
+ * @brief Global variable holding the lowest logging level which passes the active filter.
+ */
+static std::atomic<vrml_proc::core::logger::Level> g_minimalLevel = vrml_proc::core::logger::Level::Trace;
+
 /**
  * @brief Initializes the global logger instance.
  *
@@ -83,62 +98,184 @@ BOOST_LOG_GLOBAL_LOGGER_INIT(Logger, boost::log::sources::severity_logger_mt<boo
   return boost::log::sources::severity_logger_mt<boost::log::trivial::severity_level>();
 }
 
+/**
+ * @brief Asynchronous file sink. Logging threads only push records into the lock-free queue, they are formatted and
+ * written by the dedicated feeding thread of the sink.
+ */
+using AsynchronousFileSink = sinks::asynchronous_sink<sinks::text_file_backend, sinks::unbounded_fifo_queue>;
+
+/**
+ * @brief Global file sink (synchronous or asynchronous), it is null if the logging is not initialized.
+ */
+static boost::shared_ptr<sinks::sink> g_fileSink;
+
+/**
+ * @brief Global asynchronous sink, it is null if the logging is synchronous or not initialized.
+ */
+static boost::shared_ptr<AsynchronousFileSink> g_asynchronousSink;
+
+/**
+ * @brief Global variable indicating if `ShutdownLogging()` was already registered to be called at exit.
+ */
+static bool g_shutdownRegistered = false;
+
+/**
+ * @brief Global state of the thread periodically flushing the asynchronous sink.
+ */
+static std::thread g_flushThread;
+static std::mutex g_flushMutex;
+static std::condition_variable g_flushCondition;
+static bool g_flushThreadStopRequested = false;
+
 // Forward declaration.
 void LogBufferedMessages();
 
-void vrml_proc::core::logger::InitLogging() {
-  g_loggingInitialized = true;
+/**
+ * @brief Creates formatter shared by all file sinks.
+ *
+ * @returns formatter
+ */
+static logging::formatter CreateFormatter() {
+  return expr::stream << "["
+                      << expr::format_date_time<boost::posix_time::ptime>(
+                             expr::attr<boost::posix_time::ptime>("TimeStamp"), "%Y-%m-%d %H:%M:%S")
+                      << "]"
+                      << " [" << expr::attr<boost::log::trivial::severity_level>("Severity") << "] " << expr::smessage;
+}
 
-  logging::add_file_log(keywords::file_name = "vrmlproc_%Y-%m-%d.log", keywords::open_mode = std::ios_base::app,
-      keywords::time_based_rotation = sinks::file::rotation_at_time_point(0, 0, 0), keywords::auto_flush = true,
-      keywords::format = expr::stream << "["
-                                      << expr::format_date_time<boost::posix_time::ptime>(
-                                             expr::attr<boost::posix_time::ptime>("TimeStamp"), "%Y-%m-%d %H:%M:%S")
-                                      << "]"
-                                      << " [" << expr::attr<boost::log::trivial::severity_level>("Severity") << "] "
-                                      << expr::smessage);
+/**
+ * @brief Removes the file sink from the logging core. Asynchronous sink is stopped after all its queued messages are
+ * written.
+ */
+static void RemoveFileSink() {
+  if (g_fileSink) {
+    logging::core::get()->remove_sink(g_fileSink);
+    g_fileSink.reset();
+  }
+  if (g_asynchronousSink) {
+    g_asynchronousSink->stop();
+    g_asynchronousSink->flush();
+    g_asynchronousSink.reset();
+  }
+}
+
+/**
+ * @brief Adds synchronous or asynchronous file sink into the logging core and sets the filter. If the logging was
+ * already initialized, the previous file sink is replaced, so repeated initialization does not duplicate messages.
+ *
+ * @param fileName pattern of the log file name
+ * @param settings settings of the sink
+ */
+static void AddFileSink(const std::string& fileName, const vrml_proc::core::logger::LoggingSettings& settings) {
+  g_loggingInitialized = true;
+  RemoveFileSink();
+  /** Logging may have been shut down before, see `ShutdownLogging()`. */
+  logging::core::get()->set_logging_enabled(true);
+
+  if (settings.asynchronous) {
+    auto backend = boost::make_shared<sinks::text_file_backend>(keywords::file_name = fileName,
+        keywords::open_mode = std::ios_base::app,
+        keywords::time_based_rotation = sinks::file::rotation_at_time_point(0, 0, 0), keywords::auto_flush = false);
+
+    g_asynchronousSink = boost::make_shared<AsynchronousFileSink>(backend);
+    g_asynchronousSink->set_formatter(CreateFormatter());
+    g_fileSink = g_asynchronousSink;
+    logging::core::get()->add_sink(g_fileSink);
+
+    if (settings.flushIntervalMilliseconds > 0 && !g_flushThread.joinable()) {
+      auto interval = std::chrono::milliseconds(settings.flushIntervalMilliseconds);
+      {
+        std::lock_guard<std::mutex> lock(g_flushMutex);
+        g_flushThreadStopRequested = false;
+      }
+      g_flushThread = std::thread([interval]() {
+        std::unique_lock<std::mutex> lock(g_flushMutex);
+        while (!g_flushCondition.wait_for(lock, interval, []() { return g_flushThreadStopRequested; })) {
+          lock.unlock();
+          logging::core::get()->flush();
+          lock.lock();
+        }
+      });
+    }
+
+    if (!g_shutdownRegistered) {
+      std::atexit(vrml_proc::core::logger::ShutdownLogging);
+      g_shutdownRegistered = true;
+    }
+  } else {
+    g_fileSink = logging::add_file_log(keywords::file_name = fileName, keywords::open_mode = std::ios_base::app,
+        keywords::time_based_rotation = sinks::file::rotation_at_time_point(0, 0, 0), keywords::auto_flush = true,
+        keywords::format = CreateFormatter());
+  }
 
   logging::add_common_attributes();
 
 #ifdef RELEASE
   logging::core::get()->set_filter(logging::trivial::severity >= logging::trivial::info);
+  g_minimalLevel = vrml_proc::core::logger::Level::Info;
 #endif
 
 #ifdef DEBUG
   logging::core::get()->set_filter(logging::trivial::severity >= logging::trivial::trace);
+  g_minimalLevel = vrml_proc::core::logger::Level::Trace;
 #endif
 
   LogBufferedMessages();
 }
 
+/**
+ * @brief Flushes the asynchronous sink after an error or fatal message, so that it is not lost if the application
+ * terminates abruptly. Synchronous sink is flushed after each message anyway.
+ *
+ * @param level level of the message just logged
+ */
+static void FlushOnError(vrml_proc::core::logger::Level level) {
+  if (g_asynchronousSink && level >= vrml_proc::core::logger::Level::Error) {
+    vrml_proc::core::logger::FlushLogging();
+  }
+}
+
+void vrml_proc::core::logger::InitLogging() { AddFileSink("vrmlproc_%Y-%m-%d.log", LoggingSettings()); }
+
 void vrml_proc::core::logger::InitLogging(const std::string& loggingDirectory, const std::string& projectName) {
-  g_loggingInitialized = true;
+  InitLogging(loggingDirectory, projectName, LoggingSettings());
+}
+
+void vrml_proc::core::logger::InitLogging(
+    const std::string& loggingDirectory, const std::string& projectName, const LoggingSettings& settings) {  //
 
   if (!boost::filesystem::exists(loggingDirectory)) {
     boost::filesystem::create_directories(loggingDirectory);
   }
 
-  logging::add_file_log(keywords::file_name = loggingDirectory + "/" + projectName + "_%Y-%m-%d.log",
-      keywords::open_mode = std::ios_base::app,
-      keywords::time_based_rotation = sinks::file::rotation_at_time_point(0, 0, 0), keywords::auto_flush = true,
-      keywords::format = expr::stream << "["
-                                      << expr::format_date_time<boost::posix_time::ptime>(
-                                             expr::attr<boost::posix_time::ptime>("TimeStamp"), "%Y-%m-%d %H:%M:%S")
-                                      << "]"
-                                      << " [" << expr::attr<boost::log::trivial::severity_level>("Severity") << "] "
-                                      << expr::smessage);
+  AddFileSink(loggingDirectory + "/" + projectName + "_%Y-%m-%d.log", settings);
+}
 
-  logging::add_common_attributes();
+void vrml_proc::core::logger::FlushLogging() {
+  if (g_loggingInitialized) {
+    logging::core::get()->flush();
+  }
+}
 
-#ifdef RELEASE
-  logging::core::get()->set_filter(logging::trivial::severity >= logging::trivial::info);
-#endif
+void vrml_proc::core::logger::ShutdownLogging() {
+  if (g_flushThread.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(g_flushMutex);
+      g_flushThreadStopRequested = true;
+    }
+    g_flushCondition.notify_one();
+    g_flushThread.join();
+  }
 
-#ifdef DEBUG
-  logging::core::get()->set_filter(logging::trivial::severity >= logging::trivial::trace);
-#endif
+  if (g_asynchronousSink) {
+    // Without any sink, Boost.Log would print the messages into the console.
+    logging::core::get()->set_logging_enabled(false);
+    RemoveFileSink();
+  }
+}
 
-  LogBufferedMessages();
+bool vrml_proc::core::logger::IsLevelEnabled(vrml_proc::core::logger::Level level) {
+  return level >= g_minimalLevel.load(std::memory_order_relaxed);
 }
 
 void vrml_proc::core::logger::LogUnformattedText(const std::string& title,
@@ -180,6 +317,8 @@ void vrml_proc::core::logger::LogUnformattedText(const std::string& title,
     default:
       break;
   }
+
+  FlushOnError(level);
 }
 
 void vrml_proc::core::logger::Log(
@@ -218,6 +357,8 @@ void vrml_proc::core::logger::Log(
     default:
       break;
   }
+
+  FlushOnError(level);
 }
 
 void vrml_proc::core::logger::LogTrace(
@@ -7,6 +7,8 @@
 #include <boost/log/utility/setup/common_attributes.hpp>
 #include <boost/log/utility/setup/file.hpp>
 
+#include "FormatString.hpp"
+
 #include "VrmlProcExport.hpp"
 
 /**
@@ -14,6 +16,39 @@
  */
 #define LOGGING_INFO __FILE__, __LINE__, __FUNCTION__
 
+/**
+ * @brief Lowest logging level (as an index into `vrml_proc::core::logger::Level`) which is compiled in. It is set by
+ * CMake variable `LOGGING_LEVEL_FLOOR`.
+ */
+#ifndef VRMLPROC_LOGGING_LEVEL_FLOOR
+#define VRMLPROC_LOGGING_LEVEL_FLOOR 0
+#endif
+
+/**
+ * @brief Logs a message built from `...` (arguments of `FormatString()`) lazily. The message is formatted only if
+ * `level` is not below the compile-time floor and passes the active filter, otherwise the call costs one comparison
+ * (or nothing at all if it is compiled out).
+ *
+ * Example usage:
+ * @code
+ * VRMLPROC_LOG_DEBUG("Visit node <", node.header, ">.");
+ * @endcode
+ */
+#define VRMLPROC_LOG(level, ...)                                                                              \
+  do {                                                                                                        \
+    if constexpr (static_cast<int>(level) >= VRMLPROC_LOGGING_LEVEL_FLOOR) {                                  \
+      if (vrml_proc::core::logger::IsLevelEnabled(level)) {                                                   \
+        vrml_proc::core::logger::Log(vrml_proc::core::utils::FormatString(__VA_ARGS__), level, LOGGING_INFO); \
+      }                                                                                                       \
+    }                                                                                                         \
+  } while (false)
+
+#define VRMLPROC_LOG_TRACE(...) VRMLPROC_LOG(vrml_proc::core::logger::Level::Trace, __VA_ARGS__)
+#define VRMLPROC_LOG_DEBUG(...) VRMLPROC_LOG(vrml_proc::core::logger::Level::Debug, __VA_ARGS__)
+#define VRMLPROC_LOG_INFO(...) VRMLPROC_LOG(vrml_proc::core::logger::Level::Info, __VA_ARGS__)
+#define VRMLPROC_LOG_WARNING(...) VRMLPROC_LOG(vrml_proc::core::logger::Level::Warning, __VA_ARGS__)
+#define VRMLPROC_LOG_ERROR(...) VRMLPROC_LOG(vrml_proc::core::logger::Level::Error, __VA_ARGS__)
+
 /**
  * @brief Global logger instance for the application.
  *
@@ -35,6 +70,19 @@ namespace vrml_proc::core::logger {
    */
   enum class Level { Trace, Debug, Info, Warning, Error, Fatal };
 
+  /**
+   * @brief Represents settings of the log file sink.
+   *
+   * In synchronous mode, each message is written and flushed into the file by the thread which logs it. In asynchronous
+   * mode, messages are pushed into a lock-free queue and written by a background thread. The file is flushed
+   * periodically, on each error or fatal message and when the logging is shut down.
+   */
+  struct LoggingSettings {
+    bool asynchronous = false;
+    /** @brief Interval of periodic flushes in asynchronous mode. Zero disables periodic flushing. */
+    unsigned int flushIntervalMilliseconds = 1000;
+  };
+
   /**
    * @brief Initializes logging with default configuration.
    *
@@ -56,6 +104,40 @@ namespace vrml_proc::core::logger {
    */
   VRMLPROC_API void InitLogging(const std::string& loggingDirectory, const std::string& projectName);
 
+  /**
+   * @brief Initializes logging with custom directory, project name and sink settings.
+   *
+   * @param loggingDirectory directory where log files will be written
+   * @param projectName name of the project, used as a prefix for log files
+   * @param settings settings of the log file sink
+   *
+   * @note In asynchronous mode, `ShutdownLogging()` is registered to be called at exit. Calling any `InitLogging()`
+   * again replaces the previous log file sink.
+   */
+  VRMLPROC_API void InitLogging(
+      const std::string& loggingDirectory, const std::string& projectName, const LoggingSettings& settings);
+
+  /**
+   * @brief Writes all queued messages into the log file and flushes it. The function blocks until all messages logged
+   * before the call are written.
+   */
+  VRMLPROC_API void FlushLogging();
+
+  /**
+   * @brief Flushes all queued messages and stops the background threads of the asynchronous sink. Messages logged after
+   * the call are dropped. Calling it more than once or in synchronous mode is harmless.
+   */
+  VRMLPROC_API void ShutdownLogging();
+
+  /**
+   * @brief Checks if messages of the given level are currently logged. Before logging is initialized, all levels are
+   * enabled (messages are buffered), after that it follows the filter set by `InitLogging()`.
+   *
+   * @param level logging level
+   * @returns true if message of this level would be logged, otherwise false
+   */
+  VRMLPROC_API bool IsLevelEnabled(Level level);
+
   /**
    * @brief Logs a raw, unformatted message with a title.
    *
@@ -0,0 +1,179 @@
+#include "MetricsCollector.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+/**
+ * @brief Gets monotonic wall-clock time.
+ *
+ * @returns time in seconds since an unspecified point
+ */
+static double GetWallTime() {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Computes a percentile of sorted values using the nearest-rank method.
+ *
+ * @param sortedValues non-empty vector of values sorted in ascending order
+ * @param percentile percentile in range [0, 100]
+ * @returns value of the percentile
+ */
+static double GetPercentile(const std::vector<double>& sortedValues, double percentile) {
+  auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * static_cast<double>(sortedValues.size())));
+  return sortedValues[std::clamp<size_t>(rank, 1, sortedValues.size()) - 1];
+}
+
+void vrml_proc::core::metrics::MetricsCollector::StartStage(const std::string& name) {
+  if (m_currentStage.has_value()) {
+    EndStage();
+  }
+  m_currentStage = StageStart{name, GetWallTime(), GetProcessCpuTime(), GetPeakRss()};
+}
+
+vrml_proc::core::metrics::StageMetrics& vrml_proc::core::metrics::MetricsCollector::EndStage() {
+  if (!m_currentStage.has_value()) {
+    m_unrecordedStage = StageMetrics();
+    return m_unrecordedStage;
+  }
+
+  StageMetrics stage;
+  stage.name = m_currentStage->name;
+  stage.wallTime = GetWallTime() - m_currentStage->wallTime;
+  stage.cpuTime = GetProcessCpuTime() - m_currentStage->cpuTime;
+  uint64_t peakRss = GetPeakRss();
+  stage.peakRssDelta = peakRss > m_currentStage->peakRss ? peakRss - m_currentStage->peakRss : 0;
+
+  m_currentStage.reset();
+  m_stages.push_back(stage);
+  return m_stages.back();
+}
+
+void vrml_proc::core::metrics::MetricsCollector::SetCounter(const std::string& name, uint64_t value) {
+  m_counters[name] = value;
+}
+
+void vrml_proc::core::metrics::MetricsCollector::SetNodeTypesCount(
+    const std::map<std::string, uint64_t>& nodeTypesCount) {
+  m_nodeTypesCount = nodeTypesCount;
+}
+
+void vrml_proc::core::metrics::MetricsCollector::RecordTask(double time, bool successful) {
+  std::scoped_lock lock(m_tasksMutex);
+  m_taskTimes.push_back(time);
+  if (!successful) {
+    m_failedTasksCount++;
+  }
+}
+
+nlohmann::json vrml_proc::core::metrics::MetricsCollector::ToJson() const {
+  nlohmann::json report;
+  report["successful"] = m_successful;
+
+  double totalWallTime = 0.0;
+  double totalCpuTime = 0.0;
+  report["stages"] = nlohmann::json::array();
+  for (const auto& stage : m_stages) {
+    report["stages"].push_back({{"name", stage.name}, {"wallTime", stage.wallTime}, {"cpuTime", stage.cpuTime},
+        {"peakRssDelta", stage.peakRssDelta}, {"bytesRead", stage.bytesRead}, {"bytesWritten", stage.bytesWritten}});
+    totalWallTime += stage.wallTime;
+    totalCpuTime += stage.cpuTime;
+  }
+  report["total"] = {{"wallTime", totalWallTime}, {"cpuTime", totalCpuTime}, {"peakRss", GetPeakRss()}};
+
+  report["counters"] = nlohmann::json::object();
+  for (const auto& [name, value] : m_counters) {
+    report["counters"][name] = value;
+  }
+
+  report["nodeTypes"] = nlohmann::json::object();
+  for (const auto& [type, count] : m_nodeTypesCount) {
+    report["nodeTypes"][type] = count;
+  }
+
+  std::vector<double> taskTimes;
+  uint64_t failedTasksCount;
+  {
+    std::scoped_lock lock(m_tasksMutex);
+    taskTimes = m_taskTimes;
+    failedTasksCount = m_failedTasksCount;
+  }
+  std::sort(taskTimes.begin(), taskTimes.end());
+
+  nlohmann::json tasks = {{"count", taskTimes.size()}, {"failed", failedTasksCount}};
+  if (!taskTimes.empty()) {
+    double totalTaskTime = 0.0;
+    for (double time : taskTimes) {
+      totalTaskTime += time;
+    }
+    tasks["time"] = {{"total", totalTaskTime}, {"mean", totalTaskTime / static_cast<double>(taskTimes.size())},
+        {"p50", GetPercentile(taskTimes, 50.0)}, {"p95", GetPercentile(taskTimes, 95.0)}, {"max", taskTimes.back()}};
+  }
+  report["tasks"] = tasks;
+
+  return report;
+}
+
+double vrml_proc::core::metrics::MetricsCollector::GetProcessCpuTime() {
+#ifdef _WIN32
+  FILETIME creationTime, exitTime, kernelTime, userTime;
+  if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime)) {
+    return 0.0;
+  }
+  auto toSeconds = [](const FILETIME& time) {
+    ULARGE_INTEGER value;
+    value.LowPart = time.dwLowDateTime;
+    value.HighPart = time.dwHighDateTime;
+    return static_cast<double>(value.QuadPart) * 1e-7;
+  };
+  return toSeconds(kernelTime) + toSeconds(userTime);
+#else
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0.0;
+  }
+  auto toSeconds = [](const timeval& time) {
+    return static_cast<double>(time.tv_sec) + static_cast<double>(time.tv_usec) * 1e-6;
+  };
+  return toSeconds(usage.ru_utime) + toSeconds(usage.ru_stime);
+#endif
+}
+
+uint64_t vrml_proc::core::metrics::MetricsCollector::GetPeakRss() {
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS counters;
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+    return 0;
+  }
+  return static_cast<uint64_t>(counters.PeakWorkingSetSize);
+#else
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+#ifdef __APPLE__
+  return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+  // Linux reports kilobytes.
+  return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
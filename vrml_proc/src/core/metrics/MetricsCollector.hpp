@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "VrmlProcExport.hpp"
+
+namespace vrml_proc::core::metrics {
+  /**
+   * @brief Represents measured values of one stage of a process (e.g. parsing or writing).
+   */
+  struct StageMetrics {
+    std::string name;
+    /** @brief Elapsed wall-clock time in seconds. */
+    double wallTime = 0.0;
+    /** @brief CPU time consumed by all threads of the process in seconds. */
+    double cpuTime = 0.0;
+    /** @brief Growth of the peak resident set size of the process during the stage in bytes. */
+    uint64_t peakRssDelta = 0;
+    uint64_t bytesRead = 0;
+    uint64_t bytesWritten = 0;
+  };
+
+  /**
+   * @brief Collects performance metrics of a process divided into consecutive stages, together with arbitrary counters
+   * and durations of individual tasks. The result is a machine-readable JSON report.
+   *
+   * Stages are expected to be started and ended from one thread, `RecordTask()` is thread-safe.
+   */
+  class VRMLPROC_API MetricsCollector {
+   public:
+    /**
+     * @brief Starts a new stage. If there is a stage in progress, it is ended first.
+     *
+     * @param name name of the stage
+     */
+    void StartStage(const std::string& name);
+
+    /**
+     * @brief Ends the stage in progress.
+     *
+     * @returns metrics of the ended stage, they can be further completed (e.g. by number of bytes read)
+     *
+     * @note If there is no stage in progress, nothing is recorded. The returned metrics are then not part of the
+     * report, so values set into them are discarded.
+     */
+    StageMetrics& EndStage();
+
+    /**
+     * @brief Sets a named counter (e.g. number of root nodes).
+     *
+     * @param name name of the counter
+     * @param value value of the counter
+     */
+    void SetCounter(const std::string& name, uint64_t value);
+
+    /**
+     * @brief Sets the number of nodes of each type.
+     *
+     * @param nodeTypesCount map from node type to the number of nodes
+     */
+    void SetNodeTypesCount(const std::map<std::string, uint64_t>& nodeTypesCount);
+
+    /**
+     * @brief Records a finished task.
+     *
+     * @param time duration of the task in seconds
+     * @param successful true if the task succeeded
+     */
+    void RecordTask(double time, bool successful);
+
+    /**
+     * @brief Sets the overall result of the process.
+     *
+     * @param successful true if the process succeeded
+     */
+    void SetSuccessful(bool successful) { m_successful = successful; }
+
+    /**
+     * @brief Gets all ended stages in the order they were started.
+     *
+     * @returns stages
+     */
+    const std::vector<StageMetrics>& GetStages() const { return m_stages; }
+
+    /**
+     * @brief Creates a JSON report of all collected metrics. A stage still in progress is not included.
+     *
+     * Task durations are summarized into count, total, mean, p50, p95 and max.
+     *
+     * @returns JSON report
+     */
+    nlohmann::json ToJson() const;
+
+    /**
+     * @brief Gets CPU time consumed by the whole process so far.
+     *
+     * @returns CPU time (user and system) in seconds
+     */
+    static double GetProcessCpuTime();
+
+    /**
+     * @brief Gets the peak resident set size of the process so far.
+     *
+     * @returns peak resident set size in bytes, zero if it is not available on the platform
+     */
+    static uint64_t GetPeakRss();
+
+   private:
+    /**
+     * @brief Represents values captured when a stage started.
+     */
+    struct StageStart {
+      std::string name;
+      double wallTime;
+      double cpuTime;
+      uint64_t peakRss;
+    };
+
+    std::optional<StageStart> m_currentStage;
+    std::vector<StageMetrics> m_stages;
+    /** @brief Metrics returned by `EndStage()` when there is no stage in progress. */
+    StageMetrics m_unrecordedStage;
+    std::map<std::string, uint64_t> m_counters;
+    std::map<std::string, uint64_t> m_nodeTypesCount;
+    bool m_successful = false;
+
+    mutable std::mutex m_tasksMutex;
+    std::vector<double> m_taskTimes;
+    uint64_t m_failedTasksCount = 0;
+  };
+}  // namespace vrml_proc::core::metrics
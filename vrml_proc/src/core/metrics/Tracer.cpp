@@ -0,0 +1,124 @@
+#include "Tracer.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <result.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include "Error.hpp"
+#include "IoError.hpp"
+
+/**
+ * @brief Represents spans recorded by one thread. The mutex is contended only when the spans are dumped or cleared.
+ */
+struct ThreadTraceBuffer {
+  size_t threadIndex = 0;
+  std::mutex mutex;
+  std::vector<vrml_proc::core::metrics::TraceEvent> events;
+};
+
+/**
+ * @brief Global flag indicating if tracing is enabled.
+ */
+static std::atomic<bool> g_tracingEnabled = false;
+
+/**
+ * @brief Global time origin of the trace.
+ */
+static std::atomic<std::chrono::steady_clock::rep> g_traceOrigin = 0;
+
+/**
+ * @brief Global list of buffers of all threads which recorded a span. Buffers are shared with the threads, so spans
+ * of already finished threads are kept.
+ */
+static std::mutex g_buffersMutex;
+static std::vector<std::shared_ptr<ThreadTraceBuffer>> g_buffers;
+
+/**
+ * @brief Gets buffer of the calling thread, it is registered in the global list on the first use.
+ *
+ * @returns buffer of the calling thread
+ */
+static ThreadTraceBuffer& GetThreadBuffer() {
+  thread_local std::shared_ptr<ThreadTraceBuffer> buffer = []() {
+    auto newBuffer = std::make_shared<ThreadTraceBuffer>();
+    std::scoped_lock lock(g_buffersMutex);
+    newBuffer->threadIndex = g_buffers.size() + 1;
+    g_buffers.push_back(newBuffer);
+    return newBuffer;
+  }();
+  return *buffer;
+}
+
+void vrml_proc::core::metrics::Tracer::SetEnabled(bool enabled) {
+  if (enabled) {
+    std::scoped_lock lock(g_buffersMutex);
+    for (auto& buffer : g_buffers) {
+      std::scoped_lock bufferLock(buffer->mutex);
+      buffer->events.clear();
+    }
+    g_traceOrigin = std::chrono::steady_clock::now().time_since_epoch().count();
+  }
+  g_tracingEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool vrml_proc::core::metrics::Tracer::IsEnabled() { return g_tracingEnabled.load(std::memory_order_relaxed); }
+
+int64_t vrml_proc::core::metrics::Tracer::Now() {
+  auto origin = std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(g_traceOrigin.load()));
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - origin).count();
+}
+
+void vrml_proc::core::metrics::Tracer::Record(TraceEvent&& event) {
+  auto& buffer = GetThreadBuffer();
+  std::scoped_lock lock(buffer.mutex);
+  buffer.events.push_back(std::move(event));
+}
+
+nlohmann::json vrml_proc::core::metrics::Tracer::ToChromeTraceJson() {
+  nlohmann::json events = nlohmann::json::array();
+
+  std::scoped_lock lock(g_buffersMutex);
+  for (const auto& buffer : g_buffers) {
+    std::scoped_lock bufferLock(buffer->mutex);
+    if (buffer->events.empty()) {
+      continue;
+    }
+
+    events.push_back({{"name", "thread_name"}, {"ph", "M"}, {"pid", 1}, {"tid", buffer->threadIndex},
+        {"args", {{"name", "thread " + std::to_string(buffer->threadIndex)}}}});
+    for (const auto& event : buffer->events) {
+      nlohmann::json traceEvent = {{"name", event.name}, {"cat", event.category}, {"ph", "X"}, {"ts", event.start},
+          {"dur", event.duration}, {"pid", 1}, {"tid", buffer->threadIndex}};
+      if (event.arguments.is_object()) {
+        traceEvent["args"] = event.arguments;
+      }
+      events.push_back(std::move(traceEvent));
+    }
+  }
+
+  return {{"traceEvents", events}, {"displayTimeUnit", "ms"}};
+}
+
+cpp::result<void, std::shared_ptr<vrml_proc::core::error::Error>>
+vrml_proc::core::metrics::Tracer::WriteChromeTrace(const std::filesystem::path& filepath) {
+  std::ofstream stream(filepath);
+  if (!stream.is_open()) {
+    return cpp::fail(std::make_shared<vrml_proc::core::io::error::GeneralWriteError>(filepath.string()));
+  }
+  stream << ToChromeTraceJson().dump();
+  if (!stream) {
+    return cpp::fail(
+        std::make_shared<vrml_proc::core::io::error::GeneralWriteError>(filepath.string(), "stream failure"));
+  }
+  return {};
+}
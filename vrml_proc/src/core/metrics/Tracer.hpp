@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <result.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include "Error.hpp"
+#include "VrmlProcExport.hpp"
+
+namespace vrml_proc::core::metrics {
+  /**
+   * @brief Represents one finished span (a complete event in Chrome trace terms).
+   */
+  struct TraceEvent {
+    std::string name;
+    std::string category;
+    /** @brief Start of the span in microseconds since the tracing was enabled. */
+    int64_t start = 0;
+    /** @brief Duration of the span in microseconds. */
+    int64_t duration = 0;
+    /** @brief Metadata of the span (JSON object or null). */
+    nlohmann::json arguments;
+  };
+
+  /**
+   * @brief Process-wide collector of trace spans. Spans are recorded into per-thread buffers, so worker threads do not
+   * contend with each other, and they can be dumped as Chrome `trace_event` JSON (loadable by `chrome://tracing` or
+   * Perfetto).
+   *
+   * Tracing is disabled by default. While it is disabled, a span costs one call of `IsEnabled()` (a relaxed atomic
+   * load) and nothing is allocated or formatted.
+   */
+  class VRMLPROC_API Tracer {
+   public:
+    /**
+     * @brief Enables or disables tracing. Enabling it clears all previously recorded spans and resets the time origin.
+     *
+     * @param enabled true to enable tracing
+     */
+    static void SetEnabled(bool enabled);
+
+    /**
+     * @brief Checks if tracing is enabled.
+     *
+     * @returns true if spans are recorded
+     */
+    static bool IsEnabled();
+
+    /**
+     * @brief Gets current time on the tracing clock.
+     *
+     * @returns microseconds since the tracing was enabled
+     */
+    static int64_t Now();
+
+    /**
+     * @brief Records a finished span for the calling thread.
+     *
+     * @param event span to record
+     */
+    static void Record(TraceEvent&& event);
+
+    /**
+     * @brief Creates Chrome `trace_event` JSON of all recorded spans. Every thread which recorded a span is named
+     * after its index (`thread 1`, `thread 2`, ...) in the order the threads recorded their first span.
+     *
+     * @returns JSON object with `traceEvents` array
+     */
+    static nlohmann::json ToChromeTraceJson();
+
+    /**
+     * @brief Writes Chrome `trace_event` JSON of all recorded spans into the file.
+     *
+     * @param filepath path to the output file
+     * @returns empty result or error if the file could not be written
+     */
+    static cpp::result<void, std::shared_ptr<vrml_proc::core::error::Error>> WriteChromeTrace(
+        const std::filesystem::path& filepath);
+  };
+
+  /**
+   * @brief Represents a scoped span. It is started in the constructor and recorded in the destructor. If tracing is
+   * disabled at the construction, the span does nothing at all (arguments are not even formatted).
+   *
+   * Example usage:
+   * @code
+   * TraceSpan span("traverse root node", "traversal");
+   * span.AddArgument("header", root.header);
+   * @endcode
+   */
+  class TraceSpan {
+   public:
+    /**
+     * @brief Starts a span.
+     *
+     * @param name name of the span (must outlive the span, typically a string literal)
+     * @param category category of the span (must outlive the span, typically a string literal)
+     */
+    explicit TraceSpan(const char* name, const char* category = "vrmlx")
+        : m_active(Tracer::IsEnabled()), m_name(name), m_category(category) {
+      if (m_active) {
+        m_start = Tracer::Now();
+      }
+    }
+
+    /**
+     * @brief Ends the span and records it.
+     */
+    ~TraceSpan() {
+      if (m_active) {
+        Tracer::Record({m_name, m_category, m_start, Tracer::Now() - m_start, std::move(m_arguments)});
+      }
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+    TraceSpan(TraceSpan&&) = delete;
+    TraceSpan& operator=(TraceSpan&&) = delete;
+
+    /**
+     * @brief Attaches metadata to the span. It is a no-op if the span is not active.
+     *
+     * @tparam T type of the value, anything convertible to JSON (string, number, bool)
+     * @param key name of the argument
+     * @param value value of the argument
+     */
+    template <typename T>
+    void AddArgument(const char* key, const T& value) {
+      if (m_active) {
+        m_arguments[key] = value;
+      }
+    }
+
+    /**
+     * @brief Checks if the span is recorded. It can be used to skip computation of expensive arguments.
+     *
+     * @returns true if tracing was enabled when the span started
+     */
+    bool IsActive() const { return m_active; }
+
+   private:
+    bool m_active;
+    const char* m_name;
+    const char* m_category;
+    int64_t m_start = 0;
+    nlohmann::json m_arguments;
+  };
+}  // namespace vrml_proc::core::metrics
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <taskflow/taskflow.hpp>
+
+namespace vrml_proc::core::parallelism {
+  /**
+   * @brief Represents a streaming counterpart of `ThreadTaskRunner`. Tasks are handed to the worker threads as soon as
+   * they are submitted (e.g. while a traversal is still producing them) and their results are consumed by a single
+   * consumer in the order in which the tasks finish. So a cheap task does not hold back results of the expensive ones
+   * and each result is released as soon as the consumer is done with it.
+   *
+   * Typical usage is one producer calling `Submit()` and `Close()`, and one consumer calling `Consume()` at the same
+   * time from another thread.
+   *
+   * Each task may be submitted with an estimated cost. Whenever a worker thread becomes free, it picks the most
+   * expensive task which has not started yet (tasks of equal cost are started in the submission order), so that a huge
+   * task submitted late does not run alone at the end. Cheap tasks are picked in batches, see the constructor.
+   *
+   * @tparam TaskType type of the tasks
+   * @tparam ResultType type of the result
+   */
+  template <typename TaskType, typename ResultType>
+  class PipelineTaskRunner {
+   public:
+    /**
+     * @brief Constructs an PipelineTaskRunner object.
+     *
+     * @param threads number of threads to use in the thread pool
+     * @param batchCost worker thread picks further tasks until the total cost of the picked tasks reaches this value;
+     * 0 means that tasks are picked one by one
+     */
+    explicit PipelineTaskRunner(unsigned int threads = std::thread::hardware_concurrency(), size_t batchCost = 0)
+        : m_executor(threads), m_batchCost(batchCost), m_submittedTasksCount(0), m_closed(false) {}
+
+    /**
+     * @brief Waits for all tasks which are still running. Tasks may refer to data owned by the caller, so the runner
+     * must be destroyed before such data.
+     */
+    ~PipelineTaskRunner() { m_executor.wait_for_all(); }
+
+    PipelineTaskRunner(const PipelineTaskRunner&) = delete;
+    PipelineTaskRunner& operator=(const PipelineTaskRunner&) = delete;
+
+    /**
+     * @brief Schedules the task. It is started as soon as a worker thread is free and there is no more expensive task
+     * waiting.
+     *
+     * @param task callable task, it must return a result compatible with `ResultType`
+     * @param cost estimated cost of the task
+     */
+    void Submit(TaskType task, size_t cost = 0) {
+      {
+        std::scoped_lock lock(m_mutex);
+        m_scheduled.push_back(ScheduledTask{std::move(task), cost, m_submittedTasksCount});
+        std::push_heap(m_scheduled.begin(), m_scheduled.end(), ScheduledTask::Compare);
+        m_submittedTasksCount++;
+      }
+      m_executor.silent_async([this]() { RunMostExpensive(); });
+    }
+
+    /**
+     * @brief Marks that no more tasks will be submitted. `Consume()` returns after all already submitted tasks are
+     * consumed.
+     */
+    void Close() {
+      {
+        std::scoped_lock lock(m_mutex);
+        m_closed = true;
+      }
+      m_condition.notify_all();
+    }
+
+    /**
+     * @brief Blocks and hands results of the tasks to `consumer` in the order in which the tasks finished. The function
+     * returns once the runner is closed and every submitted task has been consumed. If a task throws, the exception is
+     * rethrown when its result is consumed.
+     *
+     * @param consumer callback receiving a result of each task
+     * @returns number of consumed results
+     */
+    size_t Consume(const std::function<void(ResultType&&)>& consumer) {
+      size_t consumed = 0;
+      while (true) {
+        std::future<ResultType> future;
+        {
+          std::unique_lock lock(m_mutex);
+          m_condition.wait(lock, [this, &consumed]() {
+            return !m_finished.empty() || (m_closed && consumed == m_submittedTasksCount);
+          });
+          if (m_finished.empty()) {
+            return consumed;
+          }
+          future = std::move(m_finished.front());
+          m_finished.pop_front();
+        }
+
+        consumer(future.get());
+        consumed++;
+      }
+    }
+
+    /**
+     * @brief Gets the number of tasks submitted so far.
+     *
+     * @returns number of submitted tasks
+     */
+    size_t GetSubmittedTasksCount() const {
+      std::scoped_lock lock(m_mutex);
+      return m_submittedTasksCount;
+    }
+
+    /**
+     * @brief Gets the executor running the tasks. Tasks may use it to run their own parallel work on the same worker
+     * threads (see `RunAndWait()`) instead of creating another thread pool.
+     *
+     * @returns executor of the runner
+     */
+    tf::Executor& GetExecutor() { return m_executor; }
+
+   private:
+    struct ScheduledTask {
+      TaskType task;
+      size_t cost;
+      size_t order;
+
+      /** @brief Heap order, the most expensive and then the earliest submitted task is on the top. */
+      static bool Compare(const ScheduledTask& a, const ScheduledTask& b) {
+        return a.cost != b.cost ? a.cost < b.cost : a.order > b.order;
+      }
+    };
+
+    /**
+     * @brief Runs the most expensive scheduled task (or a batch of the cheap ones). Every submitted task schedules one
+     * call of this function, so calls which find no scheduled task simply return.
+     */
+    void RunMostExpensive() {
+      std::vector<ScheduledTask> batch;
+      {
+        std::scoped_lock lock(m_mutex);
+        size_t batchCost = 0;
+        while (!m_scheduled.empty()) {
+          std::pop_heap(m_scheduled.begin(), m_scheduled.end(), ScheduledTask::Compare);
+          batch.push_back(std::move(m_scheduled.back()));
+          m_scheduled.pop_back();
+          batchCost += batch.back().cost;
+          if (batchCost >= m_batchCost) {
+            break;
+          }
+        }
+      }
+
+      for (auto& scheduled : batch) {
+        std::promise<ResultType> promise;
+        try {
+          promise.set_value(scheduled.task());
+        } catch (...) {
+          promise.set_exception(std::current_exception());
+        }
+        {
+          std::scoped_lock lock(m_mutex);
+          m_finished.push_back(promise.get_future());
+        }
+        m_condition.notify_one();
+      }
+    }
+
+    tf::Executor m_executor;
+    size_t m_batchCost;
+    std::vector<ScheduledTask> m_scheduled;
+    std::deque<std::future<ResultType>> m_finished;
+    size_t m_submittedTasksCount;
+    bool m_closed;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_condition;
+  };
+}  // namespace vrml_proc::core::parallelism
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <taskflow/taskflow.hpp>
+
+namespace vrml_proc::core::parallelism {
+  /**
+   * @brief Runs the taskflow on the executor and blocks until it finishes.
+   *
+   * If the caller is itself a worker thread of `executor` (e.g. a task run by `PipelineTaskRunner`), the taskflow is
+   * co-run: the worker keeps executing tasks of the executor while waiting, so nested parallel work shares the threads
+   * of the executor instead of blocking one of them (or creating new ones).
+   *
+   * @param executor executor to run the taskflow on
+   * @param taskflow taskflow to run
+   */
+  inline void RunAndWait(tf::Executor& executor, tf::Taskflow& taskflow) {
+    if (executor.this_worker_id() >= 0) {
+      executor.corun(taskflow);
+    } else {
+      executor.run(taskflow).wait();
+    }
+  }
+}  // namespace vrml_proc::core::parallelism
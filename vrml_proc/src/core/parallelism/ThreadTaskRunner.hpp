@@ -1,7 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
 #include <thread>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 #include <taskflow/taskflow.hpp>
 
@@ -54,6 +61,71 @@ namespace vrml_proc::core::parallelism {
       executor.run(taskflow).wait();
     }
 
+    /**
+     * @brief Runs a list of tasks in parallel like `Run()`, but the tasks are started in descending order of their
+     * estimated cost (longest-first), so that the most expensive tasks do not end up running alone at the end.
+     *
+     * Tasks with cost smaller than `batchCost` are packed together into batches whose total cost is at least
+     * `batchCost` (except the last one), and each batch is run by one thread at once.
+     *
+     * @param tasks vector of callable tasks, each must return a result compatible with `ResultType`
+     * @param results output vector, where task results are stored; resized to match `tasks.size()`
+     * @param costs estimated cost of each task, `costs[i]` belongs to `tasks[i]`
+     * @param batchCost minimal total cost of a batch of cheap tasks; 0 disables batching
+     *
+     * @throws std::invalid_argument if the number of costs does not match the number of tasks.
+     *
+     * @note This function is thread-safe internally. Do not access `results` concurrently from other threads
+     *       during execution.
+     */
+    void Run(const std::vector<TaskType>& tasks,
+        std::vector<ResultType>& results,
+        const std::vector<size_t>& costs,
+        size_t batchCost = 0) {
+      if (costs.size() != tasks.size()) {
+        throw std::invalid_argument("Run called with costs not matching the tasks!");
+      }
+
+      std::vector<size_t> order(tasks.size());
+      std::iota(order.begin(), order.end(), 0);
+      std::stable_sort(order.begin(), order.end(), [&costs](size_t a, size_t b) { return costs[a] > costs[b]; });
+
+      /** Each unit is a range [first, last) of `order`. */
+      std::vector<std::pair<size_t, size_t>> units;
+      for (size_t first = 0; first < order.size();) {
+        size_t last = first;
+        size_t unitCost = 0;
+        do {
+          unitCost += costs[order[last]];
+          last++;
+        } while (last < order.size() && unitCost < batchCost);
+        units.emplace_back(first, last);
+        first = last;
+      }
+
+      results.resize(tasks.size());
+      std::mutex mutex;
+      std::atomic<size_t> nextUnit = 0;
+
+      tf::Executor executor{m_threads};
+      tf::Taskflow taskflow;
+      for (unsigned int thread = 0; thread < std::max(1u, m_threads); ++thread) {
+        taskflow.emplace([&tasks, &results, &order, &units, &nextUnit, &mutex]() {
+          for (size_t unit = nextUnit++; unit < units.size(); unit = nextUnit++) {
+            for (size_t i = units[unit].first; i < units[unit].second; ++i) {
+              auto result = tasks[order[i]]();
+              {
+                std::scoped_lock lock(mutex);
+                results[order[i]] = std::move(result);
+              }
+            }
+          }
+        });
+      }
+
+      executor.run(taskflow).wait();
+    }
+
    private:
     unsigned int m_threads;
   };
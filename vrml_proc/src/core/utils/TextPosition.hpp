@@ -0,0 +1,100 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace vrml_proc::core::utils {
+  /**
+   * @brief Represents a position inside a text buffer.
+   */
+  struct TextPosition {
+    /** @brief Number of bytes from the start of the buffer. */
+    size_t offset = 0;
+    /** @brief Line number (starting from 1). */
+    size_t line = 1;
+    /** @brief Column number (starting from 1), counted in bytes. */
+    size_t column = 1;
+  };
+
+  /**
+   * @brief Counts newline characters in the range. The range is processed eight bytes at once (SWAR), so even for
+   * a buffer of hundreds of megabytes it takes only a fraction of a second.
+   *
+   * @param begin begin of the range
+   * @param end end of the range
+   * @returns number of '\n' characters
+   */
+  inline size_t CountNewlines(const char* begin, const char* end) {
+    constexpr uint64_t newlines = 0x0A0A0A0A0A0A0A0AULL;
+    constexpr uint64_t lowBits = 0x7F7F7F7F7F7F7F7FULL;
+    constexpr uint64_t highBits = 0x8080808080808080ULL;
+
+    size_t count = 0;
+    const char* current = begin;
+    for (; end - current >= 8; current += 8) {
+      uint64_t word = 0;
+      std::memcpy(&word, current, sizeof(word));
+      /** Bytes equal to '\n' become zero, the high bit of `nonZero` is then set exactly for non-zero bytes. */
+      uint64_t zeroed = word ^ newlines;
+      uint64_t nonZero = ((zeroed & lowBits) + lowBits) | zeroed;
+      count += static_cast<size_t>(std::popcount(~nonZero & highBits));
+    }
+    for (; current != end; ++current) {
+      count += (*current == '\n');
+    }
+    return count;
+  }
+
+  /**
+   * @brief Computes line and column of the position inside the buffer. It is meant to be called only when an error is
+   * reported, the whole prefix of the buffer is scanned.
+   *
+   * @param begin begin of the buffer
+   * @param position position inside the buffer
+   * @returns text position
+   */
+  inline TextPosition GetTextPosition(const char* begin, const char* position) {
+    const char* lineStart = position;
+    while (lineStart != begin && *(lineStart - 1) != '\n') {
+      --lineStart;
+    }
+
+    TextPosition result;
+    result.offset = static_cast<size_t>(position - begin);
+    result.line = CountNewlines(begin, lineStart) + 1;
+    result.column = static_cast<size_t>(position - lineStart) + 1;
+    return result;
+  }
+
+  /**
+   * @brief Creates a two-line snippet: the line containing the position and a caret pointing to the position. Long
+   * lines are cut around the position.
+   *
+   * @param begin begin of the buffer
+   * @param end end of the buffer
+   * @param position position inside the buffer
+   * @param width maximal number of characters of the line shown
+   * @returns snippet
+   */
+  inline std::string GetTextSnippet(const char* begin, const char* end, const char* position, size_t width = 80) {
+    const char* lineStart = position;
+    while (lineStart != begin && *(lineStart - 1) != '\n' && static_cast<size_t>(position - lineStart) < width / 2) {
+      --lineStart;
+    }
+    const char* lineEnd = position;
+    while (lineEnd != end && *lineEnd != '\n' && *lineEnd != '\r' && static_cast<size_t>(lineEnd - lineStart) < width) {
+      ++lineEnd;
+    }
+
+    std::string line(lineStart, lineEnd);
+    for (auto& character : line) {
+      if (character == '\t') {
+        character = ' ';
+      }
+    }
+    return line + "\n" + std::string(static_cast<size_t>(position - lineStart), ' ') + "^";
+  }
+}  // namespace vrml_proc::core::utils
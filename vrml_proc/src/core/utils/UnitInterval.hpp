@@ -31,14 +31,14 @@ namespace vrml_proc::core::utils {
      *
      * @return raw value in <0.0, 1.0>
      */
-    double GetValue() { return m_value; }
+    double GetValue() const { return m_value; }
 
     /**
      * @brief Converts the unit interval value to a percentage.
      *
      * @return value in the range <0.0, 100.0> representing the percentage
      */
-    double GetAsPercentage() { return m_value * 100; }
+    double GetAsPercentage() const { return m_value * 100; }
 
     /**
      * @brief Computes the complement of this unit interval.
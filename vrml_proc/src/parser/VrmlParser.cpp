@@ -1,17 +1,42 @@
 #include "VrmlParser.hpp"
 
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
 #include <boost/spirit/home/qi/parse.hpp>
+#include <boost/spirit/home/qi/skip_over.hpp>
 
 #include "BufferView.hpp"
 #include "FormatString.hpp"
 #include "Logger.hpp"
+#include "NodeDescriptorMap.hpp"
 #include "ParserError.hpp"
 #include "ParserResult.hpp"
 #include "ScopedTimer.hpp"
+#include "TextPosition.hpp"
+#include "Tracer.hpp"
 #include "VrmlFile.hpp"
-#include "VrmlNodeManagerPopulator.hpp"
+#include "VrmlNode.hpp"
 
 namespace vrml_proc::parser {
+  VrmlParser::VrmlParser(
+      service::VrmlNodeManager& manager, bool schemaAware, const grammar::SkippedFields& skippedFields)
+      : Parser<BufferView, model::VrmlFile>(), m_manager(manager), m_grammar(), m_skipper() {  //
+
+    if (schemaAware || !skippedFields.empty()) {
+      m_grammar.SetFieldTypeSchema(&vrml_proc::traversor::node_descriptor::GetFieldTypeSchema(), skippedFields);
+    } else {
+      m_grammar.SetFieldTypeSchema(&vrml_proc::traversor::node_descriptor::GetFloat32ArrayFieldTypeSchema());
+    }
+  }
+
+  void VrmlParser::SetPrunedHeaders(const std::unordered_set<std::string>& headers) {  //
+
+    m_grammar.SetPrunedHeaders(headers);
+  }
+
   ParserResult<model::VrmlFile> VrmlParser::Parse(BufferView buffer) {  //
 
     using namespace vrml_proc::core::logger;
@@ -20,10 +45,15 @@ namespace vrml_proc::parser {
     LogInfo("Parse VRML file content.", LOGGING_INFO);
 
     model::VrmlFile parsedData;
+    const char* inputBegin = buffer.begin;
     double time = 0.0;
     bool success = false;
+    m_grammar.ResetError();
+    m_grammar.ClearReferences();
     {
       auto timer = ScopedTimer(time);
+      auto span = vrml_proc::core::metrics::TraceSpan("parse", "parser");
+      span.AddArgument("bytes", static_cast<size_t>(buffer.end - buffer.begin));
       success = boost::spirit::qi::phrase_parse(buffer.begin, buffer.end, m_grammar, m_skipper, parsedData);
     }
 
@@ -32,21 +62,75 @@ namespace vrml_proc::parser {
           FormatString("Parsing was successful. The whole parsing and AST creation process took ", time, " seconds."),
           LOGGING_INFO);
 
-      LogInfo("Populate VrmlNodeManager with DEF nodes.", LOGGING_INFO);
-      double time = 0.0;
-      {
-        auto timer = ScopedTimer(time);
-        for (const auto& root : parsedData) {
-          service::VrmlNodeManagerPopulator::Populate(m_manager, root);
-        }
-      }
-      LogInfo(
-          FormatString("DEF nodes populating has finished. The whole process took ", time, " seconds."), LOGGING_INFO);
-
+      LinkReferences(parsedData);
       return parsedData;
     }
 
     LogInfo(FormatString("Parsing was not successful. The process took ", time, " seconds."), LOGGING_INFO);
-    return cpp::fail(std::make_shared<vrml_proc::parser::error::ParserError>());
+
+    std::shared_ptr<vrml_proc::core::error::Error> error = std::make_shared<vrml_proc::parser::error::ParserError>();
+    if (!m_grammar.HasError()) {
+      return cpp::fail(error);
+    }
+
+    /**
+     * Line and column are computed only now, so the successful parsing does not pay for tracking them. The recorded
+     * position may precede whitespace or comments which were not skipped yet.
+     */
+    const char* errorPosition = m_grammar.GetErrorPosition().value();
+    boost::spirit::qi::skip_over(errorPosition, buffer.end, m_skipper);
+    TextPosition position = GetTextPosition(inputBegin, errorPosition);
+    LogError(FormatString("Expected ", m_grammar.GetExpected(), " at line ", position.line, ", column ",
+                 position.column, " (byte ", position.offset, ")."),
+        LOGGING_INFO);
+
+    return cpp::fail(error << std::make_shared<vrml_proc::parser::error::ParserSyntaxError>(position.offset,
+                                 position.line, position.column, m_grammar.GetExpected(),
+                                 GetTextSnippet(inputBegin, buffer.end, errorPosition)));
+  }
+
+  void VrmlParser::LinkReferences(const model::VrmlFile& file) {  //
+
+    using namespace vrml_proc::core::logger;
+    using namespace vrml_proc::core::utils;
+
+    /**
+     * DEF and USE nodes were collected by the grammar during parsing in their order in the file, so the map always
+     * holds the last DEF node of each name preceding the current USE node.
+     */
+    std::unordered_map<std::string_view, const model::VrmlNode*> definitions;
+    std::map<std::string_view, size_t> unresolved;
+    size_t definitionCount = 0;
+    size_t linkedCount = 0;
+    for (const auto& reference : m_grammar.GetReferences()) {
+      if (reference.use == nullptr) {
+        const model::VrmlNode& node = reference.node != nullptr ? *reference.node : file[reference.rootIndex];
+        definitions[node.definitionName.value()] = &node;
+        m_manager.AddDefinitionNode(node.definitionName.value(), node);
+        definitionCount++;
+        continue;
+      }
+
+      auto it = definitions.find(reference.use->identifier);
+      if (it != definitions.end()) {
+        reference.use->definition = it->second;
+        linkedCount++;
+      } else {
+        unresolved[reference.use->identifier]++;
+      }
+    }
+
+    LogInfo(FormatString("Registered ", definitionCount, " DEF nodes and linked ", linkedCount, " USE nodes."),
+        LOGGING_INFO);
+
+    if (!unresolved.empty()) {
+      std::string identifiers;
+      for (const auto& [identifier, count] : unresolved) {
+        identifiers += FormatString(identifiers.empty() ? "" : ", ", "<", identifier, "> (", count, "x)");
+      }
+      LogWarning(FormatString(unresolved.size(), " USE identifiers do not follow any DEF node of their name: ",
+                     identifiers, ". They are resolved by the last DEF node of the name in the file, if any."),
+          LOGGING_INFO);
+    }
   }
 }  // namespace vrml_proc::parser
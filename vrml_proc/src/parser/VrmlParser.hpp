@@ -2,8 +2,12 @@
 
 // #define BOOST_SPIRIT_DEBUG
 
+#include <string>
+#include <unordered_set>
+
 #include "BufferView.hpp"
 #include "CommentSkipper.hpp"
+#include "FieldTypeSchema.hpp"
 #include "Parser.hpp"
 #include "VrmlFile.hpp"
 #include "VrmlFileGrammar.hpp"
@@ -25,12 +29,27 @@ namespace vrml_proc::parser {
      * @brief Constructs new parser.
      *
      * @param manager reference to VrmlNodemanager which will be populated with data in the source of parsing
+     * @param schemaAware flag indicating if values of known fields are parsed by the grammar of their type, as
+     * described by NodeDescriptorMap, instead of trying all value grammars in turn; fields of type Float32Array are
+     * parsed by their type in any case
+     * @param skippedFields numeric array fields whose values are not parsed but stored as `UnparsedValue`; they turn
+     * the schema-aware parsing on
+     */
+    VrmlParser(service::VrmlNodeManager& manager,
+        bool schemaAware = false,
+        const grammar::SkippedFields& skippedFields = {});
+
+    /**
+     * @brief Sets headers of nodes whose bodies are not parsed. Such nodes are kept as stubs without fields, unless
+     * their body contains a DEF node (see `VrmlNode::IsPruned()`).
+     *
+     * @param headers pruned headers as written in the file, i.e. including synonyms
      */
-    VrmlParser(service::VrmlNodeManager& manager)
-        : Parser<BufferView, model::VrmlFile>(), m_manager(manager), m_grammar(), m_skipper() {}
+    void SetPrunedHeaders(const std::unordered_set<std::string>& headers);
 
     /**
-     * @brief Parses the VRML 2.0 file.
+     * @brief Parses the VRML 2.0 file. DEF nodes of the file are registered in the manager and each USE node is
+     * linked to the last DEF node of its name which precedes it (see `UseNode::definition`).
      *
      * @param buffer object containing const char pointers indicating begin and end for const char* to parse.
      * @returns vector of VRML nodes aka VRML file if parsing is succefull, otherwise error
@@ -38,6 +57,14 @@ namespace vrml_proc::parser {
     ParserResult<model::VrmlFile> Parse(BufferView buffer) override;
 
    private:
+    /**
+     * @brief Registers DEF nodes found by the last parsing and links USE nodes to them. USE nodes which do not
+     * follow any DEF node of their name are left unlinked and reported by a single warning.
+     *
+     * @param file parsed file
+     */
+    void LinkReferences(const model::VrmlFile& file);
+
     grammar::VrmlFileGrammar<const char*, grammar::CommentSkipper> m_grammar;
     grammar::CommentSkipper m_skipper;
     service::VrmlNodeManager& m_manager;
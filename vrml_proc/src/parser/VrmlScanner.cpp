@@ -0,0 +1,409 @@
+#include "VrmlScanner.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "BufferView.hpp"
+#include "FormatString.hpp"
+#include "Logger.hpp"
+#include "ParserResult.hpp"
+#include "ScannerError.hpp"
+#include "ScopedTimer.hpp"
+#include "TextPosition.hpp"
+#include "VrmlScanStatistics.hpp"
+
+namespace {
+  /**
+   * @brief Character classes used by the scanner.
+   */
+  enum CharacterClass : uint8_t {
+    /** Whitespace, control characters and comma (VRML treats comma as whitespace). */
+    Separator = 1 << 0,
+    /** Characters which cannot be a part of an identifier. */
+    IdentifierTerminator = 1 << 1,
+    /** Characters which can start a number. */
+    NumberStart = 1 << 2,
+    /** Characters which can be a part of a number. */
+    NumberPart = 1 << 3,
+  };
+
+  constexpr std::array<uint8_t, 256> CreateCharacterClasses() {
+    std::array<uint8_t, 256> classes{};
+    for (int c = 0; c <= 0x20; ++c) {
+      classes[c] |= Separator | IdentifierTerminator;
+    }
+    classes[','] |= Separator;
+    for (char c : std::string_view("\"'+,-.[]{}\\")) {
+      classes[static_cast<uint8_t>(c)] |= IdentifierTerminator;
+    }
+    for (char c : std::string_view("0123456789+-.")) {
+      classes[static_cast<uint8_t>(c)] |= NumberStart | NumberPart;
+    }
+    for (char c : std::string_view("abcdefABCDEFxX")) {
+      classes[static_cast<uint8_t>(c)] |= NumberPart;
+    }
+    return classes;
+  }
+
+  constexpr std::array<uint8_t, 256> CharacterClasses = CreateCharacterClasses();
+
+  inline bool Is(char c, CharacterClass characterClass) {
+    return (CharacterClasses[static_cast<uint8_t>(c)] & characterClass) != 0;
+  }
+
+  /**
+   * @brief Describes which statistics are collected for numbers inside an array.
+   */
+  enum class ArrayKind { Other, Point, CoordIndex };
+
+  /**
+   * @brief Represents one level of nesting (node body or array).
+   */
+  struct Frame {
+    bool isNode;
+    ArrayKind arrayKind = ArrayKind::Other;
+    size_t numbersCount = 0;
+    bool lastIsSeparator = true;
+    /** @brief Type of the node (empty for arrays). */
+    std::string_view nodeType = {};
+  };
+
+  /**
+   * @brief Describes what the scanner expects as the next token.
+   */
+  enum class Expectation { RootNode, FieldOrEnd, FieldValue, ArrayItem };
+
+  /**
+   * @brief Single pass scanner over the buffer. Error is described by the position and message, the rest is done by
+   * the caller only on failure.
+   */
+  class Scanner {
+   public:
+    Scanner(const char* begin, const char* end) : m_begin(begin), m_end(end), m_current(begin) {}
+
+    bool Scan(vrml_proc::parser::model::VrmlScanStatistics& statistics) {  //
+
+      statistics.bytesCount = static_cast<size_t>(m_end - m_begin);
+
+      while (m_current != m_end && (*m_current == ' ' || (*m_current >= '\t' && *m_current <= '\r'))) {
+        ++m_current;
+      }
+      constexpr std::string_view header = "#VRML V2.0 utf8";
+      if (static_cast<size_t>(m_end - m_current) < header.size() ||
+          std::string_view(m_current, header.size()) != header) {
+        return Fail("file must start with header <#VRML V2.0 utf8>");
+      }
+      m_current += header.size();
+
+      Expectation expectation = Expectation::RootNode;
+      std::string_view fieldName;
+
+      while (true) {
+        SkipSeparators();
+
+        if (m_current == m_end) {
+          if (m_frames.empty()) {
+            return true;
+          }
+          return Fail(m_frames.back().isNode ? "unexpected end of file, node is not closed by '}'"
+                                             : "unexpected end of file, array is not closed by ']'");
+        }
+
+        const char c = *m_current;
+        switch (expectation) {
+          case Expectation::RootNode: {
+            if (!ScanNodeStart(statistics)) {
+              return false;
+            }
+            statistics.rootNodesCount++;
+            expectation = Expectation::FieldOrEnd;
+            break;
+          }
+          case Expectation::FieldOrEnd: {
+            if (c == '}') {
+              ++m_current;
+              m_frames.pop_back();
+              m_nodesDepth--;
+              expectation = GetExpectationAfterNode();
+              break;
+            }
+            fieldName = ScanIdentifier();
+            if (fieldName.empty()) {
+              return Fail("expected field name or '}'");
+            }
+            statistics.fieldsCount++;
+            expectation = Expectation::FieldValue;
+            break;
+          }
+          case Expectation::FieldValue: {
+            if (Is(c, NumberStart)) {
+              do {
+                if (!ScanNumber(statistics).has_value()) {
+                  return false;
+                }
+                SkipSeparators();
+              } while (m_current != m_end && Is(*m_current, NumberStart));
+              expectation = Expectation::FieldOrEnd;
+            } else if (c == '"') {
+              if (!ScanString()) {
+                return false;
+              }
+              expectation = Expectation::FieldOrEnd;
+            } else if (c == '[') {
+              ++m_current;
+              Frame frame{false};
+              // Only `Coordinate.point` holds 3D coordinates, e.g. `TextureCoordinate.point` holds 2D ones.
+              if (fieldName == "point" && m_frames.back().nodeType == "Coordinate") {
+                frame.arrayKind = ArrayKind::Point;
+              } else if (fieldName == "coordIndex") {
+                frame.arrayKind = ArrayKind::CoordIndex;
+              }
+              m_frames.push_back(frame);
+              expectation = Expectation::ArrayItem;
+            } else {
+              std::string_view identifier = PeekIdentifier();
+              if (identifier == "TRUE" || identifier == "FALSE" || identifier == "NULL") {
+                m_current += identifier.size();
+                expectation = Expectation::FieldOrEnd;
+              } else if (identifier == "USE") {
+                if (!ScanUse(statistics)) {
+                  return false;
+                }
+                expectation = Expectation::FieldOrEnd;
+              } else if (!identifier.empty()) {
+                if (!ScanNodeStart(statistics)) {
+                  return false;
+                }
+                expectation = Expectation::FieldOrEnd;
+              } else {
+                return Fail("expected field value");
+              }
+            }
+            break;
+          }
+          case Expectation::ArrayItem: {
+            if (c == ']') {
+              ++m_current;
+              const Frame& frame = m_frames.back();
+              if (frame.arrayKind == ArrayKind::Point) {
+                statistics.coordinatesCount += frame.numbersCount / 3;
+              } else if (frame.arrayKind == ArrayKind::CoordIndex && !frame.lastIsSeparator) {
+                statistics.facesCount++;
+              }
+              m_frames.pop_back();
+              expectation = Expectation::FieldOrEnd;
+            } else if (Is(c, NumberStart)) {
+              auto number = ScanNumber(statistics);
+              if (!number.has_value()) {
+                return false;
+              }
+              Frame& frame = m_frames.back();
+              frame.numbersCount++;
+              if (frame.arrayKind == ArrayKind::CoordIndex) {
+                statistics.coordinateIndicesCount++;
+                frame.lastIsSeparator = (number.value() == "-1");
+                if (frame.lastIsSeparator) {
+                  statistics.facesCount++;
+                }
+              }
+            } else if (c == '"') {
+              if (!ScanString()) {
+                return false;
+              }
+            } else {
+              std::string_view identifier = PeekIdentifier();
+              if (identifier == "USE") {
+                if (!ScanUse(statistics)) {
+                  return false;
+                }
+              } else if (identifier == "TRUE" || identifier == "FALSE") {
+                m_current += identifier.size();
+              } else if (!identifier.empty()) {
+                if (!ScanNodeStart(statistics)) {
+                  return false;
+                }
+                expectation = Expectation::FieldOrEnd;
+              } else {
+                return Fail("expected array item or ']'");
+              }
+            }
+            break;
+          }
+        }
+
+        statistics.maxDepth = std::max(statistics.maxDepth, m_nodesDepth);
+      }
+    }
+
+    const char* GetErrorPosition() const { return m_current; }
+    const std::string& GetErrorMessage() const { return m_errorMessage; }
+
+   private:
+    bool Fail(const std::string& message) {
+      m_errorMessage = message;
+      return false;
+    }
+
+    Expectation GetExpectationAfterNode() const {
+      if (m_frames.empty()) {
+        return Expectation::RootNode;
+      }
+      return m_frames.back().isNode ? Expectation::FieldOrEnd : Expectation::ArrayItem;
+    }
+
+    void SkipSeparators() {
+      while (m_current != m_end) {
+        if (Is(*m_current, Separator)) {
+          ++m_current;
+        } else if (*m_current == '#') {
+          const void* newline = std::memchr(m_current, '\n', static_cast<size_t>(m_end - m_current));
+          m_current = newline != nullptr ? static_cast<const char*>(newline) + 1 : m_end;
+        } else {
+          return;
+        }
+      }
+    }
+
+    std::string_view PeekIdentifier() const {
+      if (m_current == m_end || Is(*m_current, IdentifierTerminator) || (*m_current >= '0' && *m_current <= '9')) {
+        return {};
+      }
+      const char* it = m_current + 1;
+      while (it != m_end && !Is(*it, IdentifierTerminator)) {
+        ++it;
+      }
+      return std::string_view(m_current, static_cast<size_t>(it - m_current));
+    }
+
+    std::string_view ScanIdentifier() {
+      std::string_view identifier = PeekIdentifier();
+      m_current += identifier.size();
+      return identifier;
+    }
+
+    std::optional<std::string_view> ScanNumber(vrml_proc::parser::model::VrmlScanStatistics& statistics) {
+      const char* start = m_current;
+      bool hasDigit = false;
+      while (m_current != m_end && Is(*m_current, NumberPart)) {
+        hasDigit |= (*m_current >= '0' && *m_current <= '9');
+        ++m_current;
+      }
+      if (!hasDigit) {
+        m_current = start;
+        Fail("invalid number");
+        return std::nullopt;
+      }
+      statistics.numbersCount++;
+      return std::string_view(start, static_cast<size_t>(m_current - start));
+    }
+
+    bool ScanString() {
+      const char* start = m_current;
+      ++m_current;
+      while (m_current != m_end && *m_current != '"') {
+        if (*m_current == '\\' && m_current + 1 != m_end) {
+          ++m_current;
+        }
+        ++m_current;
+      }
+      if (m_current == m_end) {
+        m_current = start;
+        return Fail("string is not terminated by '\"'");
+      }
+      ++m_current;
+      return true;
+    }
+
+    bool ScanUse(vrml_proc::parser::model::VrmlScanStatistics& statistics) {
+      m_current += 3;
+      SkipSeparators();
+      if (ScanIdentifier().empty()) {
+        return Fail("expected identifier after USE");
+      }
+      statistics.useNodesCount++;
+      return true;
+    }
+
+    bool ScanNodeStart(vrml_proc::parser::model::VrmlScanStatistics& statistics) {
+      std::string_view type = ScanIdentifier();
+      if (type == "DEF") {
+        SkipSeparators();
+        if (ScanIdentifier().empty()) {
+          return Fail("expected identifier after DEF");
+        }
+        statistics.defNodesCount++;
+        SkipSeparators();
+        type = ScanIdentifier();
+      }
+      if (type.empty()) {
+        return Fail("expected node type");
+      }
+
+      SkipSeparators();
+      if (m_current == m_end || *m_current != '{') {
+        return Fail("expected '{' after node type");
+      }
+      ++m_current;
+
+      statistics.nodesCount++;
+      auto it = statistics.nodeTypesCount.find(type);
+      if (it == statistics.nodeTypesCount.end()) {
+        statistics.nodeTypesCount.emplace(std::string(type), 1);
+      } else {
+        it->second++;
+      }
+
+      Frame frame{true};
+      frame.nodeType = type;
+      m_frames.push_back(frame);
+      m_nodesDepth++;
+      return true;
+    }
+
+    const char* m_begin;
+    const char* m_end;
+    const char* m_current;
+    std::vector<Frame> m_frames;
+    size_t m_nodesDepth = 0;
+    std::string m_errorMessage;
+  };
+}  // namespace
+
+namespace vrml_proc::parser {
+  ParserResult<model::VrmlScanStatistics> VrmlScanner::Parse(BufferView buffer) {  //
+
+    using namespace vrml_proc::core::logger;
+    using namespace vrml_proc::core::utils;
+
+    LogInfo("Scan VRML file content.", LOGGING_INFO);
+
+    model::VrmlScanStatistics statistics;
+    Scanner scanner(buffer.begin, buffer.end);
+    double time = 0.0;
+    bool success = false;
+    {
+      auto timer = ScopedTimer(time);
+      success = scanner.Scan(statistics);
+    }
+
+    if (success) {
+      LogInfo(FormatString("Scanning was successful. Found ", statistics.nodesCount, " nodes. The process took ", time,
+                  " seconds."),
+          LOGGING_INFO);
+      return statistics;
+    }
+
+    TextPosition position = GetTextPosition(buffer.begin, scanner.GetErrorPosition());
+
+    LogInfo(FormatString("Scanning was not successful. The process took ", time, " seconds."), LOGGING_INFO);
+    return cpp::fail(std::make_shared<error::ScannerError>(
+        position.offset, position.line, position.column, scanner.GetErrorMessage()));
+  }
+}  // namespace vrml_proc::parser
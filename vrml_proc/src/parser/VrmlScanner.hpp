@@ -0,0 +1,27 @@
+#pragma once
+
+#include "BufferView.hpp"
+#include "Parser.hpp"
+#include "VrmlScanStatistics.hpp"
+
+#include "VrmlProcExport.hpp"
+
+namespace vrml_proc::parser {
+  /**
+   * @brief Represents a lightweight VRML 2.0 scanner. It checks the structure of the file (header, nodes, fields,
+   * arrays and their nesting) and gathers statistics in a single pass over the buffer, without building the AST.
+   *
+   * The scanner does not check that field values match the field types, so a file which passes the scan may still be
+   * rejected by `VrmlParser`.
+   */
+  class VRMLPROC_API VrmlScanner : public Parser<BufferView, model::VrmlScanStatistics> {
+   public:
+    /**
+     * @brief Scans the VRML 2.0 file.
+     *
+     * @param buffer object containing const char pointers indicating begin and end for const char* to scan
+     * @returns statistics of the file if its structure is valid, otherwise error with the first error position
+     */
+    ParserResult<model::VrmlScanStatistics> Parse(BufferView buffer) override;
+  };
+}  // namespace vrml_proc::parser
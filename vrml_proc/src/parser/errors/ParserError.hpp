@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstddef>
+#include <sstream>
 #include <string>
 
 #include "Error.hpp"
@@ -15,4 +17,49 @@ namespace vrml_proc::parser::error {
              "format!\n";
     }
   };
+
+  /**
+   * @brief Represents a concrete parser error with known position in the input.
+   */
+  class ParserSyntaxError : public ParserError {
+   public:
+    /**
+     * @brief Constructs new error.
+     *
+     * @param offset number of bytes from the start of the input to the error position
+     * @param line line of the error (starting from 1)
+     * @param column column of the error (starting from 1)
+     * @param expected description of what was expected at the error position
+     * @param snippet part of the input line with a caret pointing to the error position
+     */
+    ParserSyntaxError(
+        size_t offset, size_t line, size_t column, const std::string& expected, const std::string& snippet)
+        : m_offset(offset), m_line(line), m_column(column), m_expected(expected), m_snippet(snippet) {}
+
+    size_t GetOffset() const { return m_offset; }
+    size_t GetLine() const { return m_line; }
+    size_t GetColumn() const { return m_column; }
+    const std::string& GetExpected() const { return m_expected; }
+
+   protected:
+    std::string GetMessageInternal() const override {
+      std::ostringstream stream;
+      stream << "[ParserSyntaxError]: expected " << m_expected << " at line " << m_line << ", column " << m_column
+             << " (byte " << m_offset << "):\n";
+
+      std::istringstream snippet(m_snippet);
+      std::string snippetLine;
+      while (std::getline(snippet, snippetLine)) {
+        stream << "    " << snippetLine << "\n";
+      }
+      return stream.str();
+    }
+
+   private:
+    size_t m_offset;
+    size_t m_line;
+    size_t m_column;
+    std::string m_expected;
+    std::string m_snippet;
+  };
 }  // namespace vrml_proc::parser::error
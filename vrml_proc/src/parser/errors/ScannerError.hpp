@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+
+#include "Error.hpp"
+
+namespace vrml_proc::parser::error {
+  /**
+   * @brief Represents a structural error found by `VrmlScanner`.
+   */
+  class ScannerError : public vrml_proc::core::error::Error {
+   public:
+    /**
+     * @brief Constructs new error.
+     *
+     * @param offset number of bytes from the start of the input to the error position
+     * @param line line of the error (starting from 1)
+     * @param column column of the error (starting from 1)
+     * @param message description of the error
+     */
+    ScannerError(size_t offset, size_t line, size_t column, const std::string& message)
+        : m_offset(offset), m_line(line), m_column(column), m_message(message) {}
+
+    size_t GetOffset() const { return m_offset; }
+    size_t GetLine() const { return m_line; }
+    size_t GetColumn() const { return m_column; }
+
+   protected:
+    std::string GetMessageInternal() const override {
+      std::ostringstream stream;
+      stream << "[ScannerError]: invalid VRML structure at line " << m_line << ", column " << m_column << " (byte "
+             << m_offset << "): " << m_message << "\n";
+      return stream.str();
+    }
+
+   private:
+    size_t m_offset;
+    size_t m_line;
+    size_t m_column;
+    std::string m_message;
+  };
+}  // namespace vrml_proc::parser::error
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+
+#include <boost/spirit/include/qi.hpp>
+
+namespace vrml_proc::parser::grammar {
+  /**
+   * @brief Parser which matches text enclosed in `Open` and `Close` characters (e.g. `[ ... ]`), including nested
+   * pairs of them, without interpreting the enclosed text. Comments and quoted strings inside are respected, so they
+   * may contain the enclosing characters. Quoted strings end at the next quote, as in `QuotedStringGrammar`.
+   *
+   * It is a fast replacement of a full grammar for values which do not have to be parsed. Use `qi::raw` to get the
+   * matched text.
+   *
+   * @tparam Open opening character
+   * @tparam Close closing character
+   */
+  template <char Open, char Close>
+  struct BalancedTextParser : boost::spirit::qi::primitive_parser<BalancedTextParser<Open, Close>> {
+    template <typename Context, typename Iterator>
+    struct attribute {
+      typedef boost::spirit::unused_type type;
+    };
+
+    template <typename Iterator, typename Context, typename Skipper, typename Attribute>
+    bool parse(Iterator& first, const Iterator& last, Context&, const Skipper& skipper, Attribute&) const {
+      boost::spirit::qi::skip_over(first, last, skipper);
+      if (first == last || *first != Open) {
+        return false;
+      }
+
+      Iterator current = first;
+      size_t depth = 0;
+      while (current != last) {
+        char character = *current;
+        if (character == Open) {
+          ++depth;
+        } else if (character == Close) {
+          if (--depth == 0) {
+            first = ++current;
+            return true;
+          }
+        } else if (character == '#') {
+          while (current != last && *current != '\n' && *current != '\r') {
+            ++current;
+          }
+          continue;
+        } else if (character == '"') {
+          do {
+            ++current;
+          } while (current != last && *current != '"');
+          if (current == last) {
+            break;
+          }
+        }
+        ++current;
+      }
+
+      return false;
+    }
+
+    template <typename Context>
+    boost::spirit::info what(Context&) const {
+      return boost::spirit::info("balanced text");
+    }
+  };
+}  // namespace vrml_proc::parser::grammar
@@ -1,12 +1,17 @@
 #pragma once
 
+#include <optional>
+#include <sstream>
+#include <string>
+
 #include <boost/spirit/include/qi.hpp>
 
 namespace vrml_proc::parser::grammar {
   /**
    * @brief Represents a base grammar.
-   * Each derived grammar has to implement ` GetStartRule()` method. Base grammar should also store
-   * information about an error encountered in any grammara while parsing (not implemented yet).
+   * Each derived grammar has to implement ` GetStartRule()` method. Base grammar also stores information about an
+   * error encountered while parsing: position in the input and description of what was expected there. The error is
+   * recorded by `on_error` handlers of derived grammars when an expectation point (`>`) fails.
    *
    * @tparam Iterator type of iteraror used, e.g. const char* iterator
    * @tparam ReturnType type of result grammar will return
@@ -19,14 +24,58 @@ namespace vrml_proc::parser::grammar {
     virtual ~BaseGrammar() = default;
     boost::spirit::qi::rule<Iterator, ReturnType, Skipper> const& GetStartRule() const { return m_start; }
 
+    /**
+     * @brief Checks if an error was recorded during the last parsing.
+     *
+     * @returns true if error was recorded, otherwise false
+     */
+    bool HasError() const { return m_errorPosition.has_value(); }
+
+    /**
+     * @brief Gets the position in the input where the last recorded error occured.
+     *
+     * @returns error position or empty optional if no error was recorded
+     */
+    const std::optional<Iterator>& GetErrorPosition() const { return m_errorPosition; }
+
+    /**
+     * @brief Gets the description of the rule expected at the error position, e.g. `"}"` or `<field value>`.
+     *
+     * @returns description of the expected rule, empty if no error was recorded
+     */
+    const std::string& GetExpected() const { return m_expected; }
+
+    /**
+     * @brief Forgets the recorded error. Should be called before the grammar is reused for new input.
+     */
+    void ResetError() {
+      m_errorPosition.reset();
+      m_expected.clear();
+    }
+
    protected:
     BaseGrammar() = default;
     boost::spirit::qi::rule<Iterator, ReturnType, Skipper> m_start;
-    bool HasError() const { return m_hasError; }
-    void SetError(bool value) { m_hasError = value; }
+
+    /**
+     * @brief Records the error. Only the first error since the last reset is kept.
+     *
+     * @param position position of the error in the input
+     * @param expected info object of the expected rule
+     */
+    void SetError(Iterator position, const boost::spirit::info& expected) {
+      if (m_errorPosition.has_value()) {
+        return;
+      }
+      std::ostringstream stream;
+      stream << expected;
+      m_errorPosition = position;
+      m_expected = stream.str();
+    }
 
    private:
-    bool m_hasError = false;
+    std::optional<Iterator> m_errorPosition;
+    std::string m_expected;
     BaseGrammar(const BaseGrammar&) = delete;
     BaseGrammar& operator=(const BaseGrammar&) = delete;
     BaseGrammar(BaseGrammar&&) = delete;
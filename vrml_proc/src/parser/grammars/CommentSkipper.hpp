@@ -1,33 +1,54 @@
 #pragma once
 
-#include <string>
-
 #include <boost/spirit/include/qi.hpp>
 
 namespace vrml_proc::parser::grammar {
   /**
-   * @brief Rule to skip VRML 2.0 comments and irrelevant input such as whitespaces.
+   * @brief Primitive parser to skip VRML 2.0 comments and irrelevant input such as whitespaces.
+   *
+   * It is invoked between every two tokens, so instead of a grammar (`ascii::space | singleLineComment`) matching one
+   * character per call through a `qi::rule`, it is a primitive parser consuming the whole run of whitespaces and
+   * comments in one tight loop. Comma is not skipped although VRML 2.0 treats it as a whitespace, grammars of arrays
+   * use it as a separator.
    *
    * Modelled for const char* Iterator type.
    */
-  struct CommentSkipper : boost::spirit::qi::grammar<const char*> {
+  struct CommentSkipper : boost::spirit::qi::primitive_parser<CommentSkipper> {
+    template <typename Context, typename Iterator>
+    struct attribute {
+      typedef boost::spirit::unused_type type;
+    };
+
     /**
-     * @brief Rule for VRML 2.0 comments and whitespaces.
+     * @brief Skips all whitespaces and comments starting at `first`. Comment starts with `#` and ends with the end of
+     * line or the end of input.
+     *
+     * @returns true if at least one character was skipped, otherwise false
      */
-    CommentSkipper() : CommentSkipper::base_type(start) {
-      /**
-       * @note Inspired by
-       * https://stackoverflow.com/questions/44529864/how-to-skip-line-block-nested-block-comments-in-boost-spirit..
-       */
-      singleLineComment = '#' >> *(boost::spirit::qi::char_ - boost::spirit::qi::eol) >>
-                          (boost::spirit::qi::eol | boost::spirit::qi::eoi);
-      start = boost::spirit::ascii::space | singleLineComment;
+    template <typename Iterator, typename Context, typename Skipper, typename Attribute>
+    bool parse(Iterator& first, const Iterator& last, Context&, const Skipper&, Attribute&) const {
+      Iterator current = first;
+      while (current != last) {
+        char character = *current;
+        if (character == ' ' || (character >= '\t' && character <= '\r')) {
+          ++current;
+        } else if (character == '#') {
+          do {
+            ++current;
+          } while (current != last && *current != '\n' && *current != '\r');
+        } else {
+          break;
+        }
+      }
 
-      BOOST_SPIRIT_DEBUG_NODE(singleLineComment);
-      BOOST_SPIRIT_DEBUG_NODE(start);
+      bool skipped = (current != first);
+      first = current;
+      return skipped;
     }
 
-    boost::spirit::qi::rule<const char*> singleLineComment;
-    boost::spirit::qi::rule<const char*> start;
+    template <typename Context>
+    boost::spirit::info what(Context&) const {
+      return boost::spirit::info("comment-skipper");
+    }
   };
 }  // namespace vrml_proc::parser::grammar
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "NodeDescriptorFieldType.hpp"
+
+namespace vrml_proc::parser::grammar {
+  /**
+   * @brief Represents types of all fields of one node type, keyed by field name.
+   */
+  using NodeFieldTypes = std::unordered_map<std::string, vrml_proc::traversor::node_descriptor::FieldType>;
+
+  /**
+   * @brief Represents types of fields of all known node types, keyed by node header.
+   *
+   * The schema is used by `VrmlFileGrammar` to parse value of a known field by exactly one sub-grammar instead of
+   * trying all of them in turn.
+   */
+  using FieldTypeSchema = std::unordered_map<std::string, NodeFieldTypes>;
+
+  /**
+   * @brief Represents names of fields which are skipped by the parser, keyed by node header.
+   */
+  using SkippedFields = std::unordered_map<std::string, std::unordered_set<std::string>>;
+
+  /**
+   * @brief Adds field written as `Header.field` into skipped fields. Entries without a dot are ignored.
+   *
+   * @param skippedFields skipped fields
+   * @param field field written as `Header.field`
+   */
+  inline void AddSkippedField(SkippedFields& skippedFields, std::string_view field) {  //
+
+    auto dot = field.find('.');
+    if (dot == std::string_view::npos) {
+      return;
+    }
+    skippedFields[std::string(field.substr(0, dot))].emplace(field.substr(dot + 1));
+  }
+}  // namespace vrml_proc::parser::grammar
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <boost/fusion/adapted/struct/adapt_struct.hpp>
+#include <boost/spirit/include/qi.hpp>
+
+#include "BaseGrammar.hpp"
+#include "Float32Array.hpp"
+#include "VrmlUnits.hpp"
+
+BOOST_FUSION_ADAPT_STRUCT(
+    vrml_proc::parser::model::Float32Array, (std::vector<vrml_proc::parser::model::float32_t>, values))
+
+namespace vrml_proc::parser::grammar {
+  /**
+   * @brief Grammar for parsing MF type of Float32 values in VRML 2.0 syntax. Values may be separated by commas or only
+   * by whitespaces.
+   *
+   * @tparam Iterator The iterator type used for parsing input.
+   * @tparam Skipper  The skipper parser used to skip irrelevant input (e.g., whitespace).
+   */
+  template <typename Iterator, typename Skipper>
+  class Float32ArrayGrammar : public boost::spirit::qi::grammar<Iterator, model::Float32Array(), Skipper>,
+                              public BaseGrammar<Iterator, model::Float32Array(), Skipper> {
+   public:
+    /**
+     * @brief Constructs new grammar and initializes parsing rules.
+     */
+    Float32ArrayGrammar() : Float32ArrayGrammar::base_type(this->m_start) {  //
+
+      using boost::spirit::qi::lit;
+
+      this->m_start = lit('[') >> -((boost::spirit::qi::float_ % -lit(',')) >> -lit(',')) >> lit(']');
+
+      BOOST_SPIRIT_DEBUG_NODE(this->m_start);
+    }
+  };
+}  // namespace vrml_proc::parser::grammar
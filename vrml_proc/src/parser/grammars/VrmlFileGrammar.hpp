@@ -1,7 +1,13 @@
 #pragma once
 
+#include <array>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #define BOOST_SPIRIT_USE_PHOENIX_V3
 #include <boost/phoenix/phoenix.hpp>
@@ -13,6 +19,7 @@
 #include <boost/variant/variant.hpp>
 #include <boost/variant/recursive_wrapper.hpp>
 
+#include "UnparsedValue.hpp"
 #include "VrmlField.hpp"
 #include "VrmlFile.hpp"
 #include "VrmlNode.hpp"
@@ -25,9 +32,13 @@
 #include "Vec3fArrayGrammar.hpp"
 #include "Vec4fGrammar.hpp"
 #include "Int32ArrayGrammar.hpp"
+#include "Float32ArrayGrammar.hpp"
 #include "QuotedStringGrammar.hpp"
 #include "BooleanGrammar.hpp"
+#include "BalancedTextParser.hpp"
 #include "BaseGrammar.hpp"
+#include "FieldTypeSchema.hpp"
+#include "NodeDescriptorFieldType.hpp"
 
 BOOST_FUSION_ADAPT_STRUCT(vrml_proc::parser::model::VrmlNode,
     (boost::optional<std::string>, definitionName)(std::string, header)(
@@ -52,6 +63,15 @@ namespace vrml_proc::parser::grammar {
   /**
    * @brief Grammar for parsing VRML 2.0 file.
    *
+   * By default, a field value is parsed by trying all value sub-grammars in turn. If a field type schema is set, value
+   * of a field whose type is known for the node header is parsed by the sub-grammar of that type first. The typed value
+   * is taken only if the field ends right after it (the next field name or `}` follows), otherwise the value is parsed
+   * by the ordered alternative of all sub-grammars, which is also used for unknown nodes and fields. Thus the schema
+   * never rejects a file which is accepted without it. It may accept more (e.g. Float32Array values without brackets)
+   * and a value may get the type of its field instead of the first matching one (e.g. `[ 0 1 2 ]` of an Int32Array
+   * field is not parsed as Vec3fArray). Array values of selected fields may be skipped without parsing (see
+   * `SetFieldTypeSchema()`), as well as bodies of nodes with selected headers (see `SetPrunedHeaders()`).
+   *
    * @tparam Iterator The iterator type used for parsing input.
    * @tparam Skipper  The skipper parser used to skip irrelevant input (e.g., whitespace).
    */
@@ -64,6 +84,13 @@ namespace vrml_proc::parser::grammar {
      */
     VrmlFileGrammar() : VrmlFileGrammar::base_type(this->m_start) {  //
 
+      using boost::spirit::qi::_1;
+      using boost::spirit::qi::_a;
+      using boost::spirit::qi::_b;
+      using boost::spirit::qi::_c;
+      using boost::spirit::qi::_r1;
+      using boost::spirit::qi::_val;
+
       m_identifier = std::make_unique<IdentifierGrammar<Iterator, Skipper>>();
 
       m_quotedString = std::make_unique<QuotedStringGrammar<Iterator, Skipper>>();
@@ -80,38 +107,382 @@ namespace vrml_proc::parser::grammar {
 
       m_int32Array = std::make_unique<Int32ArrayGrammar<Iterator, Skipper>>();
 
+      m_float32Array = std::make_unique<Float32ArrayGrammar<Iterator, Skipper>>();
+
       m_boolean = std::make_unique<BooleanGrammar<Iterator, Skipper>>();
 
+      /**
+       * Float32Array is tried only after all other numeric arrays, as it matches any of them. Thus it holds only
+       * arrays of floats which are not lists of Vec3f or Vec2f (e.g. `height` of ElevationGrid with whitespace
+       * separated values).
+       */
       m_vrmlFieldValue = (m_quotedString->GetStartRule() | m_boolean->GetStartRule() | m_vec3fArray->GetStartRule() |
-                          m_vec2fArray->GetStartRule() | m_int32Array->GetStartRule() | m_vec4f->GetStartRule() |
-                          m_vec3f->GetStartRule() | m_vec2f->GetStartRule() |
+                          m_vec2fArray->GetStartRule() | m_int32Array->GetStartRule() |
+                          m_float32Array->GetStartRule() | m_vec4f->GetStartRule() | m_vec3f->GetStartRule() |
+                          m_vec2f->GetStartRule() |
                           boost::spirit::qi::real_parser<model::float32_t, Float32Policy>() | boost::spirit::qi::int_ |
                           m_useNode | m_vrmlNode | m_vrmlNodeArray);
 
-      m_vrmlField = (m_identifier->GetStartRule() >> m_vrmlFieldValue);
+      /**
+       * Header of a node and name of a field select the rule parsing the field value (see `SelectFieldValueRule()`).
+       * The selected rule is stored in a local and invoked lazily.
+       */
+      auto selectFieldValueRule = boost::phoenix::bind(&VrmlFileGrammar::SelectFieldValueRule, this, _r1, _1);
+      m_vrmlField %= (m_identifier->GetStartRule()[_a = selectFieldValueRule] > boost::spirit::qi::lazy(*_a));
+
+      /**
+       * Expectation points (`>`) are placed only where the input is already committed to one alternative: after a
+       * field name a value must follow, after `{` of a node its fields and `}` must follow, etc. When such point
+       * fails, the handler at the start rule records the position and the expected rule. Backtracking of the
+       * alternatives in `m_vrmlFieldValue` is not affected and successful parsing pays nothing extra.
+       */
+      m_vrmlNodeBody = (boost::spirit::qi::lit("{") > *(m_vrmlField(_r1)) > boost::spirit::qi::lit("}"));
+
+      /**
+       * Body of a node with pruned header is only matched by braces and kept as a stub (see `SetPrunedHeaders()`).
+       * Members of the node are set by semantic actions, as the node has either fields or the skipped body. Fields
+       * are moved into the node, not copied. Number of DEF and USE nodes parsed before the body is stored in a local,
+       * so that the node knows if there is a DEF or USE node among its descendants.
+       */
+      m_prunedNodeBody = boost::spirit::qi::raw[BalancedTextParser<'{', '}'>()]
+                                               [(boost::spirit::qi::_pass = boost::phoenix::bind(
+                                                     &VrmlFileGrammar::HasNoDefinition, boost::spirit::qi::_1),
+                                                   boost::spirit::qi::_val = boost::phoenix::bind(
+                                                       &VrmlFileGrammar::CreateUnparsedValue, boost::spirit::qi::_1))];
+
+      auto setDefinitionName = boost::phoenix::bind(&VrmlFileGrammar::SetDefinitionName, this, _val, _1);
+      auto setHeader = boost::phoenix::bind(&VrmlFileGrammar::SetHeader, _val, _1);
+      auto findNodeFieldRules = boost::phoenix::bind(&VrmlFileGrammar::FindNodeFieldRules, this, _1);
+      auto isPruned = boost::phoenix::bind(&VrmlFileGrammar::IsPruned, this, _1);
+      auto referenceCount = boost::phoenix::bind(&VrmlFileGrammar::GetReferenceCount, this);
+      auto setSkippedBody = boost::phoenix::bind(&VrmlFileGrammar::SetSkippedBody, _val, _1);
+      auto setFields = boost::phoenix::bind(&VrmlFileGrammar::SetFields, this, _val, _1, _c);
+      m_vrmlNode = (-(boost::spirit::qi::lit("DEF") >> m_identifier->GetStartRule())[setDefinitionName] >>
+                    m_identifier->GetStartRule()
+                        [(_a = findNodeFieldRules, _b = isPruned, _c = referenceCount, setHeader)] >>
+                    ((boost::spirit::qi::eps(_b) >> m_prunedNodeBody[setSkippedBody]) |
+                        m_vrmlNodeBody(_a)[setFields]));
 
-      m_vrmlNode = (-(boost::spirit::qi::lit("DEF") >> m_identifier->GetStartRule()) >> m_identifier->GetStartRule() >>
-                    boost::spirit::qi::lit("{") >> *(m_vrmlField) >> boost::spirit::qi::lit("}"));
+      m_vrmlNodeArrayItems = (m_vrmlNode | m_useNode) % ",";
 
-      m_vrmlNodeArray = "[" >> ((m_vrmlNode | m_useNode) % ",") >> "]";
+      m_vrmlNodeArray = boost::spirit::qi::lit("[") > m_vrmlNodeArrayItems > boost::spirit::qi::lit("]");
 
-      m_useNode = boost::spirit::qi::lit("USE") >> m_identifier->GetStartRule();
+      auto countReference = boost::phoenix::bind(&VrmlFileGrammar::CountReference, this);
+      m_useNode %= boost::spirit::qi::lit("USE") >> m_identifier->GetStartRule()[countReference];
 
-      this->m_start = boost::spirit::qi::skip(boost::spirit::ascii::space)[boost::spirit::qi::lit("#VRML V2.0 utf8")] >>
-                      *(m_vrmlNode);
+      InitTypedFieldValueRules();
+
+      m_header = boost::spirit::qi::skip(boost::spirit::ascii::space)[boost::spirit::qi::lit("#VRML V2.0 utf8")];
+
+      m_endOfInput = boost::spirit::qi::eoi;
+
+      /**
+       * Root node is moved into the file as soon as it is parsed. Its descendants do not move any more, so DEF and USE
+       * nodes among them are collected right away (see `GetReferences()`).
+       */
+      auto addRootNode = boost::phoenix::bind(&VrmlFileGrammar::AddRootNode, this, _val, _1);
+      this->m_start = boost::spirit::qi::no_skip[boost::spirit::qi::eps] > m_header > *(m_vrmlNode[addRootNode]) >
+                      m_endOfInput;
+
+      boost::spirit::qi::on_error<boost::spirit::qi::fail>(this->m_start,
+          boost::phoenix::bind(&VrmlFileGrammar::SetError, this, boost::spirit::qi::_3, boost::spirit::qi::_4));
 
       BOOST_SPIRIT_DEBUG_NODE(this->m_start);
       BOOST_SPIRIT_DEBUG_NODE(m_vrmlFieldValue);
       BOOST_SPIRIT_DEBUG_NODE(m_vrmlField);
       BOOST_SPIRIT_DEBUG_NODE(m_vrmlNode);
+
+      /** Names are used in error messages, they must be set after the debug nodes which also set names. */
+      m_vrmlFieldValue.name("field value");
+      m_vrmlField.name("field");
+      m_vrmlNode.name("node");
+      m_vrmlNodeArrayItems.name("array of numbers or nodes");
+      m_header.name("header '#VRML V2.0 utf8'");
+      m_endOfInput.name("node or end of input");
     }
 
+    /**
+     * @brief Sets the field type schema used to select the sub-grammar of a field value.
+     *
+     * Numeric array values of `skippedFields` are not parsed at all. They are matched by brackets only and stored as
+     * `UnparsedValue`. Fields of other types are parsed even if they are listed.
+     *
+     * @param schema schema, nullptr turns the schema-aware parsing off
+     * @param skippedFields fields whose array values are not parsed, keyed by node header
+     */
+    void SetFieldTypeSchema(const FieldTypeSchema* schema, const SkippedFields& skippedFields = {}) {  //
+
+      m_nodeFieldRules.clear();
+      if (schema == nullptr) {
+        return;
+      }
+
+      for (const auto& [header, fieldTypes] : *schema) {
+        auto skipped = skippedFields.find(header);
+        auto& rules = m_nodeFieldRules[header];
+        for (const auto& [name, type] : fieldTypes) {
+          bool skip = skipped != skippedFields.end() && skipped->second.contains(name) && IsNumericArray(type);
+          rules[name] = skip ? &m_skippedFieldValues[static_cast<size_t>(type)] : &TypedRule(type);
+        }
+      }
+    }
+
+    /**
+     * @brief Sets headers of nodes whose bodies are not parsed. Body of such node is only matched by braces and the
+     * node is kept as a stub with the skipped body (see `VrmlNode::IsPruned()`). Headers are compared as written, so
+     * synonyms must be listed as well.
+     *
+     * Body containing a DEF node is parsed as usual, so that all DEF nodes of the file are known.
+     *
+     * @param headers pruned headers, empty set turns the pruning off
+     */
+    void SetPrunedHeaders(const std::unordered_set<std::string>& headers) { m_prunedHeaders = headers; }
+
+    /**
+     * @brief Represents a DEF or USE node found during parsing. Root node is identified by its index in the file, as
+     * its address changes while the file grows. Other nodes do not move once their root node is parsed.
+     */
+    struct Reference {
+      /** @brief DEF node, nullptr for root node or USE node. */
+      const model::VrmlNode* node;
+      /** @brief USE node, nullptr for DEF node. */
+      model::UseNode* use;
+      /** @brief Index of the root DEF node in the file. */
+      size_t rootIndex;
+    };
+
+    /**
+     * @brief Gets DEF and USE nodes found by the last parsing, in the order in which they appear in the file. They
+     * are valid only if the parsing was successful and as long as the parsed file exists.
+     *
+     * @returns DEF and USE nodes
+     */
+    const std::vector<Reference>& GetReferences() const { return m_references; }
+
+    /**
+     * @brief Clears DEF and USE nodes found by the last parsing. Must be called before each parsing.
+     */
+    void ClearReferences() { m_references.clear(); }
+
    private:
-    boost::spirit::qi::rule<Iterator, model::VrmlNode(), Skipper> m_vrmlNode;
+    using FieldValueRule = boost::spirit::qi::rule<Iterator, model::VrmlFieldValue(), Skipper>;
+    using FieldType = vrml_proc::traversor::node_descriptor::FieldType;
+    using NodeFieldRules = std::unordered_map<std::string, const FieldValueRule*>;
+    /** Rules parsing the fields of the node, flag indicating that the node is pruned and number of DEF/USE nodes. */
+    using NodeLocals = boost::spirit::qi::locals<const NodeFieldRules*, bool, size_t>;
+
+    static bool IsNumericArray(FieldType type) {
+      return type == FieldType::Vec2fArray || type == FieldType::Vec3fArray || type == FieldType::Int32Array ||
+             type == FieldType::Float32Array;
+    }
+
+    static model::UnparsedValue CreateUnparsedValue(const boost::iterator_range<Iterator>& range) {
+      return model::UnparsedValue(std::string(&*range.begin(), static_cast<size_t>(range.size())));
+    }
+
+    /**
+     * Checks that skipped text does not contain a DEF node. Any occurrence of `DEF` counts (even inside a string,
+     * comment or a longer word), which only makes the body parsed when it need not be.
+     */
+    static bool HasNoDefinition(const boost::iterator_range<Iterator>& range) {  //
+
+      return std::string_view(&*range.begin(), static_cast<size_t>(range.size())).find("DEF") ==
+             std::string_view::npos;
+    }
+
+    void SetDefinitionName(model::VrmlNode& node, std::string& name) {
+      node.definitionName = std::move(name);
+      m_referenceCount++;
+    }
+
+    void CountReference() { m_referenceCount++; }
+
+    size_t GetReferenceCount() const { return m_referenceCount; }
+
+    static void SetHeader(model::VrmlNode& node, std::string& header) { node.header = std::move(header); }
+
+    /**
+     * The count includes DEF and USE nodes of backtracked alternatives, so `containsReferences` may be set even if
+     * there is no DEF or USE node among the descendants, but never the other way round.
+     */
+    void SetFields(model::VrmlNode& node, std::vector<model::VrmlField>& fields, size_t referenceCount) {
+      node.fields.swap(fields);
+      node.containsReferences = m_referenceCount != referenceCount;
+    }
+
+    static void SetSkippedBody(model::VrmlNode& node, model::UnparsedValue& body) {
+      node.skippedBody = std::move(body);
+      node.containsReferences = false;
+    }
+
+    void AddRootNode(model::VrmlFile& file, model::VrmlNode& node) {  //
+
+      file.push_back(std::move(node));
+      model::VrmlNode& root = file.back();
+      if (HasDefinitionName(root)) {
+        m_references.push_back({nullptr, nullptr, file.size() - 1});
+      }
+      CollectReferences(root);
+    }
+
+    /**
+     * Collects DEF and USE nodes among descendants of the node in pre-order, i.e. in the order in which they appear
+     * in the file. Subtrees without DEF and USE nodes are not visited.
+     */
+    void CollectReferences(model::VrmlNode& node) {  //
+
+      if (!node.containsReferences) {
+        return;
+      }
+
+      auto collect = [this](model::VrmlNode& child) {
+        if (HasDefinitionName(child)) {
+          m_references.push_back({&child, nullptr, 0});
+        }
+        CollectReferences(child);
+      };
+
+      for (auto& field : node.fields) {
+        if (auto* child = boost::get<model::VrmlNode>(&field.value)) {
+          collect(*child);
+        } else if (auto* use = boost::get<model::UseNode>(&field.value)) {
+          m_references.push_back({nullptr, use, 0});
+        } else if (auto* children = boost::get<model::VrmlNodeArray>(&field.value)) {
+          for (auto& item : *children) {
+            if (auto* child = boost::get<model::VrmlNode>(&item)) {
+              collect(*child);
+            } else if (auto* use = boost::get<model::UseNode>(&item)) {
+              m_references.push_back({nullptr, use, 0});
+            }
+          }
+        }
+      }
+    }
+
+    static bool HasDefinitionName(const model::VrmlNode& node) {
+      return node.definitionName.has_value() && !node.definitionName.value().empty();
+    }
+
+    bool IsPruned(const std::string& header) const {
+      return !m_prunedHeaders.empty() && m_prunedHeaders.contains(header);
+    }
+
+    /**
+     * Every typed rule tries the sub-grammar of its type first and falls back to the generic alternative. The typed
+     * value must be followed by the end of the field, so a value of another shape whose prefix matches the type (e.g.
+     * `0.5 0.5 0.5` of a Float32 field) is parsed by the generic alternative as a whole, exactly as without the schema.
+     * Values which are valid for the type never reach the fallback, except for empty arrays where the sub-grammar
+     * requires at least one element (e.g. `Int32Array`) and integers of Float32 fields, which are parsed as integers by
+     * both.
+     */
+    void InitTypedFieldValueRules() {  //
+
+      using boost::spirit::qi::char_;
+      using boost::spirit::qi::lit;
+
+      m_vrmlNodeArrayOrEmpty = lit("[") >> (m_vrmlNodeArrayItems | boost::spirit::qi::eps) >> lit("]");
+
+      m_int32 = boost::spirit::qi::lexeme[boost::spirit::qi::int_ >> !char_(".eE")];
+
+      /** Field value is followed by `}` or by the first character of the next field name (see `IdentifierGrammar`). */
+      m_fieldValueEnd = &(lit("}") | (char_ - (char_(0x00, 0x20) | char_(0x30, 0x39) | char_("\"'+,-.[]{}\\"))));
+
+      TypedRule(FieldType::Unknown) = m_vrmlFieldValue;
+      SetTypedRule(FieldType::Bool, m_boolean->GetStartRule());
+      SetTypedRule(FieldType::String, m_quotedString->GetStartRule());
+      SetTypedRule(FieldType::Float32, boost::spirit::qi::real_parser<model::float32_t, Float32Policy>());
+      SetTypedRule(FieldType::Int32, m_int32);
+      SetTypedRule(FieldType::Vec2f, m_vec2f->GetStartRule());
+      SetTypedRule(FieldType::Vec3f, m_vec3f->GetStartRule());
+      SetTypedRule(FieldType::Vec4f, m_vec4f->GetStartRule());
+      SetTypedRule(FieldType::Vec2fArray, m_vec2fArray->GetStartRule());
+      SetTypedRule(FieldType::Vec3fArray, m_vec3fArray->GetStartRule());
+      SetTypedRule(FieldType::Int32Array, m_int32Array->GetStartRule());
+      /**
+       * Any numeric value of a Float32Array field is parsed as Float32Array, so that it is never converted (and
+       * copied) later. Value of a single element may be written without brackets, e.g. `scale 1 1` of Extrusion.
+       */
+      m_bareFloat32Array = boost::spirit::qi::eps >> +boost::spirit::qi::float_;
+      SetTypedRule(FieldType::Float32Array, m_float32Array->GetStartRule() | m_bareFloat32Array);
+      SetTypedRule(FieldType::Node, m_useNode | m_vrmlNode);
+      SetTypedRule(FieldType::NodeArray, m_vrmlNodeArrayOrEmpty);
+
+      /** Skipped array which is not enclosed in brackets (single value) is parsed as usual. */
+      m_unparsedArray = boost::spirit::qi::raw[BalancedTextParser<'[', ']'>()]
+                                              [boost::spirit::qi::_val = boost::phoenix::bind(
+                                                   &VrmlFileGrammar::CreateUnparsedValue, boost::spirit::qi::_1)];
+      for (FieldType type : {FieldType::Vec2fArray, FieldType::Vec3fArray, FieldType::Int32Array,
+               FieldType::Float32Array}) {
+        m_skippedFieldValues[static_cast<size_t>(type)] = m_unparsedArray | TypedRule(type);
+      }
+    }
+
+    FieldValueRule& TypedRule(FieldType type) { return m_typedFieldValues[static_cast<size_t>(type)]; }
+
+    /**
+     * @brief Sets the rule of the field type to the sub-grammar followed by the end of the field, with the generic
+     * alternative as a fallback. The sub-grammar is wrapped in its own rule, so that its attribute is converted to
+     * the field value before the end of the field is matched.
+     */
+    template <typename Parser>
+    void SetTypedRule(FieldType type, const Parser& parser) {  //
+
+      FieldValueRule& value = m_typedValuesOnly[static_cast<size_t>(type)];
+      value = parser;
+      TypedRule(type) = (value >> m_fieldValueEnd) | m_vrmlFieldValue;
+    }
+
+    /**
+     * @brief Finds rules parsing the fields of the node header.
+     *
+     * @returns rules or nullptr if the schema is not set or the node is unknown
+     */
+    const NodeFieldRules* FindNodeFieldRules(const std::string& header) const {  //
+
+      auto it = m_nodeFieldRules.find(header);
+      return it != m_nodeFieldRules.end() ? &it->second : nullptr;
+    }
+
+    /**
+     * @brief Selects the rule parsing value of the field.
+     *
+     * @returns rule of the field if it is known, otherwise the generic alternative
+     */
+    const FieldValueRule* SelectFieldValueRule(const NodeFieldRules* fieldRules, const std::string& name) const {  //
+
+      if (fieldRules == nullptr) {
+        return &m_vrmlFieldValue;
+      }
+      auto it = fieldRules->find(name);
+      return it != fieldRules->end() ? it->second : &m_vrmlFieldValue;
+    }
+
+    boost::spirit::qi::rule<Iterator, model::VrmlNode(), Skipper, NodeLocals> m_vrmlNode;
     boost::spirit::qi::rule<Iterator, model::UseNode(), Skipper> m_useNode;
-    boost::spirit::qi::rule<Iterator, model::VrmlField(), Skipper> m_vrmlField;
-    boost::spirit::qi::rule<Iterator, model::VrmlFieldValue(), Skipper> m_vrmlFieldValue;
+    boost::spirit::qi::rule<Iterator,
+        model::VrmlField(const NodeFieldRules*),
+        Skipper,
+        boost::spirit::qi::locals<const FieldValueRule*>>
+        m_vrmlField;
+    FieldValueRule m_vrmlFieldValue;
+    boost::spirit::qi::rule<Iterator, model::Float32Array(), Skipper> m_bareFloat32Array;
     boost::spirit::qi::rule<Iterator, model::VrmlNodeArray(), Skipper> m_vrmlNodeArray;
+    boost::spirit::qi::rule<Iterator, model::VrmlNodeArray(), Skipper> m_vrmlNodeArrayItems;
+    boost::spirit::qi::rule<Iterator, model::VrmlNodeArray(), Skipper> m_vrmlNodeArrayOrEmpty;
+    boost::spirit::qi::rule<Iterator, int32_t(), Skipper> m_int32;
+    boost::spirit::qi::rule<Iterator, Skipper> m_fieldValueEnd;
+    boost::spirit::qi::rule<Iterator, model::UnparsedValue(), Skipper> m_unparsedArray;
+    boost::spirit::qi::rule<Iterator, model::UnparsedValue(), Skipper> m_prunedNodeBody;
+    boost::spirit::qi::rule<Iterator, std::vector<model::VrmlField>(const NodeFieldRules*), Skipper> m_vrmlNodeBody;
+    std::array<FieldValueRule, static_cast<size_t>(FieldType::NodeArray) + 1> m_typedValuesOnly;
+    std::array<FieldValueRule, static_cast<size_t>(FieldType::NodeArray) + 1> m_typedFieldValues;
+    std::array<FieldValueRule, static_cast<size_t>(FieldType::NodeArray) + 1> m_skippedFieldValues;
+    std::unordered_map<std::string, NodeFieldRules> m_nodeFieldRules;
+    std::unordered_set<std::string> m_prunedHeaders;
+    std::vector<Reference> m_references;
+    size_t m_referenceCount = 0;
+    boost::spirit::qi::rule<Iterator, Skipper> m_header;
+    boost::spirit::qi::rule<Iterator, Skipper> m_endOfInput;
 
     std::unique_ptr<IdentifierGrammar<Iterator, Skipper>> m_identifier;
     std::unique_ptr<Vec2fGrammar<Iterator, Skipper>> m_vec2f;
@@ -120,6 +491,7 @@ namespace vrml_proc::parser::grammar {
     std::unique_ptr<Vec2fArrayGrammar<Iterator, Skipper>> m_vec2fArray;
     std::unique_ptr<Vec3fArrayGrammar<Iterator, Skipper>> m_vec3fArray;
     std::unique_ptr<Int32ArrayGrammar<Iterator, Skipper>> m_int32Array;
+    std::unique_ptr<Float32ArrayGrammar<Iterator, Skipper>> m_float32Array;
     std::unique_ptr<QuotedStringGrammar<Iterator, Skipper>> m_quotedString;
     std::unique_ptr<BooleanGrammar<Iterator, Skipper>> m_boolean;
   };
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <vector>
+
+#include "VrmlUnits.hpp"
+
+namespace vrml_proc::parser::model {
+  /**
+   * @brief Represents MF field containing list of floats.
+   */
+  struct Float32Array {
+    Float32Array() : values({}) {}
+
+    std::vector<float32_t> values;
+  };
+}  // namespace vrml_proc::parser::model
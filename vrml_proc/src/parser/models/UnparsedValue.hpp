@@ -0,0 +1,16 @@
+#pragma once
+
+#include <string>
+#include <utility>
+
+namespace vrml_proc::parser::model {
+  /**
+   * @brief Represents a field value (or a node body) which was skipped by the parser. It holds a copy of the skipped
+   * text, so it stays valid after the parsed buffer is released (e.g. the file is unmapped).
+   */
+  struct UnparsedValue {
+    UnparsedValue() : text() {}
+    UnparsedValue(std::string t) : text(std::move(t)) {}
+    std::string text;
+  };
+}  // namespace vrml_proc::parser::model
@@ -3,11 +3,21 @@
 #include <string>
 
 namespace vrml_proc::parser::model {
+  struct VrmlNode;
+
   /**
    * @brief Represents a VRML 2.0 USE node.
    */
   struct UseNode {
     UseNode() : identifier("") {}
     std::string identifier;
+    /**
+     * @brief DEF node linked by the parser (the last one of the name before this node), nullptr if not linked.
+     *
+     * The DEF node is owned by the `VrmlFile` both nodes were parsed into, so the pointer is valid only while the file
+     * is alive. The file cannot be copied and moving it keeps the nodes in place. A USE node copied out of the file
+     * keeps pointing into the original file.
+     */
+    const VrmlNode* definition = nullptr;
   };
 }  // namespace vrml_proc::parser::model
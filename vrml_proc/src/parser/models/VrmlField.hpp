@@ -6,7 +6,9 @@
 #include <boost/variant.hpp>
 #include <boost/variant/recursive_wrapper.hpp>
 
+#include "Float32Array.hpp"
 #include "Int32Array.hpp"
+#include "UnparsedValue.hpp"
 #include "UseNode.hpp"
 #include "Vec2f.hpp"
 #include "Vec2fArray.hpp"
@@ -36,6 +38,7 @@ namespace vrml_proc::parser::model {
       Vec3fArray,
       Vec2fArray,
       Int32Array,
+      Float32Array,
       float32_t,
       int32_t,
       Vec4f,
@@ -43,7 +46,8 @@ namespace vrml_proc::parser::model {
       Vec2f,
       UseNode,
       boost::recursive_wrapper<struct VrmlNode>,
-      VrmlNodeArray>;
+      VrmlNodeArray,
+      UnparsedValue>;
 
   /**
    * @brief Represents a VRML field.
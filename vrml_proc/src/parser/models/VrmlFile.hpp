@@ -7,6 +7,17 @@
 namespace vrml_proc::parser::model {
   /**
    * @brief Represents a VRML file: list of any number of root nodes.
+   *
+   * The file is move-only. Its USE nodes point to DEF nodes stored inside the file (see `UseNode::definition`), so a
+   * copy would still point into the original. Moving keeps the nodes at their addresses, so the links stay valid.
    */
-  using VrmlFile = std::vector<VrmlNode>;
+  struct VrmlFile : public std::vector<VrmlNode> {
+    using std::vector<VrmlNode>::vector;
+
+    VrmlFile() = default;
+    VrmlFile(const VrmlFile&) = delete;
+    VrmlFile& operator=(const VrmlFile&) = delete;
+    VrmlFile(VrmlFile&&) = default;
+    VrmlFile& operator=(VrmlFile&&) = default;
+  };
 }  // namespace vrml_proc::parser::model
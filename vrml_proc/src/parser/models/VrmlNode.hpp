@@ -5,11 +5,14 @@
 
 #include <boost/optional.hpp>
 
+#include "UnparsedValue.hpp"
 #include "VrmlField.hpp"
 
 namespace vrml_proc::parser::model {
   /**
    * @brief Represents a VRML node.
+   *
+   * Node whose header is pruned by the parser is only a stub: it has no fields and `skippedBody` holds its body.
    */
   struct VrmlNode {
     VrmlNode() : definitionName(""), header(""), fields(std::vector<VrmlField>()) {}
@@ -17,5 +20,19 @@ namespace vrml_proc::parser::model {
     boost::optional<std::string> definitionName;
     std::string header;
     std::vector<VrmlField> fields;
+    /** @brief Body of the node (including braces) which was not parsed, empty if the node was parsed. */
+    UnparsedValue skippedBody;
+    /**
+     * @brief Flag indicating that there may be a DEF or USE node among the descendants of the node. If it is false,
+     * there is none. The parser clears it for the nodes it creates.
+     */
+    bool containsReferences = true;
+
+    /**
+     * @brief Checks if the node is a stub whose body was skipped by the parser.
+     *
+     * @returns true if the body was skipped, otherwise false
+     */
+    bool IsPruned() const { return !skippedBody.text.empty(); }
   };
 }  // namespace vrml_proc::parser::model
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+
+namespace vrml_proc::parser::model {
+  /**
+   * @brief Represents structural statistics of a VRML file gathered by `VrmlScanner` without building the AST.
+   */
+  struct VrmlScanStatistics {
+    /** @brief Size of the scanned input in bytes. */
+    size_t bytesCount = 0;
+    /** @brief Total number of nodes (including nested ones). */
+    size_t nodesCount = 0;
+    /** @brief Number of root nodes. */
+    size_t rootNodesCount = 0;
+    /** @brief Number of DEF definitions. */
+    size_t defNodesCount = 0;
+    /** @brief Number of USE references. */
+    size_t useNodesCount = 0;
+    /** @brief Total number of fields. */
+    size_t fieldsCount = 0;
+    /** @brief Maximal nesting depth of nodes (root node has depth 1). */
+    size_t maxDepth = 0;
+    /** @brief Total number of numeric values. */
+    size_t numbersCount = 0;
+    /** @brief Number of coordinates (triplets inside `point` arrays of `Coordinate` nodes). */
+    size_t coordinatesCount = 0;
+    /** @brief Number of values inside `coordIndex` arrays (including -1 separators). */
+    size_t coordinateIndicesCount = 0;
+    /** @brief Number of faces (or polylines) described by `coordIndex` arrays. */
+    size_t facesCount = 0;
+    /** @brief Number of nodes per node type. */
+    std::map<std::string, size_t, std::less<>> nodeTypesCount;
+  };
+}  // namespace vrml_proc::parser::model
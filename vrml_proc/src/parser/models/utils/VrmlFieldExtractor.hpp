@@ -13,11 +13,13 @@
 #include <result.hpp>
 
 #include "ExtractorCache.hpp"
+#include "Float32Array.hpp"
 #include "FormatString.hpp"
 #include "Logger.hpp"
 #include "TypeToString.hpp"
 #include "Vec2f.hpp"
 #include "Vec2fArray.hpp"
+#include "Vec4f.hpp"
 #include "VrmlField.hpp"
 #include "VrmlNodeManager.hpp"
 
@@ -173,7 +175,7 @@ namespace vrml_proc::parser::model::utils::VrmlFieldExtractor {
    *
    * This function attempts to extract a `VrmlNode` with the given name from the provided list of fields.
    * If a matching node of the correct type is not found, it checks whether the name refers to a `UseNode`
-   * and attempts to resolve the reference via the `VrmlNodeManager`.
+   * and resolves the reference by its linked DEF node, or via the `VrmlNodeManager` if it is not linked.
    *
    * On failure due to a type mismatch, the `invalidType` string is populated. If the node is a `USE`
    * reference that could not be resolved, the `useId` string is populated with the unresolved identifier.
@@ -201,6 +203,9 @@ namespace vrml_proc::parser::model::utils::VrmlFieldExtractor {
 
       auto useNode = ExtractByName<vrml_proc::parser::model::UseNode>(name, fields);
       if (useNode.has_value()) {
+        if (useNode.value().get().definition != nullptr) {
+          return std::cref(*useNode.value().get().definition);
+        }
         auto managerFound = manager.GetDefinitionNode(useNode.value().get().identifier);
         if (managerFound.has_value()) {
           return managerFound.value();
@@ -301,8 +306,9 @@ namespace vrml_proc::parser::model::utils::VrmlFieldExtractor {
    * @brief Attempts to extract a `VrmlNode` from a variant, resolving `USE` references.
    *
    * This function handles a variant containing either a `VrmlNode` or a `UseNode`. It first tries to extract a
-   * `VrmlNode` directly. If the contained type is a `UseNode`, the function attempts to resolve it using the provided
-   * `VrmlNodeManager`. If the referenced node cannot be resolved, the function returns an error.
+   * `VrmlNode` directly. If the contained type is a `UseNode`, the function returns its linked DEF node, or attempts
+   * to resolve it using the provided `VrmlNodeManager` if it is not linked. If the referenced node cannot be resolved,
+   * the function returns an error.
    *
    * @param variant variant that may contain either a `VrmlNode` or a `UseNode`.
    * @param manager manager used to resolve nodes referenced by `USE` statements.
@@ -325,6 +331,9 @@ namespace vrml_proc::parser::model::utils::VrmlFieldExtractor {
 
     auto useNode = ExtractVrmlNodeFromVariantWithoutResolvingExtended<vrml_proc::parser::model::UseNode>(variant, out);
     if (useNode.has_value()) {
+      if (useNode.value().get().definition != nullptr) {
+        return std::cref(*useNode.value().get().definition);
+      }
       auto managerFound = manager.GetDefinitionNode(useNode.value().get().identifier);
       if (managerFound.has_value()) {
         return managerFound.value();
@@ -398,133 +407,135 @@ struct ExtractorVisitor
     using namespace vrml_proc::core::logger;
     using namespace vrml_proc::core::utils;
 
-    LogDebug(FormatString("Visit string. Object address is <", &value, ">."), LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Visit string. Object address is <", &value, ">.");
 
     if constexpr (std::is_same<T, std::string>::value) {
-      LogDebug("Extract as string.", LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Extract as string.");
       return std::cref(value);
     }
 
-    LogDebug("String could not be extracted.", LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("String could not be extracted.");
     return cpp::fail(std::optional<std::string>(TypeToString<std::string>()));
   }
 
   cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(const bool& value) const {
-    vrml_proc::core::logger::Log(vrml_proc::core::utils::FormatString("Visit bool. Object address is <", &value, ">."),
-        vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Visit bool. Object address is <", &value, ">.");
 
     if constexpr (std::is_same<T, bool>::value) {
-      vrml_proc::core::logger::Log("Extract as bool.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Extract as bool.");
       return std::cref(value);
     }
 
-    vrml_proc::core::logger::Log("Bool could not be extracted.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Bool could not be extracted.");
     return cpp::fail(std::optional<std::string>(vrml_proc::core::utils::TypeToString<bool>()));
   }
 
   cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(
       const vrml_proc::parser::model::Vec3fArray& value) const {
-    vrml_proc::core::logger::Log(
-        vrml_proc::core::utils::FormatString("Visit Vec3fArray. Object address is <", &value, ">."),
-        vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Visit Vec3fArray. Object address is <", &value, ">.");
 
     if (value.vectors.size() == 0) {
-      vrml_proc::core::logger::Log("Array is empty.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Array is empty.");
 
       if constexpr (std::is_same<T, vrml_proc::parser::model::Vec3fArray>::value) {
-        vrml_proc::core::logger::Log("Extract as Vec3fArray.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+        VRMLPROC_LOG_DEBUG("Extract as Vec3fArray.");
         return std::cref(value);
       }
 
       else if constexpr (std::is_same<T, vrml_proc::parser::model::Vec2fArray>::value) {
         static const vrml_proc::parser::model::Vec2fArray emptyVec2fArray{};
-        vrml_proc::core::logger::Log(
-            vrml_proc::core::utils::FormatString(
-                "Extract as Vec2fArray. Using static empty object with address <", &emptyVec2fArray, ">!"),
-            vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+        VRMLPROC_LOG_DEBUG("Extract as Vec2fArray. Using static empty object with address <", &emptyVec2fArray, ">!");
         return std::cref(emptyVec2fArray);
       }
 
       else if constexpr (std::is_same<T, vrml_proc::parser::model::Int32Array>::value) {
         static const vrml_proc::parser::model::Int32Array emptyInt32Array{};
-        vrml_proc::core::logger::Log(
-            vrml_proc::core::utils::FormatString(
-                "Extract as Int32Array. Using static empty object with address <", &emptyInt32Array, ">!"),
-            vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+        VRMLPROC_LOG_DEBUG("Extract as Int32Array. Using static empty object with address <", &emptyInt32Array, ">!");
         return std::cref(emptyInt32Array);
       }
 
+      else if constexpr (std::is_same<T, vrml_proc::parser::model::Float32Array>::value) {
+        static const vrml_proc::parser::model::Float32Array emptyFloat32Array{};
+        VRMLPROC_LOG_DEBUG(
+            "Extract as Float32Array. Using static empty object with address <", &emptyFloat32Array, ">!");
+        return std::cref(emptyFloat32Array);
+      }
+
       else if constexpr (std::is_same<T,
                              std::vector<boost::variant<boost::recursive_wrapper<vrml_proc::parser::model::VrmlNode>,
                                  boost::recursive_wrapper<vrml_proc::parser::model::UseNode>>>>::value) {
         static const std::vector<boost::variant<boost::recursive_wrapper<vrml_proc::parser::model::VrmlNode>,
             boost::recursive_wrapper<vrml_proc::parser::model::UseNode>>>
             emptyVrmlNodeArray{};
-        vrml_proc::core::logger::Log(
-            vrml_proc::core::utils::FormatString(
-                "Extract as VrmlNodeArray. Using static empty object with address <", &emptyVrmlNodeArray, ">!"),
-            vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+        VRMLPROC_LOG_DEBUG("Extract as VrmlNodeArray. Using static empty object with address <", &emptyVrmlNodeArray,
+            ">!");
         return std::cref(emptyVrmlNodeArray);
       }
 
       else {
-        vrml_proc::core::logger::Log(
-            "Empty array type could not be extracted.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+        VRMLPROC_LOG_DEBUG("Empty array type could not be extracted.");
         return cpp::fail(std::optional<std::string>{"Requested type does not match any supported empty array type."});
       }
     }
 
     if constexpr (std::is_same<T, vrml_proc::parser::model::Vec3fArray>::value) {
-      vrml_proc::core::logger::Log("Extract as Vec3fArray.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Extract as Vec3fArray.");
       return std::cref(value);
     }
 
-    vrml_proc::core::logger::Log(
-        "Vec3fArray could not be extracted.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Vec3fArray could not be extracted.");
     return cpp::fail(std::optional<std::string>(vrml_proc::core::utils::TypeToString<vrml_proc::parser::model::Vec3fArray>()));
   }
 
   cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(
       const vrml_proc::parser::model::Vec2fArray& value) const {
-    vrml_proc::core::logger::Log(
-        vrml_proc::core::utils::FormatString("Visit Vec2fArray. Object address is <", &value, ">."),
-        vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Visit Vec2fArray. Object address is <", &value, ">.");
 
     if constexpr (std::is_same<T, vrml_proc::parser::model::Vec2fArray>::value) {
-      vrml_proc::core::logger::Log("Extract as Vec2fArray.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Extract as Vec2fArray.");
       return std::cref(value);
     }
 
-    vrml_proc::core::logger::Log(
-        "Vec2fArray could not be extracted.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Vec2fArray could not be extracted.");
     return cpp::fail(std::optional<std::string>(vrml_proc::core::utils::TypeToString<vrml_proc::parser::model::Vec2fArray>()));
   }
 
   cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(
       const vrml_proc::parser::model::Int32Array& value) const {
-    vrml_proc::core::logger::Log(
-        vrml_proc::core::utils::FormatString("Visit Int32Array. Object address is <", &value, ">."),
-        vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Visit Int32Array. Object address is <", &value, ">.");
 
     if constexpr (std::is_same<T, vrml_proc::parser::model::Int32Array>::value) {
-      vrml_proc::core::logger::Log("Extract as Int32Array.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Extract as Int32Array.");
       return std::cref(value);
     }
 
-    vrml_proc::core::logger::Log(
-        "Int32Array could not be extracted.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Int32Array could not be extracted.");
     return cpp::fail(std::optional<std::string>(vrml_proc::core::utils::TypeToString<vrml_proc::parser::model::Int32Array>()));
   }
 
+  cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(
+      const vrml_proc::parser::model::Float32Array& value) const {
+    VRMLPROC_LOG_DEBUG("Visit Float32Array. Object address is <", &value, ">.");
+
+    if constexpr (std::is_same<T, vrml_proc::parser::model::Float32Array>::value) {
+      VRMLPROC_LOG_DEBUG("Extract as Float32Array.");
+      return std::cref(value);
+    }
+
+    VRMLPROC_LOG_DEBUG("Float32Array could not be extracted.");
+    return cpp::fail(
+        std::optional<std::string>(vrml_proc::core::utils::TypeToString<vrml_proc::parser::model::Float32Array>()));
+  }
+
   cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(const float& value) const {
     using namespace vrml_proc::core::logger;
     using namespace vrml_proc::core::utils;
     using namespace vrml_proc::parser::model::utils;
 
-    LogDebug(FormatString("Visit float32_t. Object address is <", &value, ">."), LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Visit float32_t. Object address is <", &value, ">.");
 
     if constexpr (std::is_same<T, float>::value) {
-      LogDebug("Extract as float32_t.", LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Extract as float32_t.");
       return std::cref(value);
     }
 
@@ -534,24 +545,22 @@ struct ExtractorVisitor
         auto intValue = cache.GetInt(reinterpret_cast<std::uintptr_t>(&value));
 
         if (intValue.has_value()) {
-          LogDebug(FormatString(
-                       "Edge case: float32_t is a whole number and thus can be extracted as int32_t with address: <",
-                       &(intValue.value()), ">."),
-              LOGGING_INFO);
+          VRMLPROC_LOG_DEBUG(
+              "Edge case: float32_t is a whole number and thus can be extracted as int32_t with address: <",
+              &(intValue.value()), ">.");
           return intValue.value();
         } else {
           cache.StoreInt(reinterpret_cast<std::uintptr_t>(&value), static_cast<int32_t>(value));
           auto newIntValue = cache.GetInt(reinterpret_cast<std::uintptr_t>(&value)).value();
-          LogDebug(FormatString(
-                       "Edge case: float32_t is a whole number and thus can be extracted as int32_t with address: <",
-                       &(newIntValue), ">."),
-              LOGGING_INFO);
+          VRMLPROC_LOG_DEBUG(
+              "Edge case: float32_t is a whole number and thus can be extracted as int32_t with address: <",
+              &(newIntValue), ">.");
           return newIntValue;
         }
       }
     }
 
-    LogDebug("Float32_t could not be extracted.", LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Float32_t could not be extracted.");
     return cpp::fail(std::optional<std::string>(TypeToString<float>()));
   }
 
@@ -560,10 +569,10 @@ struct ExtractorVisitor
     using namespace vrml_proc::core::utils;
     using namespace vrml_proc::parser::model::utils;
 
-    LogDebug(FormatString("Visit int32_t. Object address is <", &value, ">."), LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Visit int32_t. Object address is <", &value, ">.");
 
     if constexpr (std::is_same<T, int32_t>::value) {
-      LogDebug("Extract as int32_t.", LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Extract as int32_t.");
       return std::cref(value);
     }
 
@@ -573,128 +582,108 @@ struct ExtractorVisitor
         auto floatValue = cache.GetFloat(reinterpret_cast<std::uintptr_t>(&value));
 
         if (floatValue.has_value()) {
-          LogDebug(FormatString("Edge case: int32_t can be expressed and extracted as static float32_t with address: <",
-                       &(floatValue.value()), ">."),
-              LOGGING_INFO);
+          VRMLPROC_LOG_DEBUG("Edge case: int32_t can be expressed and extracted as static float32_t with address: <",
+              &(floatValue.value()), ">.");
           return floatValue.value();
         } else {
           cache.StoreFloat(reinterpret_cast<std::uintptr_t>(&value), static_cast<vrml_proc::parser::model::float32_t>(value));
           auto newFloatValue = cache.GetFloat(reinterpret_cast<std::uintptr_t>(&value)).value();
-          LogDebug(FormatString("Edge case: int32_t can be expressed and extracted as static float32_t with address: <",
-                       &(newFloatValue), ">."),
-              LOGGING_INFO);
+          VRMLPROC_LOG_DEBUG("Edge case: int32_t can be expressed and extracted as static float32_t with address: <",
+              &(newFloatValue), ">.");
           return newFloatValue;
         }
       }
     }
 
-    LogDebug("Int32_t could not be extracted.", LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Int32_t could not be extracted.");
     return cpp::fail(std::optional<std::string>(TypeToString<int32_t>()));
   }
 
   cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(
       const vrml_proc::parser::model::Vec2f& value) const {
-    vrml_proc::core::logger::Log(vrml_proc::core::utils::FormatString("Visit Vec2f. Object address is <", &value, ">."),
-        vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Visit Vec2f. Object address is <", &value, ">.");
 
     if constexpr (std::is_same<T, vrml_proc::parser::model::Vec2f>::value) {
-      vrml_proc::core::logger::Log("Extract as Vec2f.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Extract as Vec2f.");
       return std::cref(value);
     }
 
-    vrml_proc::core::logger::Log("Vec2f could not be extracted.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Vec2f could not be extracted.");
     return cpp::fail(std::optional<std::string>(vrml_proc::core::utils::TypeToString<vrml_proc::parser::model::Vec2f>()));
   }
 
   cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(
       const vrml_proc::parser::model::Vec3f& value) const {
-    vrml_proc::core::logger::Log(vrml_proc::core::utils::FormatString("Visit Vec3f. Object address is <", &value, ">."),
-        vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Visit Vec3f. Object address is <", &value, ">.");
 
     if constexpr (std::is_same<T, vrml_proc::parser::model::Vec3f>::value) {
-      vrml_proc::core::logger::Log("Extract as Vec3f.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Extract as Vec3f.");
       return std::cref(value);
     }
 
-    vrml_proc::core::logger::Log("Vec3f could not be extracted.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Vec3f could not be extracted.");
     return cpp::fail(std::optional<std::string>(vrml_proc::core::utils::TypeToString<vrml_proc::parser::model::Vec3f>()));
   }
 
   cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(
       const vrml_proc::parser::model::Vec4f& value) const {
-    vrml_proc::core::logger::Log(vrml_proc::core::utils::FormatString("Visit Vec4f. Object address is <", &value, ">."),
-        vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Visit Vec4f. Object address is <", &value, ">.");
 
     if constexpr (std::is_same<T, vrml_proc::parser::model::Vec4f>::value) {
-      vrml_proc::core::logger::Log("Extract as Vec4f.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Extract as Vec4f.");
       return std::cref(value);
     }
 
-    vrml_proc::core::logger::Log("Vec4f could not be extracted.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Vec4f could not be extracted.");
     return cpp::fail(std::optional<std::string>(vrml_proc::core::utils::TypeToString<vrml_proc::parser::model::Vec4f>()));
   }
 
   cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(
       const vrml_proc::parser::model::UseNode& value) const {
-    vrml_proc::core::logger::Log(
-        vrml_proc::core::utils::FormatString("Visit UseNode (non-recursive). Object address is <", &value, ">."),
-        vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Visit UseNode (non-recursive). Object address is <", &value, ">.");
 
     if constexpr (std::is_same<T, vrml_proc::parser::model::UseNode>::value) {
-      vrml_proc::core::logger::Log(
-          "Extract as UseNode (non-recursive).", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Extract as UseNode (non-recursive).");
       return std::cref(value);
     }
 
-    vrml_proc::core::logger::Log(
-        "UseNode (non-recursive) could not be extracted.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("UseNode (non-recursive) could not be extracted.");
     return cpp::fail(std::optional<std::string>(vrml_proc::core::utils::TypeToString<vrml_proc::parser::model::UseNode>()));
   }
 
   cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(
       const boost::recursive_wrapper<vrml_proc::parser::model::UseNode>& node) const {
-    vrml_proc::core::logger::Log(
-        vrml_proc::core::utils::FormatString("Visit UseNode (recursive). Object address is <", &node, ">."),
-        vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Visit UseNode (recursive). Object address is <", &node, ">.");
 
     if constexpr (std::is_same<T, vrml_proc::parser::model::UseNode>::value) {
-      vrml_proc::core::logger::Log(
-          "Extract as UseNode (recursive).", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Extract as UseNode (recursive).");
       return std::cref(node);
     }
 
-    vrml_proc::core::logger::Log(
-        "UseNode (recursive) could not be extracted.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("UseNode (recursive) could not be extracted.");
     return cpp::fail(std::optional<std::string>(
         vrml_proc::core::utils::TypeToString<boost::recursive_wrapper<vrml_proc::parser::model::UseNode>>()));
   }
 
   cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(
       const boost::recursive_wrapper<vrml_proc::parser::model::VrmlNode>& node) const {
-    vrml_proc::core::logger::Log(
-        vrml_proc::core::utils::FormatString("Visit VrmlNode (recursive). Object address is <", &node, ">."),
-        vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Visit VrmlNode (recursive). Object address is <", &node, ">.");
 
     if constexpr (std::is_same<T, boost::recursive_wrapper<vrml_proc::parser::model::VrmlNode>>::value) {
-      vrml_proc::core::logger::Log(
-          "Extract as VrmlNode (recursive).", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Extract as VrmlNode (recursive).");
       return std::cref(node);
     }
 
-    vrml_proc::core::logger::Log(
-        "VrmlNode (recursive) could not be extracted.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("VrmlNode (recursive) could not be extracted.");
     return cpp::fail(std::optional<std::string>(vrml_proc::core::utils::TypeToString<vrml_proc::parser::model::VrmlNode>()));
   }
 
   cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(
       const vrml_proc::parser::model::VrmlNode& node) const {
-    vrml_proc::core::logger::Log(
-        vrml_proc::core::utils::FormatString("Visit VrmlNode (non-recursive). Object address is <", &node, ">."),
-        vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Visit VrmlNode (non-recursive). Object address is <", &node, ">.");
 
     if constexpr (std::is_same<T, vrml_proc::parser::model::VrmlNode>::value) {
-      vrml_proc::core::logger::Log(
-          "Extract as VrmlNode (non-recursive).", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Extract as VrmlNode (non-recursive).");
       return std::cref(node);
     }
 
@@ -702,26 +691,22 @@ struct ExtractorVisitor
         return std::cref(boost::recursive_wrapper<vrml_proc::parser::model::VrmlNode>(node));
     }*/
 
-    vrml_proc::core::logger::Log(
-        "VrmlNode (non-recursive) could not be extracted.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("VrmlNode (non-recursive) could not be extracted.");
     return cpp::fail(std::optional<std::string>(vrml_proc::core::utils::TypeToString<vrml_proc::parser::model::VrmlNode>()));
   }
 
   cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(
       const std::vector<boost::variant<boost::recursive_wrapper<vrml_proc::parser::model::VrmlNode>,
           boost::recursive_wrapper<vrml_proc::parser::model::UseNode>>>& value) const {
-    vrml_proc::core::logger::Log(
-        vrml_proc::core::utils::FormatString("Visit VrmlNodeArray. Object address is <", &value, ">."),
-        vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Visit VrmlNodeArray. Object address is <", &value, ">.");
 
     if constexpr (std::is_same<T, std::vector<boost::variant<boost::recursive_wrapper<vrml_proc::parser::model::VrmlNode>,
                                       boost::recursive_wrapper<vrml_proc::parser::model::UseNode>>>>::value) {
-      vrml_proc::core::logger::Log("Extract as VrmlNodeArray.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Extract as VrmlNodeArray.");
       return std::cref(value);
     }
 
-    vrml_proc::core::logger::Log(
-        "VrmlNodeArray could not be extracted.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("VrmlNodeArray could not be extracted.");
     return cpp::fail(std::optional<std::string>(vrml_proc::core::utils::TypeToString<
         std::vector<boost::variant<boost::recursive_wrapper<vrml_proc::parser::model::VrmlNode>,
             boost::recursive_wrapper<vrml_proc::parser::model::UseNode>>>>()));
@@ -729,9 +714,7 @@ struct ExtractorVisitor
 
   template <typename U>
   cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(const U&) const {
-    vrml_proc::core::logger::Log(vrml_proc::core::utils::FormatString("Type mismatch! Expected <", typeid(T).name(),
-                                     ">,  but received <", typeid(U).name(), ">."),
-        vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Type mismatch! Expected <", typeid(T).name(), ">,  but received <", typeid(U).name(), ">.");
     return cpp::fail(std::optional<std::string>(vrml_proc::core::utils::TypeToString<U>()));
   }
 };
@@ -747,13 +730,10 @@ struct VariantVisitor
     : public boost::static_visitor<cpp::result<std::reference_wrapper<const T>, std::optional<std::string>>> {
   cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(
       const vrml_proc::parser::model::UseNode& node) const {
-    vrml_proc::core::logger::Log(
-        vrml_proc::core::utils::FormatString("Visit UseNode (non-recursive). Object address is <", &node, ">."),
-        vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Visit UseNode (non-recursive). Object address is <", &node, ">.");
 
     if constexpr (std::is_same<T, vrml_proc::parser::model::UseNode>::value) {
-      vrml_proc::core::logger::Log(
-          "Extract as UseNode (non-recursive).", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Extract as UseNode (non-recursive).");
       return std::cref(node);
     }
 
@@ -761,56 +741,44 @@ struct VariantVisitor
         return std::cref(boost::recursive_wrapper<vrml_proc::parser::model::UseNode>(node));
     }*/
 
-    vrml_proc::core::logger::Log(
-        "UseNode (non-recursive) could not be extracted.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("UseNode (non-recursive) could not be extracted.");
     return cpp::fail(std::optional<std::string>(vrml_proc::core::utils::TypeToString<vrml_proc::parser::model::UseNode>()));
   }
 
   cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(
       const boost::recursive_wrapper<vrml_proc::parser::model::UseNode>& node) const {
-    vrml_proc::core::logger::Log(
-        vrml_proc::core::utils::FormatString("Visit UseNode (recursive). Object address is <", &node, ">."),
-        vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Visit UseNode (recursive). Object address is <", &node, ">.");
 
     if constexpr (std::is_same<T, boost::recursive_wrapper<vrml_proc::parser::model::UseNode>>::value) {
-      vrml_proc::core::logger::Log(
-          "Extract as UseNode (recursive).", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Extract as UseNode (recursive).");
       return std::cref(node.get());
     }
 
-    vrml_proc::core::logger::Log(
-        "UseNode (recursive) could not be extracted.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("UseNode (recursive) could not be extracted.");
     return cpp::fail(std::optional<std::string>(
         vrml_proc::core::utils::TypeToString<boost::recursive_wrapper<vrml_proc::parser::model::UseNode>>()));
   }
 
   cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(
       const boost::recursive_wrapper<vrml_proc::parser::model::VrmlNode>& node) const {
-    vrml_proc::core::logger::Log(
-        vrml_proc::core::utils::FormatString("Visit VrmlNode (recursive). Object address is <", &node, ">."),
-        vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Visit VrmlNode (recursive). Object address is <", &node, ">.");
 
     if constexpr (std::is_same<T, boost::recursive_wrapper<vrml_proc::parser::model::VrmlNode>>::value) {
-      vrml_proc::core::logger::Log(
-          "Extract as VrmlNode (recursive).", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Extract as VrmlNode (recursive).");
       return std::cref(node.get());
     }
 
-    vrml_proc::core::logger::Log(
-        "VrmlNode (recursive) could not be extracted.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("VrmlNode (recursive) could not be extracted.");
     return cpp::fail(std::optional<std::string>(
         vrml_proc::core::utils::TypeToString<boost::recursive_wrapper<vrml_proc::parser::model::VrmlNode>>()));
   }
 
   cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(
       const vrml_proc::parser::model::VrmlNode& node) const {
-    vrml_proc::core::logger::Log(
-        vrml_proc::core::utils::FormatString("Visit VrmlNode (non-recursive). Object address is <", &node, ">."),
-        vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Visit VrmlNode (non-recursive). Object address is <", &node, ">.");
 
     if constexpr (std::is_same<T, vrml_proc::parser::model::VrmlNode>::value) {
-      vrml_proc::core::logger::Log(
-          "Extract as VrmlNode (non-recursive).", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Extract as VrmlNode (non-recursive).");
       return std::cref(node);
     }
 
@@ -818,16 +786,13 @@ struct VariantVisitor
         return std::cref(boost::recursive_wrapper<vrml_proc::parser::model::VrmlNode>(node));
     }*/
 
-    vrml_proc::core::logger::Log(
-        "VrmlNode (non-recursive) could not be extracted.", vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("VrmlNode (non-recursive) could not be extracted.");
     return cpp::fail(std::optional<std::string>(vrml_proc::core::utils::TypeToString<vrml_proc::parser::model::VrmlNode>()));
   }
 
   template <typename U>
   cpp::result<std::reference_wrapper<const T>, std::optional<std::string>> operator()(const U&) const {
-    vrml_proc::core::logger::Log(vrml_proc::core::utils::FormatString("Type mismatch! Expected <", typeid(T).name(),
-                                     ">,  but received <", typeid(U).name(), ">."),
-        vrml_proc::core::logger::Level::Debug, LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Type mismatch! Expected <", typeid(T).name(), ">,  but received <", typeid(U).name(), ">.");
     return cpp::fail(std::optional<std::string>(vrml_proc::core::utils::TypeToString<U>()));
   }
 };
@@ -33,6 +33,8 @@ struct Visitor {
 
   void operator()(const vrml_proc::parser::model::Int32Array& array) const { printer.Print(array, indentationLevel); }
 
+  void operator()(const vrml_proc::parser::model::Float32Array& array) const { printer.Print(array, indentationLevel); }
+
   void operator()(vrml_proc::parser::model::float32_t value) const {
     *outputStream << VrmlTreePrinter::CreateIndentationString(indentationLevel) << "Float32 (" << &value << "): <"
                   << value << ">";
@@ -53,6 +55,12 @@ struct Visitor {
 
   void operator()(const vrml_proc::parser::model::UseNode& node) const { printer.Print(node, indentationLevel); }
 
+  void operator()(const vrml_proc::parser::model::UnparsedValue& value) const {
+    *outputStream << VrmlTreePrinter::CreateIndentationString(indentationLevel) << "UnparsedValue (" << &value
+                  << "): <" << value.text.size() << " bytes>";
+    *outputStream << std::endl;
+  }
+
   void operator()(const boost::recursive_wrapper<vrml_proc::parser::model::VrmlNode>& node) const {
     printer.Print(node.get(), indentationLevel);
   }
@@ -102,6 +110,10 @@ void VrmlTreePrinter::Print(const vrml_proc::parser::model::VrmlNode& object, In
               << object.definitionName.value() << ">\n";
   }
   *m_stream << VrmlTreePrinter::CreateIndentationString(indentationLevel) << "Header: <" << object.header << ">\n";
+  if (object.IsPruned()) {
+    *m_stream << VrmlTreePrinter::CreateIndentationString(indentationLevel) << "Skipped body: <"
+              << object.skippedBody.text.size() << " bytes>\n";
+  }
   *m_stream << VrmlTreePrinter::CreateIndentationString(indentationLevel) << "Fields:\n";
 
   for (const auto& field : object.fields) {
@@ -142,6 +154,28 @@ void VrmlTreePrinter::Print(const vrml_proc::parser::model::Int32Array& object,
   *m_stream << std::endl;
 }
 
+void VrmlTreePrinter::Print(const vrml_proc::parser::model::Float32Array& object, IndentationLevel indentationLevel) const {  //
+
+  std::string indentationString = VrmlTreePrinter::CreateIndentationString(indentationLevel);
+  indentationLevel++;
+
+  *m_stream << indentationString;
+  *m_stream << "Float32Array (" << &object << "):\n";
+  *m_stream << VrmlTreePrinter::CreateIndentationString(indentationLevel) << "[\n"
+            << VrmlTreePrinter::CreateIndentationString(indentationLevel + 1);
+
+  for (const auto& entity : object.values | std::views::take(3)) {
+    *m_stream << "<" << entity << "> ";
+  }
+
+  if (object.values.size() > 3) {
+    *m_stream << "(...other " << object.values.size() - 3 << " elements) ]";
+  }
+
+  *m_stream << "\n";
+  *m_stream << std::endl;
+}
+
 void VrmlTreePrinter::Print(const vrml_proc::parser::model::Vec2f& object, IndentationLevel indentationLevel) const {
   std::string indentationString = VrmlTreePrinter::CreateIndentationString(indentationLevel);
   indentationLevel++;
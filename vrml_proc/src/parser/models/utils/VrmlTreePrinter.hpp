@@ -4,6 +4,7 @@
 #include <ostream>
 #include <string>
 
+#include "Float32Array.hpp"
 #include "Int32Array.hpp"
 #include "UseNode.hpp"
 #include "Vec2f.hpp"
@@ -58,6 +59,13 @@ namespace vrml_proc::parser::model::utils {
      * @param indentationLevel how many indentation objects should be used
      */
     void Print(const vrml_proc::parser::model::Int32Array& object, IndentationLevel indentationLevel = 0) const;
+    /**
+     * @brief Prints a possibly a a tree-like structure.
+     *
+     * @param object object (root) which will be printed (and possible its children etc.)
+     * @param indentationLevel how many indentation objects should be used
+     */
+    void Print(const vrml_proc::parser::model::Float32Array& object, IndentationLevel indentationLevel = 0) const;
     /**
      * @brief Prints a possibly a a tree-like structure.
      *
@@ -10,38 +10,31 @@
 #include "VrmlNode.hpp"
 
 vrml_proc::parser::service::VrmlNodeManager::VrmlNodeManager() {
-  vrml_proc::core::logger::LogDebug("Construct new VrmlNodeManager.", LOGGING_INFO);
+  VRMLPROC_LOG_DEBUG("Construct new VrmlNodeManager.");
 }
 
 void vrml_proc::parser::service::VrmlNodeManager::AddDefinitionNode(
     const std::string& id, const vrml_proc::parser::model::VrmlNode& node) {  //
 
-  vrml_proc::core::logger::LogDebug(
-      vrml_proc::core::utils::FormatString("Add DEF node with id <", id, "> into map."), LOGGING_INFO);
-  vrml_proc::core::logger::LogDebug(
-      vrml_proc::core::utils::FormatString("Address of VRML node: <", &node, ">."), LOGGING_INFO);
+  VRMLPROC_LOG_DEBUG("Add DEF node with id <", id, "> into map.");
+  VRMLPROC_LOG_DEBUG("Address of VRML node: <", &node, ">.");
 
   auto result = m_definitionNodes.insert_or_assign(
       id, std::reference_wrapper<const vrml_proc::parser::model::VrmlNode>(std::cref(node)));
   if (!result.second) {
-    vrml_proc::core::logger::LogDebug(
-        vrml_proc::core::utils::FormatString(
-            "Id <", id, "> was already present in the map. The value was replaced with the new entity."),
-        LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Id <", id, "> was already present in the map. The value was replaced with the new entity.");
   }
 }
 
 std::optional<std::reference_wrapper<const vrml_proc::parser::model::VrmlNode>>
 vrml_proc::parser::service::VrmlNodeManager::GetDefinitionNode(const std::string& id) const {  //
 
-  vrml_proc::core::logger::LogDebug(
-      vrml_proc::core::utils::FormatString("Retrieve DEF node with id <", id, "> from the map."), LOGGING_INFO);
+  VRMLPROC_LOG_DEBUG("Retrieve DEF node with id <", id, "> from the map.");
   auto it = m_definitionNodes.find(id);
   if (it != m_definitionNodes.end()) {
     return it->second;
   }
 
-  vrml_proc::core::logger::LogDebug(
-      vrml_proc::core::utils::FormatString("DEF node with id <", id, "> was not found in the map!"), LOGGING_INFO);
+  VRMLPROC_LOG_DEBUG("DEF node with id <", id, "> was not found in the map!");
   return {};
 }
@@ -11,6 +11,7 @@
 #include "Logger.hpp"
 #include "ManualTimer.hpp"
 #include "NullPointerError.hpp"
+#include "Tracer.hpp"
 #include "TraversorResult.hpp"
 #include "VrmlFile.hpp"
 #include "VrmlHeaders.hpp"
@@ -41,6 +42,11 @@ namespace vrml_proc::traversor {
         const vrml_proc::traversor::node_descriptor::VrmlHeaders& headersMap)
         : m_manager(manager), m_config(config), m_actionMap(actionMap), m_headersMap(headersMap) {}
 
+    /**
+     * @brief Callback invoked with the result of each traversed root node.
+     */
+    using RootTraversedCallback = std::function<void(std::shared_ptr<ConversionContext>)>;
+
     /**
      * @brief Traverses the VRML file (collection of root nodes). Function calls for each root VRML node a
      * VrmlNodeTraversor. Accumulated result is agggregated from all nodes and merged into ConversionContext.
@@ -49,7 +55,29 @@ namespace vrml_proc::traversor {
      * @param file file to traverse
      * @returns Conversion context or error
      */
-    TraversorResult<ConversionContext> Traverse(const vrml_proc::parser::model::VrmlFile& file) {  //
+    TraversorResult<ConversionContext> Traverse(const vrml_proc::parser::model::VrmlFile& file) {
+      std::shared_ptr<ConversionContext> traversedFile = std::make_shared<ConversionContext>();
+
+      auto result = Traverse(
+          file, [&traversedFile](std::shared_ptr<ConversionContext> context) { traversedFile->Merge(context.get()); });
+      if (result.has_error()) {
+        return cpp::fail(result.error());
+      }
+
+      return traversedFile;
+    }
+
+    /**
+     * @brief Traverses the VRML file (collection of root nodes) in a streaming way. Result of each root node is not
+     * merged, but handed to `onRootTraversed` immediately after the root node is traversed. It allows the caller to
+     * start processing the data (e.g. run mesh tasks) while the rest of the file is still being traversed.
+     *
+     * @param file file to traverse
+     * @param onRootTraversed callback receiving conversion context of each root node, in the order of root nodes
+     * @returns empty result or error
+     */
+    cpp::result<void, std::shared_ptr<vrml_proc::core::error::Error>> Traverse(
+        const vrml_proc::parser::model::VrmlFile& file, const RootTraversedCallback& onRootTraversed) {  //
 
       using vrml_proc::core::error::NullPointerError;
       using vrml_proc::math::TransformationMatrix;
@@ -64,15 +92,19 @@ namespace vrml_proc::traversor {
       ManualTimer timer;
       timer.Start();
 
-      std::shared_ptr<ConversionContext> traversedFile = std::make_shared<ConversionContext>();
       auto traversor = VrmlNodeTraversor<ConversionContext>(m_manager, m_config, m_actionMap, m_headersMap);
 
       size_t index = 1;
       for (const auto& root : file) {
         LogInfo(FormatString("Found ", index, ". root node. It is type <", root.header, ">."), LOGGING_INFO);
 
-        auto matrix = TransformationMatrix();
-        auto result = traversor.Traverse(VrmlNodeTraversorParameters(std::cref(root), false, matrix));
+        auto result = [&]() {
+          auto span = vrml_proc::core::metrics::TraceSpan("traverse root node", "traversal");
+          span.AddArgument("index", index);
+          span.AddArgument("header", root.header);
+          auto matrix = TransformationMatrix();
+          return traversor.Traverse(VrmlNodeTraversorParameters(std::cref(root), false, matrix));
+        }();
 
         if (result.has_error()) {
           auto time = timer.End();
@@ -90,14 +122,14 @@ namespace vrml_proc::traversor {
           return cpp::fail(std::make_shared<FileTraversorError>(root) << std::make_shared<NullPointerError>());
         }
 
-        traversedFile->Merge(result.value().get());
+        onRootTraversed(result.value());
         index++;
       }
 
       auto time = timer.End();
       LogInfo(FormatString("Traversing finished successfully. The process took ", time, " seconds."), LOGGING_INFO);
 
-      return traversedFile;
+      return {};
     }
 
    private:
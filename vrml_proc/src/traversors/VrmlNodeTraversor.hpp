@@ -14,7 +14,6 @@
 #include "Error.hpp"
 #include "FormatString.hpp"
 #include "GroupingHandler.hpp"
-#include "Hash.hpp"
 #include "IndexedFaceSetHandler.hpp"
 #include "IndexedLineSetHandler.hpp"
 #include "LODHandler.hpp"
@@ -78,10 +77,15 @@ namespace vrml_proc::traversor {
 
       bool ignoreUnknownNodeFlag = m_config->ignoreUnknownNode;
 
-      LogDebug(FormatString("Find handler for VRML node with name <", params.node.get().header, ">."), LOGGING_INFO);
+      VRMLPROC_LOG_DEBUG("Find handler for VRML node with name <", params.node.get().header, ">.");
 
       if (params.node.get().header.empty()) {
-        LogDebug("Handle empty VRML node.", LOGGING_INFO);
+        VRMLPROC_LOG_DEBUG("Handle empty VRML node.");
+        return std::make_shared<ConversionContext>();
+      }
+
+      if (params.node.get().IsPruned()) {
+        VRMLPROC_LOG_DEBUG("Skip VRML node <", params.node.get().header, "> pruned by the parser.");
         return std::make_shared<ConversionContext>();
       }
 
@@ -114,7 +118,7 @@ namespace vrml_proc::traversor {
       }
 
       // Find and run handler for node.
-      auto handlerResult = FindAndRunHandler(canonicalHeader, params, validationResult.value());
+      auto handlerResult = FindAndRunHandler(params, validationResult.value());
       if (handlerResult.has_error()) {
         return cpp::fail(std::make_shared<NodeTraversorError>(handlerResult.error(), params.node.get()));
       }
@@ -129,16 +133,15 @@ namespace vrml_proc::traversor {
     const vrml_proc::traversor::node_descriptor::VrmlHeaders& m_headersMap;
 
     /**
-     * @brief Helper function which tries to find and execute action.
+     * @brief Helper function which tries to find and execute action. Handler is chosen by the canonical id of the node
+     * view, which was resolved by the node descriptor.
      *
-     * @param header canonical name of node
      * @param params parameters from traversor
      * @param nodeView node view of the node
      *
      * @returns pointer to conversion context, otherwise an error object if any problem occurs
      */
-    TraversorResult<ConversionContext> FindAndRunHandler(const std::string& header,
-        const VrmlNodeTraversorParameters& params,
+    TraversorResult<ConversionContext> FindAndRunHandler(const VrmlNodeTraversorParameters& params,
         std::shared_ptr<vrml_proc::traversor::node_descriptor::NodeView> nodeView) {  //
 
       using namespace vrml_proc::core::utils;
@@ -153,7 +156,7 @@ namespace vrml_proc::traversor {
       HandlerParameters<ConversionContext> inputHandlerParameters(
           nodeView, params.IsDescendantOfShape, params.transformation, m_manager, m_actionMap, m_config, m_headersMap);
 
-      switch (Hash(header)) {
+      switch (nodeView->GetId()) {
         case CanonicalHeaderHashes::Group:
           handlerResult = GroupingHandler::Handle(inputHandlerParameters);
           break;
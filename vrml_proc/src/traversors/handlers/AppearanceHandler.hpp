@@ -45,8 +45,7 @@ namespace vrml_proc::traversor::handler::AppearanceHandler {
 
     // ---------------------------------------------------
 
-    vrml_proc::core::logger::LogDebug(
-        vrml_proc::core::utils::FormatString("Handle VRML node <", params.nodeView->GetName(), ">."), LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Handle VRML node <", params.nodeView->GetName(), ">.");
 
     VrmlNodeTraversor<ConversionContext> traversor(params.manager, params.config, params.actionMap, params.headersMap);
 
@@ -88,6 +87,6 @@ namespace vrml_proc::traversor::handler::AppearanceHandler {
     data.config = params.config;
 
     return vrml_proc::traversor::utils::ConversionContextActionExecutor::TryToExecute<ConversionContext>(
-        params.actionMap, params.nodeView->GetName(), data);
+        params.actionMap, params.nodeView->GetId(), params.nodeView->GetName(), data);
   }
 }  // namespace vrml_proc::traversor::handler::AppearanceHandler
\ No newline at end of file
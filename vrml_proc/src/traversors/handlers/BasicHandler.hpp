@@ -30,8 +30,7 @@ namespace vrml_proc::traversor::handler::BasicHandler {
   template <vrml_proc::core::contract::ConversionContextable ConversionContext>
   TraversorResult<ConversionContext> Handle(HandlerParameters<ConversionContext> params) {  //
 
-    vrml_proc::core::logger::LogDebug(
-        vrml_proc::core::utils::FormatString("Handle VRML node <", params.nodeView->GetName(), ">."), LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Handle VRML node <", params.nodeView->GetName(), ">.");
 
     params.nodeView->SetShapeDescendant(params.IsDescendantOfShape);
     params.nodeView->SetTransformationMatrix(params.transformation);
@@ -39,6 +38,6 @@ namespace vrml_proc::traversor::handler::BasicHandler {
     data.config = params.config;
 
     return vrml_proc::traversor::utils::ConversionContextActionExecutor::TryToExecute<ConversionContext>(
-        params.actionMap, params.nodeView->GetName(), data);
+        params.actionMap, params.nodeView->GetId(), params.nodeView->GetName(), data);
   }
 }  // namespace vrml_proc::traversor::handler::BasicHandler
\ No newline at end of file
@@ -1,57 +1,91 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_set>
 
 #include <result.hpp>
 
 #include "Error.hpp"
 #include "FormatString.hpp"
 #include "Logger.hpp"
-#include "NodeDescriptor.hpp"
-#include "NodeDescriptorMap.hpp"
 #include "NodeTraversorError.hpp"
-#include "VrmlHeaders.hpp"
+#include "NodeValidationError.hpp"
+#include "NodeValidationUtils.hpp"
+#include "NodeView.hpp"
+#include "UnparsedValue.hpp"
 #include "VrmlNode.hpp"
-#include "VrmlNodeManager.hpp"
 
 namespace vrml_proc::traversor::handler::HandlerUtils {
   /**
-   * @brief Validates given geometry primitive node.
+   * @brief Validates the geometry primitive node contained in the field `fieldName` and resolves its data field.
    *
-   * @param nodeView node view
-   * @param manager manager
-   * @param fieldName field name to verify
-   * @param headersMap map with all header (synonyms to canonical) names
+   * Geometry primitive nodes (Coordinate, Color, Normal and TextureCoordinate) have a single data field (e.g. `point`
+   * of Coordinate), so it is read directly from the parsed node, without creating a node descriptor and a node view
+   * of the primitive. The header of the primitive node was already checked by the validation of the parent node.
    *
-   * @returns error if validation fails, otherwise void
+   * @tparam DataType type of the data field (Vec3fArray or Vec2fArray)
+   * @param nodeView node view of the parent node
+   * @param fieldName name of the field containing the geometry primitive node
+   * @param dataFieldName name of the data field of the geometry primitive node
+   *
+   * @returns error if validation fails, otherwise reference to the data (the default empty array if the data field is
+   * missing or was skipped by the parser), or std::nullopt if the field contains no node
    */
-  inline cpp::result<void, std::shared_ptr<vrml_proc::core::error::Error>> ValidateGeometryPrimitiveNode(
-      std::shared_ptr<vrml_proc::traversor::node_descriptor::NodeView> nodeView,
-      const vrml_proc::parser::service::VrmlNodeManager& manager,
+  template <typename DataType>
+  inline cpp::result<std::optional<std::reference_wrapper<const DataType>>,
+      std::shared_ptr<vrml_proc::core::error::Error>>
+  ResolveGeometryPrimitiveNode(const vrml_proc::traversor::node_descriptor::NodeView& nodeView,
       const std::string& fieldName,
-      const vrml_proc::traversor::node_descriptor::VrmlHeaders& headersMap) {  //
+      const std::string& dataFieldName) {  //
 
     using namespace vrml_proc::core::logger;
     using namespace vrml_proc::core::utils;
-    using namespace vrml_proc::traversor::node_descriptor;
-    using namespace vrml_proc::traversor::error;
+    using vrml_proc::parser::model::VrmlNode;
+    using vrml_proc::traversor::error::NodeTraversorError;
 
     // ---------------------------------------------------
 
-    auto node = nodeView->GetField<std::reference_wrapper<const vrml_proc::parser::model::VrmlNode>>(fieldName);
-    auto ndResult = CreateNodeDescriptor(headersMap.ConvertToCanonicalHeader(node.get().header));
+    const VrmlNode& node = nodeView.GetField<std::reference_wrapper<const VrmlNode>>(fieldName).get();
+    if (node.header.empty()) {
+      return std::optional<std::reference_wrapper<const DataType>>{};
+    }
+
+    auto fail = [&node, &fieldName](std::shared_ptr<validation::error::NodeValidationError> error) {
+      LogError(FormatString("Validation for geometry primitive node <", node.header, "> from field <", fieldName,
+                   "> failed!"),
+          LOGGING_INFO);
+      return cpp::fail(std::make_shared<NodeTraversorError>(error, node));
+    };
 
-    if (ndResult.has_value()) {
-      auto validationResult = ndResult.value().Validate(node.get(), manager, headersMap, true);
-      if (validationResult.has_error()) {
-        LogError(FormatString("Validation for geometry primitive node <", node.get().header, "> from field <",
-                     fieldName, "> failed!"),
-            LOGGING_INFO);
-        return cpp::fail(std::make_shared<NodeTraversorError>(validationResult.error(), node.get()));
+    static const DataType defaultData;
+    std::reference_wrapper<const DataType> data = std::cref(defaultData);
+    bool found = false;
+    for (const auto& field : node.fields) {
+      if (field.name != dataFieldName) {
+        return fail(std::make_shared<validation::error::InvalidVrmlFieldName>(
+            node.header, field.name, std::unordered_set<std::string>{dataFieldName}));
       }
+      if (found) {
+        return fail(std::make_shared<validation::error::DuplicatedVrmlFieldName>(field.name));
+      }
+      found = true;
+
+      // Value skipped by the parser is not needed by anyone, default value is kept.
+      if (boost::get<vrml_proc::parser::model::UnparsedValue>(&field.value) != nullptr) {
+        continue;
+      }
+
+      auto value =
+          validation::NodeValidationUtils::ExtractFieldByNameWithValidation<DataType>(dataFieldName, node.fields);
+      if (value.has_error()) {
+        return fail(value.error());
+      }
+      data = value.value().value();
     }
-    return {};
+
+    return std::optional<std::reference_wrapper<const DataType>>(data);
   }
 }  // namespace vrml_proc::traversor::handler::HandlerUtils
@@ -50,7 +50,7 @@ namespace vrml_proc::traversor::handler::LODHandler {
 
     // ---------------------------------------------------
 
-    LogDebug(FormatString("Handle VRML node <", params.nodeView->GetName(), ">."), LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Handle VRML node <", params.nodeView->GetName(), ">.");
     auto traversor = vrml_proc::traversor::VrmlNodeTraversor<ConversionContext>(
         params.manager, params.config, params.actionMap, params.headersMap);
 
@@ -76,6 +76,6 @@ namespace vrml_proc::traversor::handler::LODHandler {
     data.config = params.config;
 
     return vrml_proc::traversor::utils::ConversionContextActionExecutor::TryToExecute<ConversionContext>(
-        params.actionMap, params.nodeView->GetName(), data);
+        params.actionMap, params.nodeView->GetId(), params.nodeView->GetName(), data);
   }
 }  // namespace vrml_proc::traversor::handler::LODHandler
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include "Logger.hpp"
 #include "NodeTraversorError.hpp"
 #include "TraversorResult.hpp"
+#include "Vec3fArray.hpp"
 #include "VrmlNode.hpp"
 #include "VrmlNodeTraversorParameters.hpp"
 #include "VrmlUnits.hpp"
@@ -38,28 +39,28 @@ namespace vrml_proc::traversor::handler::PointSetHandler {
   TraversorResult<ConversionContext> Handle(HandlerParameters<ConversionContext> params) {  //
 
     using namespace vrml_proc::traversor::handler::HandlerUtils;
+    using vrml_proc::parser::model::Vec3fArray;
 
     // ---------------------------------------------------
 
-    vrml_proc::core::logger::LogDebug(
-        vrml_proc::core::utils::FormatString("Handle VRML node <", params.node.header, ">."), LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Handle VRML node <", params.node.header, ">.");
 
-    // There are geometry primitive nodes 'coord' and 'color'. They are sent as VrmlNodes into the
-    // given action where they can be traversed if needed. The main point is they are not traversed inside this handler.
-    // But they have to be validated nonetheless.
+    // There are geometry primitive nodes 'coord' and 'color'. They are not traversed, but they are validated here and
+    // their data (e.g. points of the Coordinate node) are resolved into the node view, so actions can read them
+    // directly.
     {
-      auto validationResult =
-          ValidateGeometryPrimitiveNode(params.nodeView, params.manager, "color", params.headersMap);
-      if (validationResult.has_error()) {
-        return cpp::fail(validationResult.error());
+      auto data = ResolveGeometryPrimitiveNode<Vec3fArray>(*params.nodeView, "color", "color");
+      if (data.has_error()) {
+        return cpp::fail(data.error());
       }
+      params.nodeView->SetColorData(data.value());
     }
     {
-      auto validationResult =
-          ValidateGeometryPrimitiveNode(params.nodeView, params.manager, "coord", params.headersMap);
-      if (validationResult.has_error()) {
-        return cpp::fail(validationResult.error());
+      auto data = ResolveGeometryPrimitiveNode<Vec3fArray>(*params.nodeView, "coord", "point");
+      if (data.has_error()) {
+        return cpp::fail(data.error());
       }
+      params.nodeView->SetCoordData(data.value());
     }
 
     // ---------------------------------------------------
@@ -70,6 +71,6 @@ namespace vrml_proc::traversor::handler::PointSetHandler {
     data.config = params.config;
 
     return vrml_proc::traversor::utils::ConversionContextActionExecutor::TryToExecute<ConversionContext>(
-        params.actionMap, params.nodeView->GetName(), data);
+        params.actionMap, params.nodeView->GetId(), params.nodeView->GetName(), data);
   }
 }  // namespace vrml_proc::traversor::handler::PointSetHandler
\ No newline at end of file
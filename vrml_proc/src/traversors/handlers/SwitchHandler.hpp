@@ -47,7 +47,7 @@ namespace vrml_proc::traversor::handler::SwitchHandler {
 
     // ---------------------------------------------------
 
-    LogDebug(FormatString("Handle VRML node <", params.nodeView->GetName(), ">."), LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Handle VRML node <", params.nodeView->GetName(), ">.");
 
     const int32_t& whichChoice =
         (params.nodeView->template GetField<std::reference_wrapper<const int32_t>>("whichChoice")).get();
@@ -83,6 +83,6 @@ namespace vrml_proc::traversor::handler::SwitchHandler {
     data.config = params.config;
 
     return vrml_proc::traversor::utils::ConversionContextActionExecutor::TryToExecute<ConversionContext>(
-        params.actionMap, params.nodeView->GetName(), data);
+        params.actionMap, params.nodeView->GetId(), params.nodeView->GetName(), data);
   }
 }  // namespace vrml_proc::traversor::handler::SwitchHandler
\ No newline at end of file
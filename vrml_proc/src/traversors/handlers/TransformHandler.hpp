@@ -52,7 +52,7 @@ namespace vrml_proc::traversor::handler::TransformHandler {
 
     // ---------------------------------------------------
 
-    LogDebug(FormatString("Handle VRML node <", params.nodeView->GetName(), ">."), LOGGING_INFO);
+    VRMLPROC_LOG_DEBUG("Handle VRML node <", params.nodeView->GetName(), ">.");
 
     /** Update transformation data via copying. */
     Transformation transformationData;
@@ -89,6 +89,6 @@ namespace vrml_proc::traversor::handler::TransformHandler {
     data.config = params.config;
 
     return ConversionContextActionExecutor::TryToExecute<ConversionContext>(
-        params.actionMap, params.nodeView->GetName(), data);
+        params.actionMap, params.nodeView->GetId(), params.nodeView->GetName(), data);
   }
 }  // namespace vrml_proc::traversor::handler::TransformHandler
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
@@ -10,6 +11,8 @@
 
 #include <result.hpp>
 
+#include "Float32Array.hpp"
+#include "Hash.hpp"
 #include "Int32Array.hpp"
 #include "NodeDescriptorFieldType.hpp"
 #include "NodeValidationError.hpp"
@@ -19,6 +22,7 @@
 #include "Vec2fArray.hpp"
 #include "Vec3f.hpp"
 #include "Vec3fArray.hpp"
+#include "UnparsedValue.hpp"
 #include "Vec4f.hpp"
 #include "VrmlField.hpp"
 #include "VrmlHeaders.hpp"
@@ -36,14 +40,14 @@ namespace vrml_proc::traversor::node_descriptor {
     /**
      * @brief Creates new empty object.
      */
-    NodeDescriptor() : m_name("") {}
+    NodeDescriptor() : m_name(""), m_id(vrml_proc::core::utils::Hash("")) {}
 
     /**
      * @brief Creates new object.
      *
      * @param id name of the VRML node
      */
-    NodeDescriptor(const std::string& id) : m_name(id) {}
+    NodeDescriptor(const std::string& id) : m_name(id), m_id(vrml_proc::core::utils::Hash(id)) {}
 
     /**
      * @brief Binds a field to the node descriptor.
@@ -115,6 +119,13 @@ namespace vrml_proc::traversor::node_descriptor {
      */
     std::string GetName() const { return m_name; }
 
+    /**
+     * @brief Gets types of all bound fields.
+     *
+     * @returns map from field name to its type
+     */
+    const std::map<std::string, FieldType>& GetFieldTypes() const { return m_fieldTypes; }
+
     /**
      * @brief Validates given node `node` agains `this` node descriptor.
      *
@@ -145,11 +156,11 @@ namespace vrml_proc::traversor::node_descriptor {
 
       // We copy default values into possible future result NodeView.
       NodeView::Builder builder;
-      builder.SetName(m_name);
+      builder.SetName(m_name, m_id);
       builder.SetDefaultValues(m_fieldTypes, m_defaultBoolFields, m_defaultStringFields, m_defaultFloat32Fields,
           m_defaultInt32Fields, m_defaultVec2fFields, m_defaultVec3fFields, m_defaultVec4fFields,
-          m_defaultVec2fArrayFields, m_defaultVec3fArrayFields, m_defaultInt32ArrayFields, m_defaultNodeFields,
-          m_defaultNodeArrayFields);
+          m_defaultVec2fArrayFields, m_defaultVec3fArrayFields, m_defaultInt32ArrayFields, m_defaultFloat32ArrayFields,
+          m_defaultNodeFields, m_defaultNodeArrayFields);
 
       // Nothing to check here.
       if (node.fields.empty()) {
@@ -164,6 +175,11 @@ namespace vrml_proc::traversor::node_descriptor {
 
       // Iterate through all fields and checks types.
       for (const auto& field : node.fields) {
+        // Value skipped by the parser is not needed by anyone, default value is kept.
+        if (boost::get<vrml_proc::parser::model::UnparsedValue>(&field.value) != nullptr) {
+          continue;
+        }
+
         FieldType type = m_fieldTypes[field.name];
         switch (type) {
           case FieldType::Node:
@@ -227,6 +243,17 @@ namespace vrml_proc::traversor::node_descriptor {
             builder.AddField(field.name, value.value());
           } break;
 
+          case FieldType::Float32Array:
+
+          {
+            auto value =
+                ExtractFieldByNameWithValidation<vrml_proc::parser::model::Float32Array>(field.name, node.fields);
+            if (value.has_error()) {
+              return cpp::fail(value.error());
+            }
+            builder.AddField(field.name, value.value());
+          } break;
+
           case FieldType::Float32:
 
           {
@@ -316,6 +343,7 @@ namespace vrml_proc::traversor::node_descriptor {
 
    private:
     std::string m_name;
+    uint32_t m_id;
 
     std::map<std::string, FieldType> m_fieldTypes;
     std::map<std::string, std::unordered_set<std::string>> m_validHeaderNames;
@@ -338,6 +366,8 @@ namespace vrml_proc::traversor::node_descriptor {
         m_defaultVec3fArrayFields;
     std::map<std::string, std::optional<std::reference_wrapper<const vrml_proc::parser::model::Int32Array>>>
         m_defaultInt32ArrayFields;
+    std::map<std::string, std::optional<std::reference_wrapper<const vrml_proc::parser::model::Float32Array>>>
+        m_defaultFloat32ArrayFields;
     std::map<std::string, std::optional<std::reference_wrapper<const vrml_proc::parser::model::VrmlNode>>>
         m_defaultNodeFields;
     std::map<std::string, std::optional<std::vector<std::reference_wrapper<const vrml_proc::parser::model::VrmlNode>>>>
@@ -427,4 +457,11 @@ inline void vrml_proc::traversor::node_descriptor::NodeDescriptor::BindField(
     const std::string& fieldName, const vrml_proc::parser::model::Int32Array& defaultValue) {
   m_fieldTypes[fieldName] = FieldType::Int32Array;
   m_defaultInt32ArrayFields[fieldName] = std::cref(defaultValue);
+}
+
+template <>
+inline void vrml_proc::traversor::node_descriptor::NodeDescriptor::BindField(
+    const std::string& fieldName, const vrml_proc::parser::model::Float32Array& defaultValue) {
+  m_fieldTypes[fieldName] = FieldType::Float32Array;
+  m_defaultFloat32ArrayFields[fieldName] = std::cref(defaultValue);
 }
\ No newline at end of file
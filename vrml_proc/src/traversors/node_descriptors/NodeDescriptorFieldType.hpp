@@ -16,6 +16,7 @@ namespace vrml_proc::traversor::node_descriptor {
     Vec2fArray,
     Vec3fArray,
     Int32Array,
+    Float32Array,
     Node,
     NodeArray
   };
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <optional>
+#include <string>
+#include <unordered_set>
 
+#include "FieldTypeSchema.hpp"
 #include "NodeDescriptor.hpp"
 #include "Vec2fArray.hpp"
 #include "Vec3fArray.hpp"
@@ -22,7 +25,7 @@ namespace vrml_proc::traversor::node_descriptor {
   /**
    * @brief Lists all node types based on the VRML 2.0 standart.
    */
-  inline NodeDescriptorMap GetNodeDescriptorMap() {
+  inline const NodeDescriptorMap& GetNodeDescriptorMap() {
     static NodeDescriptorMap nodeDescriptionMap;
     static bool initialized = false;
 
@@ -431,11 +434,7 @@ namespace vrml_proc::traversor::node_descriptor {
       static vrml_proc::parser::model::VrmlNode defaultNormal;
       static vrml_proc::parser::model::VrmlNode defaultTexCoord;
 
-      /**
-       * @todo New type `Float32Array` have to be implemented in parser.
-       */
-
-      // static vrml_proc::parser::Float32Array defaultHeight;
+      static vrml_proc::parser::model::Float32Array defaultHeight;
       static bool defaultCcw = true;
       static bool defaultColorPerVertex = true;
       static vrml_proc::parser::model::float32_t defaultCreaseAngle = 0.0f;
@@ -446,7 +445,7 @@ namespace vrml_proc::traversor::node_descriptor {
       static int32_t defaultZDimension = 0;
       static float_t defaultZSpacing = 0.0f;
 
-      // nd.BindField("height", defaultheight);
+      nd.BindField("height", defaultHeight);
       nd.BindField("ccw", defaultCcw);
       nd.BindField("colorPerVertex", defaultColorPerVertex);
       nd.BindField("creaseAngle", defaultCreaseAngle);
@@ -474,8 +473,10 @@ namespace vrml_proc::traversor::node_descriptor {
       static vrml_proc::parser::model::Vec2fArray defaultCrossSection;
       defaultCrossSection.vectors = {{1.0f, 1.0f}, {1.0f, -1.0f}, {-1.0f, -1.0f}, {-1.0f, 1.0f}, {1.0f, 1.0f}};
       static bool defaultEndCap = true;
-      static vrml_proc::parser::model::Vec4f defaultOrientation = {0.0f, 0.0f, 1.0f, 0.0f};
-      static vrml_proc::parser::model::Vec2f defaultScale = {1.0f, 1.0f};
+      static vrml_proc::parser::model::Float32Array defaultOrientation;
+      defaultOrientation.values = {0.0f, 0.0f, 1.0f, 0.0f};
+      static vrml_proc::parser::model::Float32Array defaultScale;
+      defaultScale.values = {1.0f, 1.0f};
       static bool defaultSolid = true;
       static vrml_proc::parser::model::Vec3fArray defaultSpine;
       defaultSpine.vectors = {{0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
@@ -527,7 +528,7 @@ namespace vrml_proc::traversor::node_descriptor {
    * @todo This functionality rather should be excapsulated in the class together with NodeDescriptorMap.
    */
   inline std::optional<NodeDescriptor> CreateNodeDescriptor(const std::string& name) {
-    auto descriptorMap = GetNodeDescriptorMap();
+    const auto& descriptorMap = GetNodeDescriptorMap();
     auto it = descriptorMap.find(name);
     if (it != descriptorMap.end()) {
       return it->second();
@@ -535,4 +536,69 @@ namespace vrml_proc::traversor::node_descriptor {
 
     return std::nullopt;
   }
+
+  /**
+   * @brief Gets types of fields of all node types listed in NodeDescriptorMap. The schema is created only once.
+   *
+   * @returns schema usable by `VrmlFileGrammar`
+   */
+  inline const vrml_proc::parser::grammar::FieldTypeSchema& GetFieldTypeSchema() {
+    static const vrml_proc::parser::grammar::FieldTypeSchema schema = []() {
+      vrml_proc::parser::grammar::FieldTypeSchema result;
+      for (const auto& [name, factory] : GetNodeDescriptorMap()) {
+        auto descriptor = factory();
+        const auto& fieldTypes = descriptor.GetFieldTypes();
+        result[name] = vrml_proc::parser::grammar::NodeFieldTypes(fieldTypes.begin(), fieldTypes.end());
+      }
+      return result;
+    }();
+
+    return schema;
+  }
+
+  /**
+   * @brief Gets fields of type Float32Array of all node types listed in NodeDescriptorMap. Other numeric values cannot
+   * be read as Float32Array without a conversion, so these fields are parsed by their type even if the schema-aware
+   * parsing is off. The schema is created only once.
+   *
+   * @returns schema usable by `VrmlFileGrammar`
+   */
+  inline const vrml_proc::parser::grammar::FieldTypeSchema& GetFloat32ArrayFieldTypeSchema() {
+    static const vrml_proc::parser::grammar::FieldTypeSchema schema = []() {
+      vrml_proc::parser::grammar::FieldTypeSchema result;
+      for (const auto& [header, fieldTypes] : GetFieldTypeSchema()) {
+        for (const auto& [name, type] : fieldTypes) {
+          if (type == FieldType::Float32Array) {
+            result[header][name] = type;
+          }
+        }
+      }
+      return result;
+    }();
+
+    return schema;
+  }
+
+  /**
+   * @brief Lists numeric array fields of all node types from NodeDescriptorMap which are not requested.
+   *
+   * @param requestedFields requested fields, each written as `Header.field`
+   * @returns fields which may be skipped by the parser, keyed by node header
+   */
+  inline vrml_proc::parser::grammar::SkippedFields GetUnrequestedArrayFields(
+      const std::unordered_set<std::string>& requestedFields) {  //
+
+    vrml_proc::parser::grammar::SkippedFields result;
+    for (const auto& [header, fieldTypes] : GetFieldTypeSchema()) {
+      for (const auto& [name, type] : fieldTypes) {
+        bool isArray = type == FieldType::Vec2fArray || type == FieldType::Vec3fArray ||
+                       type == FieldType::Int32Array || type == FieldType::Float32Array;
+        if (isArray && !requestedFields.contains(header + "." + name)) {
+          result[header].insert(name);
+        }
+      }
+    }
+
+    return result;
+  }
 }  // namespace vrml_proc::traversor::node_descriptor
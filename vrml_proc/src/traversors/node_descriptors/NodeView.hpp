@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <map>
 #include <memory>
@@ -10,6 +11,7 @@
 
 #include <result.hpp>
 
+#include "Float32Array.hpp"
 #include "Int32Array.hpp"
 #include "NodeDescriptorFieldType.hpp"
 #include "TransformationMatrix.hpp"
@@ -33,6 +35,7 @@ namespace vrml_proc::traversor::node_descriptor {
      */
     NodeView()
         : m_name(""),
+          m_id(0),
           m_fieldTypes(),
           m_boolFields(),
           m_stringFields(),
@@ -44,6 +47,7 @@ namespace vrml_proc::traversor::node_descriptor {
           m_vec2fArrayFields(),
           m_vec3fArrayFields(),
           m_int32ArrayFields(),
+          m_float32ArrayFields(),
           m_nodeFields(),
           m_nodeArrayFields(),
           m_isDescendantOfShape(false),
@@ -87,7 +91,15 @@ namespace vrml_proc::traversor::node_descriptor {
      *
      * @returns node's header as string
      */
-    std::string GetName() const { return m_name; }
+    const std::string& GetName() const { return m_name; }
+
+    /**
+     * @brief Retrieves node's canonical id, which is a hash of its header (see `CanonicalHeaderHashes`). The id is
+     * computed once by the NodeDescriptor, so handlers and actions can be dispatched by it without hashing the name.
+     *
+     * @returns node's canonical id
+     */
+    uint32_t GetId() const { return m_id; }
 
     /**
      * @brief Set shape descendant flag. It the flas is se to true, it means that node is contained withing Shape node.
@@ -119,6 +131,80 @@ namespace vrml_proc::traversor::node_descriptor {
      */
     vrml_proc::math::TransformationMatrix GetTransformationMatrix() const { return m_transformationMatrix; }
 
+    /**
+     * @brief Stores the `point` data of the Coordinate node contained in the field `coord`. Data of the geometry
+     * primitive nodes are resolved once by the handler (see `HandlerUtils::ResolveGeometryPrimitiveNode()`), so actions
+     * do not have to traverse the nodes again.
+     *
+     * @param data reference to the data, or std::nullopt if the field contains no node
+     */
+    void SetCoordData(std::optional<std::reference_wrapper<const vrml_proc::parser::model::Vec3fArray>> data) {
+      m_coordData = data;
+    }
+
+    /**
+     * @brief Retrieves the `point` data of the Coordinate node contained in the field `coord`.
+     *
+     * @returns data, or std::nullopt if the field contains no node
+     */
+    std::optional<std::reference_wrapper<const vrml_proc::parser::model::Vec3fArray>> GetCoordData() const {
+      return m_coordData;
+    }
+
+    /**
+     * @brief Stores the `color` data of the Color node contained in the field `color`.
+     *
+     * @param data reference to the data, or std::nullopt if the field contains no node
+     */
+    void SetColorData(std::optional<std::reference_wrapper<const vrml_proc::parser::model::Vec3fArray>> data) {
+      m_colorData = data;
+    }
+
+    /**
+     * @brief Retrieves the `color` data of the Color node contained in the field `color`.
+     *
+     * @returns data, or std::nullopt if the field contains no node
+     */
+    std::optional<std::reference_wrapper<const vrml_proc::parser::model::Vec3fArray>> GetColorData() const {
+      return m_colorData;
+    }
+
+    /**
+     * @brief Stores the `vector` data of the Normal node contained in the field `normal`.
+     *
+     * @param data reference to the data, or std::nullopt if the field contains no node
+     */
+    void SetNormalData(std::optional<std::reference_wrapper<const vrml_proc::parser::model::Vec3fArray>> data) {
+      m_normalData = data;
+    }
+
+    /**
+     * @brief Retrieves the `vector` data of the Normal node contained in the field `normal`.
+     *
+     * @returns data, or std::nullopt if the field contains no node
+     */
+    std::optional<std::reference_wrapper<const vrml_proc::parser::model::Vec3fArray>> GetNormalData() const {
+      return m_normalData;
+    }
+
+    /**
+     * @brief Stores the `point` data of the TextureCoordinate node contained in the field `texCoord`.
+     *
+     * @param data reference to the data, or std::nullopt if the field contains no node
+     */
+    void SetTexCoordData(std::optional<std::reference_wrapper<const vrml_proc::parser::model::Vec2fArray>> data) {
+      m_texCoordData = data;
+    }
+
+    /**
+     * @brief Retrieves the `point` data of the TextureCoordinate node contained in the field `texCoord`.
+     *
+     * @returns data, or std::nullopt if the field contains no node
+     */
+    std::optional<std::reference_wrapper<const vrml_proc::parser::model::Vec2fArray>> GetTexCoordData() const {
+      return m_texCoordData;
+    }
+
     /**
      * @brief Builder architecture for this NodeView class.
      */
@@ -126,6 +212,7 @@ namespace vrml_proc::traversor::node_descriptor {
 
    private:
     std::string m_name;
+    uint32_t m_id;
     bool m_isDescendantOfShape;
     vrml_proc::math::TransformationMatrix m_transformationMatrix = vrml_proc::math::TransformationMatrix();
 
@@ -144,9 +231,16 @@ namespace vrml_proc::traversor::node_descriptor {
         m_vec3fArrayFields;
     std::map<std::string, std::optional<std::reference_wrapper<const vrml_proc::parser::model::Int32Array>>>
         m_int32ArrayFields;
+    std::map<std::string, std::optional<std::reference_wrapper<const vrml_proc::parser::model::Float32Array>>>
+        m_float32ArrayFields;
     std::map<std::string, std::optional<std::reference_wrapper<const vrml_proc::parser::model::VrmlNode>>> m_nodeFields;
     std::map<std::string, std::optional<std::vector<std::reference_wrapper<const vrml_proc::parser::model::VrmlNode>>>>
         m_nodeArrayFields;
+
+    std::optional<std::reference_wrapper<const vrml_proc::parser::model::Vec3fArray>> m_coordData;
+    std::optional<std::reference_wrapper<const vrml_proc::parser::model::Vec3fArray>> m_colorData;
+    std::optional<std::reference_wrapper<const vrml_proc::parser::model::Vec3fArray>> m_normalData;
+    std::optional<std::reference_wrapper<const vrml_proc::parser::model::Vec2fArray>> m_texCoordData;
   };
 
   class NodeView::Builder {
@@ -178,6 +272,8 @@ namespace vrml_proc::traversor::node_descriptor {
             vec3fArrayFields,
         const std::map<std::string, std::optional<std::reference_wrapper<const vrml_proc::parser::model::Int32Array>>>&
             int32ArrayFields,
+        const std::map<std::string,
+            std::optional<std::reference_wrapper<const vrml_proc::parser::model::Float32Array>>>& float32ArrayFields,
         const std::map<std::string, std::optional<std::reference_wrapper<const vrml_proc::parser::model::VrmlNode>>>&
             nodeFields,
         const std::map<std::string,
@@ -195,14 +291,16 @@ namespace vrml_proc::traversor::node_descriptor {
       m_view->m_vec2fArrayFields = vec2fArrayFields;
       m_view->m_vec3fArrayFields = vec3fArrayFields;
       m_view->m_int32ArrayFields = int32ArrayFields;
+      m_view->m_float32ArrayFields = float32ArrayFields;
       m_view->m_nodeFields = nodeFields;
       m_view->m_nodeArrayFields = nodeArrayFields;
 
       return *this;
     }
 
-    Builder& SetName(const std::string& name) {
+    Builder& SetName(const std::string& name, uint32_t id) {
       m_view->m_name = name;
+      m_view->m_id = id;
       return *this;
     }
 
@@ -273,6 +371,13 @@ namespace vrml_proc::traversor::node_descriptor {
       return *this;
     }
 
+    Builder& AddField(const std::string& name,
+        std::optional<std::reference_wrapper<const vrml_proc::parser::model::Float32Array>> value) {
+      m_view->m_float32ArrayFields[name] = value;
+      m_view->m_fieldTypes[name] = FieldType::Float32Array;
+      return *this;
+    }
+
     Builder& AddField(const std::string& name,
         std::optional<std::reference_wrapper<const vrml_proc::parser::model::VrmlNode>> value) {
       m_view->m_nodeFields[name] = value;
@@ -368,6 +473,13 @@ inline std::reference_wrapper<const vrml_proc::parser::model::Int32Array> vrml_p
   return m_int32ArrayFields.at(fieldName).value();
 }
 
+template <>
+inline std::reference_wrapper<const vrml_proc::parser::model::Float32Array> vrml_proc::traversor::node_descriptor::
+    NodeView::GetField<std::reference_wrapper<const vrml_proc::parser::model::Float32Array>>(
+        const std::string& fieldName) const {
+  return m_float32ArrayFields.at(fieldName).value();
+}
+
 template <>
 inline std::reference_wrapper<const vrml_proc::parser::model::VrmlNode> vrml_proc::traversor::node_descriptor::
     NodeView::GetField<std::reference_wrapper<const vrml_proc::parser::model::VrmlNode>>(
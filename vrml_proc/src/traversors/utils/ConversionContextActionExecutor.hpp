@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -7,6 +8,7 @@
 #include "ConversionContextable.hpp"
 #include "ConversionContextActionMap.hpp"
 #include "HandlerToActionBundle.hpp"
+#include "Hash.hpp"
 
 namespace vrml_proc::traversor::utils::ConversionContextActionExecutor {
 
@@ -14,16 +16,30 @@ namespace vrml_proc::traversor::utils::ConversionContextActionExecutor {
    * @brief Tries to execute an action. Action to execute is chosen by `key` from `actionMap`.
    * If no action is found, default ConversionContext is returned.
    *
+   * Static action of the map is preferred, because it is executed without creating the Action on the heap. It is found
+   * by `id` (hash of `key`), so handlers pass the canonical id of the node resolved by its node descriptor.
+   *
    * @param actionMap map storing all actions
+   * @param id hash of `key` (canonical id of the node, see `NodeView::GetId()`)
    * @param key string which chooses action from the map
    * @param data object which will be passed into action constructor when creating action instance from the map
    */
   template <vrml_proc::core::contract::ConversionContextable ConversionContext>
   static std::shared_ptr<ConversionContext> TryToExecute(
       const vrml_proc::action::ConversionContextActionMap<ConversionContext>& actionMap,
+      uint32_t id,
       const std::string& key,
       vrml_proc::traversor::handler::HandlerToActionBundle<ConversionContext> data) {  //
 
+    auto staticAction = actionMap.FindStaticAction(id, key);
+    if (staticAction != nullptr) {
+      std::shared_ptr<ConversionContext> result = staticAction->execute(data);
+      if (result != nullptr) {
+        return result;
+      }
+      return std::make_shared<ConversionContext>();
+    }
+
     if (actionMap.VerifyKey(key)) {
       std::shared_ptr<ConversionContext> result = actionMap.GetAction(key, data)->Execute();
       auto derivedContext = std::dynamic_pointer_cast<ConversionContext>(result);
@@ -33,4 +49,21 @@ namespace vrml_proc::traversor::utils::ConversionContextActionExecutor {
     }
     return std::make_shared<ConversionContext>();
   }
+
+  /**
+   * @brief Tries to execute an action. Action to execute is chosen by `key` from `actionMap`.
+   * If no action is found, default ConversionContext is returned.
+   *
+   * @param actionMap map storing all actions
+   * @param key string which chooses action from the map
+   * @param data object which will be passed into action constructor when creating action instance from the map
+   */
+  template <vrml_proc::core::contract::ConversionContextable ConversionContext>
+  static std::shared_ptr<ConversionContext> TryToExecute(
+      const vrml_proc::action::ConversionContextActionMap<ConversionContext>& actionMap,
+      const std::string& key,
+      vrml_proc::traversor::handler::HandlerToActionBundle<ConversionContext> data) {  //
+
+    return TryToExecute(actionMap, vrml_proc::core::utils::Hash(key), key, std::move(data));
+  }
 }  // namespace vrml_proc::traversor::utils::ConversionContextActionExecutor
@@ -0,0 +1,50 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "CommentSkipper.hpp"
+#include "test_data/Float32ArrayGrammarTestDataset.hpp"
+#include "Float32Array.hpp"
+#include "Float32ArrayGrammar.hpp"
+
+static std::optional<vrml_proc::parser::model::Float32Array> ParseFloat32Array(std::string& text) {
+  vrml_proc::parser::grammar::Float32ArrayGrammar<const char*, vrml_proc::parser::grammar::CommentSkipper> grammar;
+  vrml_proc::parser::model::Float32Array data;
+  vrml_proc::parser::grammar::CommentSkipper skipper;
+
+  const char* begin = text.c_str();
+  const char* end = text.c_str() + text.size();
+  bool success = boost::spirit::qi::phrase_parse(begin, end, grammar, skipper, data);
+  if (success && begin == end) {
+    return data;
+  }
+
+  return {};
+}
+
+TEST_CASE("Parse Float32Array - Valid Input", "[parsing][valid]") {
+  auto parseResult = ParseFloat32Array(float32Array);
+  REQUIRE(parseResult.has_value());
+
+  std::vector<float> expectedValues = {0.0f, 0.25f, 1.5f, -2.0f, 3.75f, 4.0f, -55.0f, 6.0f};
+
+  REQUIRE(parseResult.value().values.size() == expectedValues.size());
+
+  for (size_t i = 0; i < parseResult.value().values.size(); ++i) {
+    CHECK_THAT(parseResult.value().values.at(i), Catch::Matchers::WithinAbs(expectedValues.at(i), 0.0001));
+  }
+}
+
+TEST_CASE("Parse Float32Array - Empty Input", "[parsing][valid]") {
+  auto parseResult = ParseFloat32Array(emptyFloat32Array);
+  REQUIRE(parseResult.has_value());
+  CHECK(parseResult.value().values.empty());
+}
+
+TEST_CASE("Parse Float32Array - Invalid Input", "[parsing][invalid]") {
+  auto parseResult = ParseFloat32Array(invalidFloat32Array);
+  REQUIRE_FALSE(parseResult.has_value());
+}
@@ -1,21 +1,53 @@
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <system_error>
+#include <thread>
 #include <vector>
 
+#include <zlib.h>
+
+#include <ChunkedVectorConversionContext.hpp>
+#include <ConversionContextAction.hpp>
+#include <ConversionContextActionExecutor.hpp>
+#include <ConversionContextActionMap.hpp>
+#include <GzipFileReader.hpp>
+#include <HandlerUtils.hpp>
 #include <Int32Array.hpp>
+#include <IoError.hpp>
 #include <Logger.hpp>
+#include <MetricsCollector.hpp>
 #include <NodeDescriptor.hpp>
+#include <NodeDescriptorMap.hpp>
 #include <NodeValidationError.hpp>
+#include <PipelineTaskRunner.hpp>
+#include <TaskflowUtils.hpp>
+#include <ThreadTaskRunner.hpp>
+#include <Tracer.hpp>
 #include <UseNode.hpp>
 #include <Vec2f.hpp>
 #include <Vec2fArray.hpp>
 #include <Vec3f.hpp>
 #include <Vec3fArray.hpp>
 #include <Vec4f.hpp>
+#include <VrmlCanonicalHeaderHashes.hpp>
 #include <VrmlField.hpp>
 #include <VrmlHeaders.hpp>
 #include <VrmlNode.hpp>
+#include <VectorConversionContext.hpp>
 #include <VrmlNodeManager.hpp>
 
 #include "../../test_utils/TestCommon.hpp"
@@ -106,6 +138,8 @@ TEST_CASE("NodeDescriptor", "NodeDescriptor") {  //
     vrml_proc::traversor::node_descriptor::NodeDescriptor nd("Group");
 
     CHECK(nd.Validate(node, manager, headersMap, true).has_value());
+    CHECK(nd.Validate(node, manager, headersMap, true).value()->GetId() ==
+          vrml_proc::traversor::node_descriptor::CanonicalHeaderHashes::Group);
 
     node.header = "VRMLGroup";
 
@@ -373,3 +407,637 @@ TEST_CASE("NodeDescriptor", "NodeDescriptor") {  //
     CHECK(CheckInnermostError<vrml_proc::traversor::validation::error::InvalidStringValueError>(result2.error()));
   }
 }
+
+/**
+ * @brief Compresses `data` into one gzip member. If `bgzf` is set, the member carries its size in the BGZF extra field.
+ */
+static std::string CreateGzipMember(const std::string& data, bool bgzf) {
+  z_stream stream{};
+  deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+  std::string deflated(deflateBound(&stream, static_cast<uLong>(data.size())), '\0');
+  stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+  stream.avail_in = static_cast<uInt>(data.size());
+  stream.next_out = reinterpret_cast<Bytef*>(deflated.data());
+  stream.avail_out = static_cast<uInt>(deflated.size());
+  deflate(&stream, Z_FINISH);
+  deflated.resize(stream.total_out);
+  deflateEnd(&stream);
+
+  auto appendLittleEndian = [](std::string& output, uint32_t value, int bytes) {
+    for (int i = 0; i < bytes; ++i) {
+      output.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+  };
+
+  std::string member = {'\x1f', '\x8b', '\x08', static_cast<char>(bgzf ? 0x04 : 0x00), 0, 0, 0, 0, 0, '\xff'};
+  if (bgzf) {
+    appendLittleEndian(member, 6, 2);
+    member += "BC";
+    appendLittleEndian(member, 2, 2);
+    appendLittleEndian(member, static_cast<uint32_t>(member.size() + 2 + deflated.size() + 8 - 1), 2);
+  }
+  member += deflated;
+  appendLittleEndian(member, crc32(0, reinterpret_cast<const Bytef*>(data.data()), static_cast<uInt>(data.size())), 4);
+  appendLittleEndian(member, static_cast<uint32_t>(data.size()), 4);
+  return member;
+}
+
+/**
+ * @brief Temporary file which is removed when the object is destroyed.
+ */
+struct TemporaryFile {
+  TemporaryFile(const std::string& filename, const std::string& content)
+      : path(std::filesystem::temp_directory_path() / filename) {
+    std::ofstream file(path, std::ios::binary);
+    file.write(content.data(), content.size());
+  }
+  ~TemporaryFile() {
+    std::error_code error;
+    std::filesystem::remove(path, error);
+  }
+  std::filesystem::path path;
+};
+
+TEST_CASE("GzipFileReader", "GzipFileReader") {  //
+
+  std::string vrml = "#VRML V2.0 utf8\n";
+  for (int i = 0; i < 2000; ++i) {
+    vrml += "Shape { geometry Box { size " + std::to_string(i) + " 1 1 } }\n";
+  }
+
+  SECTION("Single member") {
+    TemporaryFile file("vrmlproc_single.wrl.gz", CreateGzipMember(vrml, false));
+    CHECK(vrml_proc::core::io::GzipFileReader::IsGzipFile(file.path));
+
+    vrml_proc::core::io::GzipFileReader reader;
+    auto result = reader.Read(file.path);
+    REQUIRE(result.has_value());
+    CHECK(std::string(result.value().GetBegin(), result.value().GetEnd()) == vrml);
+  }
+
+  SECTION("Multiple members") {
+    TemporaryFile file("vrmlproc_multi.wrl.gz",
+        CreateGzipMember(vrml.substr(0, 100), false) + CreateGzipMember(vrml.substr(100), false));
+
+    vrml_proc::core::io::GzipFileReader reader(1);
+    auto result = reader.Read(file.path);
+    REQUIRE(result.has_value());
+    CHECK(std::string(result.value().GetBegin(), result.value().GetEnd()) == vrml);
+  }
+
+  SECTION("Output bigger than one chunk") {
+    std::string big;
+    while (big.size() < (3 << 20)) {
+      big += vrml;
+    }
+    TemporaryFile file("vrmlproc_big.wrl.gz", CreateGzipMember(big, false));
+
+    vrml_proc::core::io::GzipFileReader reader(1);
+    auto result = reader.Read(file.path);
+    REQUIRE(result.has_value());
+    CHECK(std::string(result.value().GetBegin(), result.value().GetEnd()) == big);
+  }
+
+  SECTION("BGZF members") {
+    std::string compressed;
+    for (size_t offset = 0; offset < vrml.size(); offset += 4096) {
+      compressed += CreateGzipMember(vrml.substr(offset, 4096), true);
+    }
+    compressed += CreateGzipMember("", true);
+    TemporaryFile file("vrmlproc_bgzf.wrl.gz", compressed);
+
+    vrml_proc::core::io::GzipFileReader reader(4);
+    auto result = reader.Read(file.path);
+    REQUIRE(result.has_value());
+    CHECK(result.value().GetSize() == vrml.size());
+    CHECK(std::string(result.value().GetBegin(), result.value().GetEnd()) == vrml);
+  }
+
+  SECTION("Invalid files") {
+    TemporaryFile plain("vrmlproc_plain.wrl", vrml);
+    CHECK_FALSE(vrml_proc::core::io::GzipFileReader::IsGzipFile(plain.path));
+
+    std::string member = CreateGzipMember(vrml, false);
+    TemporaryFile truncated("vrmlproc_truncated.wrl.gz", member.substr(0, member.size() / 2));
+
+    vrml_proc::core::io::GzipFileReader reader;
+    auto result = reader.Read(truncated.path);
+    REQUIRE(result.has_error());
+    CHECK(CheckInnermostError<vrml_proc::core::io::error::DecompressionError>(result.error()));
+
+    /** Corrupted ISIZE field is not trusted for the allocation, the stream fails on its length check. */
+    member.replace(member.size() - 4, 4, "\xff\xff\xff\xff");
+    TemporaryFile corrupted("vrmlproc_corrupted.wrl.gz", member);
+    auto corruptedResult = reader.Read(corrupted.path);
+    REQUIRE(corruptedResult.has_error());
+    CHECK(CheckInnermostError<vrml_proc::core::io::error::DecompressionError>(corruptedResult.error()));
+  }
+}
+
+TEST_CASE("Logging - asynchronous sink after shutdown", "Logger") {  //
+
+  using namespace vrml_proc::core::logger;
+
+  auto directory = std::filesystem::temp_directory_path() / "vrmlproc_logging_test";
+  std::filesystem::remove_all(directory);
+
+  LoggingSettings settings;
+  settings.asynchronous = true;
+  settings.flushIntervalMilliseconds = 10;
+  InitLogging(directory.string(), "test", settings);
+  ShutdownLogging();
+
+  /** Periodic flushes must run again, so the message is written without an explicit flush. */
+  InitLogging(directory.string(), "test", settings);
+  LogInfo("Message after shutdown.", LOGGING_INFO);
+
+  auto containsMessage = [&directory]() {
+    for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+      std::ifstream file(entry.path());
+      std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+      if (content.find("Message after shutdown.") != std::string::npos) {
+        return true;
+      }
+    }
+    return false;
+  };
+  bool found = false;
+  for (int attempt = 0; attempt < 100 && !found; ++attempt) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    found = containsMessage();
+  }
+  CHECK(found);
+
+  ShutdownLogging();
+  InitLogging();
+  std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("MetricsCollector", "MetricsCollector") {  //
+
+  vrml_proc::core::metrics::MetricsCollector metrics;
+
+  metrics.StartStage("read");
+  metrics.EndStage().bytesRead = 1024;
+  metrics.StartStage("parse");
+  metrics.StartStage("write");
+  metrics.EndStage().bytesWritten = 2048;
+  /** Ending without a stage in progress records nothing. */
+  metrics.EndStage().bytesWritten = 4096;
+
+  REQUIRE(metrics.GetStages().size() == 3);
+  CHECK(metrics.GetStages()[0].name == "read");
+  CHECK(metrics.GetStages()[0].bytesRead == 1024);
+  CHECK(metrics.GetStages()[1].name == "parse");
+  CHECK(metrics.GetStages()[1].wallTime >= 0.0);
+  CHECK(metrics.GetStages()[2].bytesWritten == 2048);
+
+  for (int i = 1; i <= 100; ++i) {
+    metrics.RecordTask(static_cast<double>(i), i != 100);
+  }
+  metrics.SetCounter("rootNodes", 7);
+  metrics.SetNodeTypesCount({{"Shape", 3}, {"Transform", 1}});
+  metrics.SetSuccessful(true);
+
+  auto report = metrics.ToJson();
+  CHECK(report["successful"] == true);
+  CHECK(report["stages"].size() == 3);
+  CHECK(report["stages"][2]["name"] == "write");
+  CHECK(report["counters"]["rootNodes"] == 7);
+  CHECK(report["nodeTypes"]["Shape"] == 3);
+  CHECK(report["tasks"]["count"] == 100);
+  CHECK(report["tasks"]["failed"] == 1);
+  CHECK(report["tasks"]["time"]["p50"] == 50.0);
+  CHECK(report["tasks"]["time"]["p95"] == 95.0);
+  CHECK(report["tasks"]["time"]["max"] == 100.0);
+}
+
+TEST_CASE("Tracer", "Tracer") {  //
+
+  using vrml_proc::core::metrics::TraceSpan;
+  using vrml_proc::core::metrics::Tracer;
+
+  Tracer::SetEnabled(false);
+  {
+    auto span = TraceSpan("ignored");
+    CHECK_FALSE(span.IsActive());
+  }
+
+  Tracer::SetEnabled(true);
+  {
+    auto span = TraceSpan("parse", "parser");
+    span.AddArgument("bytes", 42);
+    span.AddArgument("header", std::string("Shape"));
+    CHECK(span.IsActive());
+  }
+  std::thread([]() { auto span = TraceSpan("mesh task"); }).join();
+  Tracer::SetEnabled(false);
+
+  auto trace = Tracer::ToChromeTraceJson();
+  std::vector<nlohmann::json> spans;
+  for (const auto& event : trace["traceEvents"]) {
+    if (event["ph"] == "X") {
+      spans.push_back(event);
+    }
+  }
+
+  REQUIRE(spans.size() == 2);
+  CHECK(spans[0]["name"] == "parse");
+  CHECK(spans[0]["cat"] == "parser");
+  CHECK(spans[0]["dur"] >= 0);
+  CHECK(spans[0]["args"]["bytes"] == 42);
+  CHECK(spans[0]["args"]["header"] == "Shape");
+  CHECK(spans[1]["name"] == "mesh task");
+  CHECK(spans[1]["tid"] != spans[0]["tid"]);
+}
+
+TEST_CASE("HandlerUtils - geometry primitive nodes are resolved", "HandlerUtils") {  //
+
+  using vrml_proc::parser::model::Vec2fArray;
+  using vrml_proc::parser::model::Vec3fArray;
+  using vrml_proc::traversor::handler::HandlerUtils::ResolveGeometryPrimitiveNode;
+
+  vrml_proc::parser::model::VrmlField pointField;
+  pointField.name = "point";
+  Vec3fArray points;
+  points.vectors.push_back(vrml_proc::parser::model::Vec3f(0.0f, 1.0f, 2.0f));
+  pointField.value = points;
+
+  vrml_proc::parser::model::VrmlNode coordinate;
+  coordinate.header = "Coordinate";
+  coordinate.fields.push_back(pointField);
+
+  vrml_proc::parser::model::VrmlField texCoordPointField;
+  texCoordPointField.name = "point";
+  Vec2fArray texCoordPoints;
+  texCoordPoints.vectors.push_back(vrml_proc::parser::model::Vec2f(0.5f, 1.0f));
+  texCoordPointField.value = texCoordPoints;
+
+  vrml_proc::parser::model::VrmlNode textureCoordinate;
+  textureCoordinate.header = "TextureCoordinate";
+  textureCoordinate.fields.push_back(texCoordPointField);
+
+  vrml_proc::parser::model::VrmlField coordField;
+  coordField.name = "coord";
+  coordField.value = coordinate;
+
+  vrml_proc::parser::model::VrmlField texCoordField;
+  texCoordField.name = "texCoord";
+  texCoordField.value = textureCoordinate;
+
+  vrml_proc::parser::model::VrmlNode ifs;
+  ifs.header = "IndexedFaceSet";
+  ifs.fields.push_back(coordField);
+  ifs.fields.push_back(texCoordField);
+
+  vrml_proc::parser::service::VrmlNodeManager manager;
+  vrml_proc::traversor::node_descriptor::VrmlHeaders headersMap;
+
+  {
+    auto nd = vrml_proc::traversor::node_descriptor::CreateNodeDescriptor("IndexedFaceSet");
+    REQUIRE(nd.has_value());
+    auto view = nd.value().Validate(ifs, manager, headersMap);
+    REQUIRE(view.has_value());
+
+    auto resolvedPoints = ResolveGeometryPrimitiveNode<Vec3fArray>(*view.value(), "coord", "point");
+    REQUIRE(resolvedPoints.has_value());
+    REQUIRE(resolvedPoints.value().has_value());
+    REQUIRE(resolvedPoints.value().value().get().vectors.size() == 1);
+    CHECK(resolvedPoints.value().value().get().vectors[0].z == 2.0f);
+
+    auto resolvedTexCoords = ResolveGeometryPrimitiveNode<Vec2fArray>(*view.value(), "texCoord", "point");
+    REQUIRE(resolvedTexCoords.has_value());
+    REQUIRE(resolvedTexCoords.value().has_value());
+    CHECK(resolvedTexCoords.value().value().get().vectors[0].u == 0.5f);
+
+    auto resolvedNormals = ResolveGeometryPrimitiveNode<Vec3fArray>(*view.value(), "normal", "vector");
+    REQUIRE(resolvedNormals.has_value());
+    CHECK_FALSE(resolvedNormals.value().has_value());
+
+    /** Wrong type of the data field. */
+    CHECK(ResolveGeometryPrimitiveNode<Vec2fArray>(*view.value(), "coord", "point").has_error());
+  }
+
+  {
+    vrml_proc::parser::model::VrmlField invalidField;
+    invalidField.name = "points";
+    invalidField.value = points;
+
+    vrml_proc::parser::model::VrmlNode invalidCoordinate;
+    invalidCoordinate.header = "Coordinate";
+    invalidCoordinate.fields.push_back(invalidField);
+    ifs.fields[0].value = invalidCoordinate;
+
+    auto nd = vrml_proc::traversor::node_descriptor::CreateNodeDescriptor("IndexedFaceSet");
+    REQUIRE(nd.has_value());
+    auto view = nd.value().Validate(ifs, manager, headersMap);
+    REQUIRE(view.has_value());
+
+    CHECK(ResolveGeometryPrimitiveNode<Vec3fArray>(*view.value(), "coord", "point").has_error());
+  }
+}
+
+using TestConversionContext = vrml_proc::conversion_context::VectorConversionContext<int>;
+
+class TestAction : public vrml_proc::action::ConversionContextAction<TestConversionContext> {
+ public:
+  explicit TestAction(int value) : m_value(value) {}
+
+  std::shared_ptr<TestConversionContext> Execute() override {
+    auto result = std::make_shared<TestConversionContext>();
+    result->Add(int(m_value));
+    return result;
+  }
+
+ private:
+  int m_value;
+};
+
+static int StaticActionValue(const vrml_proc::traversor::handler::HandlerToActionBundle<TestConversionContext>&) {
+  return 1;
+}
+
+static int OtherStaticActionValue(
+    const vrml_proc::traversor::handler::HandlerToActionBundle<TestConversionContext>&) {
+  return 2;
+}
+
+TEST_CASE("ConversionContextActionMap - static actions", "ConversionContextActionMap") {  //
+
+  using vrml_proc::traversor::utils::ConversionContextActionExecutor::TryToExecute;
+  using ActionMap = vrml_proc::action::ConversionContextActionMap<TestConversionContext>;
+
+  static constexpr std::array staticActions{
+      ActionMap::MakeStaticAction<TestAction, StaticActionValue>("Group"),
+      ActionMap::MakeStaticAction<TestAction, OtherStaticActionValue>("Transform"),
+  };
+
+  ActionMap actionMap;
+  actionMap.SetStaticActions(staticActions);
+  ActionMap::Argument data;
+
+  CHECK(actionMap.VerifyKey("Group"));
+  CHECK(actionMap.VerifyKey("Transform"));
+  CHECK_FALSE(actionMap.VerifyKey("Shape"));
+  REQUIRE(actionMap.FindStaticAction("Group") != nullptr);
+  CHECK(actionMap.FindStaticAction("Shape") == nullptr);
+
+  auto result = TryToExecute(actionMap, "Transform", data);
+  REQUIRE(result->GetData().size() == 1);
+  CHECK(result->GetData()[0] == 2);
+
+  /** Handlers dispatch by the canonical id of the node, which is the hash of its name. */
+  using vrml_proc::core::utils::Hash;
+  REQUIRE(actionMap.FindStaticAction(Hash("Group"), "Group") != nullptr);
+  CHECK(actionMap.FindStaticAction(Hash("Group"), "Transform") == nullptr);
+  CHECK(TryToExecute(actionMap, Hash("Group"), "Group", data)->GetData()[0] == 1);
+  CHECK(TryToExecute(actionMap, Hash("Shape"), "Shape", data)->IsEmpty());
+
+  auto created = actionMap.GetAction("Group", data);
+  REQUIRE(created != nullptr);
+  CHECK(created->Execute()->GetData()[0] == 1);
+
+  CHECK(TryToExecute(actionMap, "Shape", data)->IsEmpty());
+
+  CHECK_FALSE(actionMap.GetRequestedFields().has_value());
+  static constexpr std::array<std::string_view, 2> requestedFields{"Group.children", "Coordinate.point"};
+  actionMap.SetRequestedFields(requestedFields);
+  REQUIRE(actionMap.GetRequestedFields().has_value());
+  CHECK(actionMap.GetRequestedFields()->contains("Coordinate.point"));
+  CHECK_FALSE(actionMap.GetRequestedFields()->contains("Normal.vector"));
+
+  /** Runtime action overrides the static one with the same key. */
+  actionMap.AddAction("Group", [](ActionMap::Argument) { return std::make_shared<TestAction>(3); });
+  CHECK(actionMap.FindStaticAction("Group") == nullptr);
+  CHECK(TryToExecute(actionMap, "Group", data)->GetData()[0] == 3);
+  CHECK(TryToExecute(actionMap, "Transform", data)->GetData()[0] == 2);
+  /** Fields read by a runtime action are not known. */
+  CHECK_FALSE(actionMap.GetRequestedFields().has_value());
+
+  /** Runtime action is kept if the static table is set afterwards. */
+  actionMap.SetStaticActions(staticActions);
+  CHECK(TryToExecute(actionMap, "Group", data)->GetData()[0] == 3);
+}
+
+TEST_CASE("ConversionContextActionMap - static actions with colliding slots", "ConversionContextActionMap") {  //
+
+  using vrml_proc::traversor::utils::ConversionContextActionExecutor::TryToExecute;
+  using ActionMap = vrml_proc::action::ConversionContextActionMap<TestConversionContext>;
+
+  /** Pairs of keys whose hashes are equal in the low bits share a slot of the table, so they have to be probed. */
+  static constexpr std::array staticActions{
+      ActionMap::MakeStaticAction<TestAction, StaticActionValue>("Box"),
+      ActionMap::MakeStaticAction<TestAction, OtherStaticActionValue>("Normal"),
+      ActionMap::MakeStaticAction<TestAction, StaticActionValue>("Cone"),
+      ActionMap::MakeStaticAction<TestAction, OtherStaticActionValue>("Text"),
+      ActionMap::MakeStaticAction<TestAction, StaticActionValue>("ElevationGrid"),
+      ActionMap::MakeStaticAction<TestAction, OtherStaticActionValue>("Group"),
+      ActionMap::MakeStaticAction<TestAction, StaticActionValue>("Extrusion"),
+      ActionMap::MakeStaticAction<TestAction, OtherStaticActionValue>("Shape"),
+      ActionMap::MakeStaticAction<TestAction, StaticActionValue>("IndexedFaceSet"),
+      ActionMap::MakeStaticAction<TestAction, OtherStaticActionValue>("Transform"),
+  };
+  for (size_t i = 0; i < staticActions.size(); i += 2) {
+    REQUIRE((staticActions[i].id & 31) == (staticActions[i + 1].id & 31));
+  }
+
+  ActionMap actionMap;
+  CHECK(actionMap.FindStaticAction("Box") == nullptr);
+  actionMap.SetStaticActions(staticActions);
+  ActionMap::Argument data;
+
+  for (size_t i = 0; i < staticActions.size(); ++i) {
+    std::string key(staticActions[i].key);
+    auto staticAction = actionMap.FindStaticAction(staticActions[i].id, key);
+    REQUIRE(staticAction != nullptr);
+    CHECK(staticAction->key == key);
+    CHECK(TryToExecute(actionMap, staticActions[i].id, key, data)->GetData()[0] == (i % 2 == 0 ? 1 : 2));
+  }
+  /** `TextureTransform` shares the slot with `ElevationGrid` and `Group`. */
+  CHECK(actionMap.FindStaticAction("TextureTransform") == nullptr);
+  CHECK(actionMap.FindStaticAction("") == nullptr);
+}
+
+TEST_CASE("ChunkedVectorConversionContext", "ChunkedVectorConversionContext") {  //
+
+  using Context = vrml_proc::conversion_context::ChunkedVectorConversionContext<int>;
+
+  Context root;
+  CHECK(root.IsEmpty());
+  CHECK(root.GetData().empty());
+
+  root.Add(1);
+  auto child = std::make_shared<Context>();
+  child->Add(2);
+  child->CopyAndAdd(3);
+  auto grandchild = std::make_shared<Context>();
+  grandchild->Add(4);
+
+  child->Merge(grandchild.get());
+  CHECK(grandchild->IsEmpty());
+  root.Merge(child.get());
+  CHECK(child->IsEmpty());
+  root.Merge(std::make_shared<Context>().get());
+  root.Merge(nullptr);
+  root.Add(5);
+
+  CHECK(root.GetSize() == 5);
+  std::vector<int> visited;
+  root.ForEach([&visited](int value) { visited.push_back(value); });
+  CHECK(visited == std::vector<int>{1, 2, 3, 4, 5});
+  CHECK(root.GetData() == std::vector<int>{1, 2, 3, 4, 5});
+  CHECK(root.GetData().size() == 5);
+
+  vrml_proc::conversion_context::VectorConversionContext<int> other;
+  CHECK_THROWS_AS(root.Merge(&other), std::invalid_argument);
+}
+
+TEST_CASE("ThreadTaskRunner - longest-first", "ThreadTaskRunner") {  //
+
+  std::vector<size_t> costs = {1, 50, 2, 100, 3, 1};
+  std::mutex startedMutex;
+  std::vector<size_t> started;
+  std::vector<std::function<size_t()>> tasks;
+  for (size_t i = 0; i < costs.size(); ++i) {
+    tasks.push_back([i, &started, &startedMutex]() {
+      std::scoped_lock lock(startedMutex);
+      started.push_back(i);
+      return i * 10;
+    });
+  }
+
+  {
+    vrml_proc::core::parallelism::ThreadTaskRunner<std::function<size_t()>, size_t> runner(1);
+    std::vector<size_t> results;
+    runner.Run(tasks, results, costs);
+    CHECK(results == std::vector<size_t>{0, 10, 20, 30, 40, 50});
+    CHECK(started == std::vector<size_t>{3, 1, 4, 2, 0, 5});
+  }
+
+  {
+    started.clear();
+    vrml_proc::core::parallelism::ThreadTaskRunner<std::function<size_t()>, size_t> runner(4);
+    std::vector<size_t> results;
+    runner.Run(tasks, results, costs, 10);
+    CHECK(results == std::vector<size_t>{0, 10, 20, 30, 40, 50});
+    CHECK(started.size() == tasks.size());
+  }
+
+  {
+    vrml_proc::core::parallelism::ThreadTaskRunner<std::function<size_t()>, size_t> runner(1);
+    std::vector<size_t> results;
+    CHECK_THROWS_AS(runner.Run(tasks, results, {1, 2}), std::invalid_argument);
+  }
+}
+
+TEST_CASE("PipelineTaskRunner - tasks with costs", "PipelineTaskRunner") {  //
+
+  vrml_proc::core::parallelism::PipelineTaskRunner<std::function<size_t()>, size_t> runner(4, 10);
+  std::vector<size_t> consumed;
+  auto consuming = std::async(std::launch::async, [&runner, &consumed]() {
+    return runner.Consume([&consumed](size_t&& result) { consumed.push_back(result); });
+  });
+
+  for (size_t i = 0; i < 100; ++i) {
+    runner.Submit([i]() { return i; }, i % 7);
+  }
+  runner.Close();
+
+  CHECK(consuming.get() == 100);
+  REQUIRE(consumed.size() == 100);
+  std::sort(consumed.begin(), consumed.end());
+  for (size_t i = 0; i < consumed.size(); ++i) {
+    CHECK(consumed[i] == i);
+  }
+}
+
+TEST_CASE("PipelineTaskRunner - results in completion order", "PipelineTaskRunner") {  //
+
+  /** The first task finishes only after the result of the second one is consumed. */
+  vrml_proc::core::parallelism::PipelineTaskRunner<std::function<size_t()>, size_t> runner(2, 0);
+  std::promise<void> secondConsumed;
+  std::shared_future<void> isSecondConsumed = secondConsumed.get_future().share();
+  runner.Submit([isSecondConsumed]() {
+    isSecondConsumed.wait_for(std::chrono::seconds(10));
+    return size_t(0);
+  });
+  runner.Submit([]() { return size_t(1); });
+  runner.Close();
+
+  std::vector<size_t> consumed;
+  CHECK(runner.Consume([&consumed, &secondConsumed](size_t&& result) {
+    consumed.push_back(result);
+    if (result == 1) {
+      secondConsumed.set_value();
+    }
+  }) == 2);
+  CHECK(consumed == std::vector<size_t>{1, 0});
+}
+
+TEST_CASE("PipelineTaskRunner - longest-first", "PipelineTaskRunner") {  //
+
+  vrml_proc::core::parallelism::PipelineTaskRunner<std::function<size_t()>, size_t> runner(1, 0);
+  std::vector<size_t> started;
+
+  /** The only thread is blocked by the first task until all the other tasks are submitted. */
+  std::promise<void> submitted;
+  std::shared_future<void> allSubmitted = submitted.get_future().share();
+  runner.Submit(
+      [allSubmitted]() {
+        allSubmitted.wait();
+        return size_t(0);
+      },
+      std::numeric_limits<size_t>::max());
+
+  std::vector<size_t> costs = {1, 50, 2, 100, 3, 1};
+  for (size_t i = 0; i < costs.size(); ++i) {
+    runner.Submit(
+        [i, &started]() {
+          started.push_back(i);
+          return i;
+        },
+        costs[i]);
+  }
+  submitted.set_value();
+  runner.Close();
+
+  CHECK(runner.Consume([](size_t&&) {}) == costs.size() + 1);
+  CHECK(started == std::vector<size_t>{3, 1, 4, 2, 0, 5});
+}
+
+TEST_CASE("PipelineTaskRunner - nested taskflows on the executor of the runner", "PipelineTaskRunner") {  //
+
+  /** With a single worker, the nested taskflows finish only if the worker runs them itself while it waits. */
+  vrml_proc::core::parallelism::PipelineTaskRunner<std::function<size_t()>, size_t> runner(1, 0);
+  std::vector<size_t> consumed;
+  auto consuming = std::async(std::launch::async, [&runner, &consumed]() {
+    return runner.Consume([&consumed](size_t&& result) { consumed.push_back(result); });
+  });
+
+  for (size_t i = 0; i < 10; ++i) {
+    runner.Submit([i, &runner]() {
+      std::vector<size_t> parts(4, 0);
+      tf::Taskflow taskflow;
+      for (size_t part = 0; part < parts.size(); ++part) {
+        taskflow.emplace([i, part, &parts]() { parts[part] = i * 10 + part; });
+      }
+      vrml_proc::core::parallelism::RunAndWait(runner.GetExecutor(), taskflow);
+      return parts[0] + parts[1] + parts[2] + parts[3];
+    });
+  }
+  runner.Close();
+
+  CHECK(consuming.get() == 10);
+  REQUIRE(consumed.size() == 10);
+  std::sort(consumed.begin(), consumed.end());
+  for (size_t i = 0; i < consumed.size(); ++i) {
+    CHECK(consumed[i] == i * 40 + 6);
+  }
+
+  /** Outside of the worker threads, the taskflow is simply run and waited for. */
+  size_t value = 0;
+  tf::Taskflow taskflow;
+  taskflow.emplace([&value]() { value = 42; });
+  vrml_proc::core::parallelism::RunAndWait(runner.GetExecutor(), taskflow);
+  CHECK(value == 42);
+}
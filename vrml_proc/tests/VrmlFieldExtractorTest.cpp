@@ -10,6 +10,7 @@
 #include <boost/variant/variant.hpp>
 
 #include "test_data/VrmlFieldExtractorTestDataset.hpp"
+#include <Float32Array.hpp>
 #include <Int32Array.hpp>
 #include <Logger.hpp>
 #include <ParserResult.hpp>
@@ -742,4 +743,41 @@ TEST_CASE("ExtractByNameExtended - Edge cases - Complicated example", "[valid]")
 
   CHECK_FALSE(&(result5.value().get()) == &(result1.value().get()));
   CHECK_FALSE(&(result6.value().get()) == &(result3.value().get()));
-}
\ No newline at end of file
+}
+TEST_CASE("ExtractByNameExtended - Edge cases - Numeric arrays as Float32Array", "[valid]") {
+  using vrml_proc::parser::model::Float32Array;
+
+  vrml_proc::parser::service::VrmlNodeManager manager;
+  auto parseResult = ParseVrmlFile(float32ArrayEdgeCase, manager);
+  REQUIRE(parseResult);
+
+  auto& fieldsOfElevationGrid = parseResult.value().at(0).fields;
+  REQUIRE(boost::get<Float32Array>(&fieldsOfElevationGrid.at(0).value) != nullptr);
+
+  auto height = vrml_proc::parser::model::utils::VrmlFieldExtractor::ExtractByName<Float32Array>(
+      "height", fieldsOfElevationGrid);
+  REQUIRE(height.has_value());
+  CHECK(height.value().get().values == std::vector<float>{1.0f, 2.0f, 3.0f, 4.0f});
+  CHECK(&(height.value().get()) == boost::get<Float32Array>(&fieldsOfElevationGrid.at(0).value));
+
+  auto& fieldsOfExtrusion = parseResult.value().at(1).fields;
+  REQUIRE(boost::get<Float32Array>(&fieldsOfExtrusion.at(0).value) != nullptr);
+  REQUIRE(boost::get<Float32Array>(&fieldsOfExtrusion.at(1).value) != nullptr);
+
+  auto scale =
+      vrml_proc::parser::model::utils::VrmlFieldExtractor::ExtractByName<Float32Array>("scale", fieldsOfExtrusion);
+  REQUIRE(scale.has_value());
+  CHECK(scale.value().get().values == std::vector<float>{0.5f, 1.5f});
+  CHECK(&(scale.value().get()) == boost::get<Float32Array>(&fieldsOfExtrusion.at(0).value));
+
+  auto orientation = vrml_proc::parser::model::utils::VrmlFieldExtractor::ExtractByName<Float32Array>(
+      "orientation", fieldsOfExtrusion);
+  REQUIRE(orientation.has_value());
+  CHECK(orientation.value().get().values == std::vector<float>{0.0f, 1.0f, 0.0f, 1.5f});
+  CHECK(&(orientation.value().get()) == boost::get<Float32Array>(&fieldsOfExtrusion.at(1).value));
+
+  auto& fieldsOfTest = parseResult.value().at(2).fields;
+  auto vectors =
+      vrml_proc::parser::model::utils::VrmlFieldExtractor::ExtractByName<Float32Array>("vectors", fieldsOfTest);
+  CHECK(vectors.has_error());
+}
@@ -1,6 +1,11 @@
-﻿#include <catch2/catch_test_macros.hpp>
+﻿#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 
+#include <algorithm>
+#include <functional>
+#include <sstream>
+#include <string>
 #include <vector> 
 
 #include <boost/optional/optional.hpp>
@@ -13,15 +18,22 @@
 #include "test_data/VrmlFileGrammarTestDataset.hpp"
 #include <Int32Array.hpp>
 #include <Logger.hpp>
+#include <ParserError.hpp>
 #include <ParserResult.hpp>
+#include <ScannerError.hpp>
+#include <UnparsedValue.hpp>
 #include <UseNode.hpp>
+#include <Vec2f.hpp>
 #include <Vec3f.hpp>
 #include <Vec3fArray.hpp>
+#include <Vec4f.hpp>
 #include <VrmlField.hpp>
+#include <VrmlFieldExtractor.hpp>
 #include <VrmlFile.hpp>
 #include <VrmlNode.hpp>
 #include <VrmlNodeManager.hpp>
 #include <VrmlParser.hpp>
+#include <VrmlScanner.hpp>
 #include <VrmlUnits.hpp>
 
 #include "../../test_utils/TestCommon.hpp"
@@ -69,6 +81,50 @@ TEST_CASE("Parse VRML File - Valid Input - Simple VRML File Ivalid Starting With
   REQUIRE_FALSE(parseResult);
 }
 
+TEST_CASE("Parse VRML File - Invalid Input - Error Position", "[parsing][invalid]") {
+  using vrml_proc::parser::error::ParserSyntaxError;
+
+  {
+    vrml_proc::parser::service::VrmlNodeManager manager;
+    auto parseResult = ParseVrmlFile(simpleInvalidChar, manager);
+    REQUIRE_FALSE(parseResult);
+    auto error = GetInnermostError<ParserSyntaxError>(parseResult.error());
+    REQUIRE(error != nullptr);
+    CHECK(error->GetLine() == 5);
+    CHECK(error->GetColumn() == 2);
+  }
+  {
+    std::string missingValue = "#VRML V2.0 utf8\nShape {\n  geometry Box { size }\n}\n";
+    vrml_proc::parser::service::VrmlNodeManager manager;
+    auto parseResult = ParseVrmlFile(missingValue, manager);
+    REQUIRE_FALSE(parseResult);
+    auto error = GetInnermostError<ParserSyntaxError>(parseResult.error());
+    REQUIRE(error != nullptr);
+    CHECK(error->GetOffset() == missingValue.find('}'));
+    CHECK(error->GetLine() == 3);
+    CHECK(error->GetExpected() == "<field value>");
+  }
+  {
+    std::string unclosed = "#VRML V2.0 utf8\nShape {\n  geometry Box { size 1 2 3 }\n";
+    vrml_proc::parser::service::VrmlNodeManager manager;
+    auto parseResult = ParseVrmlFile(unclosed, manager);
+    REQUIRE_FALSE(parseResult);
+    auto error = GetInnermostError<ParserSyntaxError>(parseResult.error());
+    REQUIRE(error != nullptr);
+    CHECK(error->GetOffset() == unclosed.size());
+    CHECK(error->GetExpected() == "\"}\"");
+  }
+  {
+    std::string missingHeader = "Shape { }";
+    vrml_proc::parser::service::VrmlNodeManager manager;
+    auto parseResult = ParseVrmlFile(missingHeader, manager);
+    REQUIRE_FALSE(parseResult);
+    auto error = GetInnermostError<ParserSyntaxError>(parseResult.error());
+    REQUIRE(error != nullptr);
+    CHECK(error->GetOffset() == 0);
+  }
+}
+
 TEST_CASE("Parse VRML File - Valid Input - Two Simple Nodes", "[parsing][valid]") {
   vrml_proc::parser::service::VrmlNodeManager manager;
   auto parseResult = ParseVrmlFile(twoSimpleNodes, manager);
@@ -597,3 +653,456 @@ TEST_CASE("Parse VRML File - Valid Input - Complicated node with complicated DEF
   auto parseResult = ParseVrmlFile(complicatedNodeWithComplicatedDefNodeNames, manager);
   REQUIRE(parseResult);
 }
+
+static vrml_proc::parser::ParserResult<vrml_proc::parser::model::VrmlScanStatistics> ScanVrmlFile(
+    const std::string& text) {
+  vrml_proc::parser::VrmlScanner scanner;
+  return scanner.Parse(vrml_proc::parser::BufferView(text.c_str(), text.c_str() + text.size()));
+}
+
+TEST_CASE("Scan VRML File - Valid Input - Simple VRML File", "[scanning][valid]") {
+  auto scanResult = ScanVrmlFile(simpleValid);
+  REQUIRE(scanResult);
+  CHECK(scanResult.value().nodesCount == 1);
+  CHECK(scanResult.value().rootNodesCount == 1);
+  CHECK(scanResult.value().fieldsCount == 2);
+  CHECK(scanResult.value().maxDepth == 1);
+  CHECK(scanResult.value().nodeTypesCount.at("WorldInfo") == 1);
+}
+
+TEST_CASE("Scan VRML File - Valid Input - Complicated Node", "[scanning][valid]") {
+  auto scanResult = ScanVrmlFile(complicatedNode);
+  REQUIRE(scanResult);
+  CHECK(scanResult.value().nodesCount == 28);
+  CHECK(scanResult.value().rootNodesCount == 2);
+  CHECK(scanResult.value().defNodesCount == 20);
+  CHECK(scanResult.value().useNodesCount == 2);
+  CHECK(scanResult.value().maxDepth == 11);
+  CHECK(scanResult.value().coordinatesCount == 3);
+  CHECK(scanResult.value().coordinateIndicesCount == 80);
+  CHECK(scanResult.value().facesCount == 20);
+}
+
+TEST_CASE("Scan VRML File - Valid Input - Textured IndexedFaceSet", "[scanning][valid]") {
+  std::string text = R"(#VRML V2.0 utf8
+    Shape {
+      geometry IndexedFaceSet {
+        coord Coordinate { point [ 0 0 0, 1 0 0, 1 1 0, 0 1 0 ] }
+        texCoord TextureCoordinate { point [ 0 0, 1 0, 1 1, 0 1, 0.5 0.5, 0.5 0 ] }
+        coordIndex [ 0, 1, 2, -1, 0, 2, 3 ]
+        texCoordIndex [ 0, 1, 2, -1, 0, 2, 3 ]
+      }
+    }
+  )";
+
+  auto scanResult = ScanVrmlFile(text);
+  REQUIRE(scanResult);
+  CHECK(scanResult.value().nodesCount == 4);
+  CHECK(scanResult.value().coordinatesCount == 4);
+  CHECK(scanResult.value().coordinateIndicesCount == 7);
+  CHECK(scanResult.value().facesCount == 2);
+}
+
+TEST_CASE("Scan VRML File - Valid Input - Agrees With Parser", "[scanning][valid]") {
+  for (auto* text : {&simpleValid, &twoSimpleNodes, &nodeInNode, &quiteDeepRecursiveNode, &groupWithNodesArray,
+           &simpleDefNode, &simpleUseNode, &nodeWithSwitch, &nodeWithBoolean, &nodeWithUtf8, &emptyNode,
+           &complicatedNodeWithComplicatedDefNodeNames, &fimuni}) {
+    vrml_proc::parser::service::VrmlNodeManager manager;
+    REQUIRE(ParseVrmlFile(*text, manager));
+    CHECK(ScanVrmlFile(*text));
+  }
+}
+
+TEST_CASE("Scan VRML File - Invalid Input - Error Position", "[scanning][invalid]") {
+  {
+    auto scanResult = ScanVrmlFile(simpleInvalidChar);
+    REQUIRE_FALSE(scanResult);
+    auto error = GetInnermostError<vrml_proc::parser::error::ScannerError>(scanResult.error());
+    REQUIRE(error != nullptr);
+    CHECK(error->GetLine() == 5);
+    CHECK(error->GetColumn() == 7);
+  }
+  {
+    auto scanResult = ScanVrmlFile(simpleInvalidStartingWithNumber);
+    REQUIRE_FALSE(scanResult);
+    auto error = GetInnermostError<vrml_proc::parser::error::ScannerError>(scanResult.error());
+    REQUIRE(error != nullptr);
+    CHECK(error->GetLine() == 5);
+    CHECK(error->GetColumn() == 2);
+  }
+  {
+    std::string unclosed = "#VRML V2.0 utf8\nShape {\n  geometry Box { size [ 1 2 }\n";
+    auto scanResult = ScanVrmlFile(unclosed);
+    REQUIRE_FALSE(scanResult);
+    auto error = GetInnermostError<vrml_proc::parser::error::ScannerError>(scanResult.error());
+    REQUIRE(error != nullptr);
+    CHECK(error->GetOffset() == unclosed.find('}'));
+  }
+}
+
+/**
+ * @brief Creates VRML file with one IndexedFaceSet node.
+ *
+ * @param pointsCount number of points (and triangles)
+ * @param indented whether the file is pretty-printed with deep indentation and comments, or minified
+ * @returns VRML text
+ */
+static std::string CreateIndexedFaceSetFile(size_t pointsCount, bool indented) {
+  std::string newline = indented ? "\n" : " ";
+  std::string indentation = indented ? "                " : "";
+
+  std::ostringstream stream;
+  stream << "#VRML V2.0 utf8\n";
+  if (indented) {
+    stream << "# Generated IndexedFaceSet.\n";
+  }
+  stream << "Shape {" << newline << "geometry IndexedFaceSet {" << newline << "coord Coordinate {" << newline
+         << "point [" << newline;
+  for (size_t i = 0; i < pointsCount; ++i) {
+    stream << indentation << (i % 97) * 0.25 << " " << (i % 89) * 0.5 << " " << (i % 83) * 0.125
+           << (i + 1 < pointsCount ? "," : "") << newline;
+  }
+  stream << "]" << newline << "}" << newline;
+  if (indented) {
+    stream << indentation << "# Triangles.\n";
+  }
+  stream << "coordIndex [" << newline;
+  for (size_t i = 0; i < pointsCount; ++i) {
+    stream << indentation << i << ", " << (i + 1) % pointsCount << ", " << (i + 2) % pointsCount << ", -1"
+           << (i + 1 < pointsCount ? "," : "") << newline;
+  }
+  stream << "]" << newline << "}" << newline << "}\n";
+  return stream.str();
+}
+
+/**
+ * @brief Gets number of points of the IndexedFaceSet created by `CreateIndexedFaceSetFile()`.
+ */
+static size_t GetIndexedFaceSetPointsCount(const vrml_proc::parser::model::VrmlFile& file) {
+  const auto& geometry = boost::get<vrml_proc::parser::model::VrmlNode>(file.at(0).fields.at(0).value);
+  const auto& coord = boost::get<vrml_proc::parser::model::VrmlNode>(geometry.fields.at(0).value);
+  return boost::get<vrml_proc::parser::model::Vec3fArray>(coord.fields.at(0).value).vectors.size();
+}
+
+TEST_CASE("Parse VRML File - Valid Input - Comments And Whitespaces", "[parsing][valid]") {
+  std::string text =
+      "#VRML V2.0 utf8\r\n# Comment with CRLF.\r\n\t\tWorldInfo { # comment after brace\n\v\f  title \"# not a "
+      "comment\"#comment\rinfo \"VRML file.\"\n}\n# Comment at the end without newline.";
+
+  vrml_proc::parser::service::VrmlNodeManager manager;
+  auto parseResult = ParseVrmlFile(text, manager);
+  REQUIRE(parseResult);
+
+  const auto& root = parseResult.value().at(0);
+  CHECK(root.header == "WorldInfo");
+  REQUIRE(root.fields.size() == 2);
+  CHECK(boost::get<std::string>(root.fields.at(0).value) == "# not a comment");
+  CHECK(boost::get<std::string>(root.fields.at(1).value) == "VRML file.");
+}
+
+TEST_CASE("Parse VRML File - Valid Input - Indented And Minified", "[parsing][valid]") {
+  std::string indented = CreateIndexedFaceSetFile(1000, true);
+  std::string minified = CreateIndexedFaceSetFile(1000, false);
+
+  vrml_proc::parser::service::VrmlNodeManager manager;
+  auto indentedResult = ParseVrmlFile(indented, manager);
+  auto minifiedResult = ParseVrmlFile(minified, manager);
+  REQUIRE(indentedResult);
+  REQUIRE(minifiedResult);
+  CHECK(GetIndexedFaceSetPointsCount(indentedResult.value()) == 1000);
+  CHECK(GetIndexedFaceSetPointsCount(minifiedResult.value()) == 1000);
+}
+
+TEST_CASE("Parse VRML File - Valid Input - Schema-Aware Parsing", "[parsing][valid]") {
+  using namespace vrml_proc::parser::model;
+
+  std::string text = R"(#VRML V2.0 utf8
+    Shape {
+      appearance Appearance {
+        material Material { transparency 1 shininess 0.5 }
+        texture ImageTexture { url "texture.png" repeatS TRUE }
+      }
+      geometry IndexedFaceSet {
+        coord Coordinate { point [ 0 0 0, 1 0 0, 1 1 0 ] }
+        texCoord TextureCoordinate { point [ 0 0, 1 0, 1 1 ] }
+        coordIndex [ 0, 1, 2, -1 ]
+        texCoordIndex [ ]
+      }
+    }
+    Group { children [ ] }
+    CustomNode { value 1 2 3 }
+  )";
+
+  vrml_proc::parser::service::VrmlNodeManager manager;
+  vrml_proc::parser::VrmlParser parser(manager, true);
+  auto parseResult = parser.Parse(vrml_proc::parser::BufferView(text.c_str(), text.c_str() + text.size()));
+  REQUIRE(parseResult);
+  REQUIRE(parseResult.value().size() == 3);
+
+  const auto& shape = parseResult.value().at(0);
+  const auto& appearance = boost::get<VrmlNode>(shape.fields.at(0).value);
+  const auto& material = boost::get<VrmlNode>(appearance.fields.at(0).value);
+  /** Integer of a Float32 field is parsed as integer, the same as without the schema. */
+  CHECK(boost::get<int32_t>(&material.fields.at(0).value) != nullptr);
+  CHECK(boost::get<float32_t>(&material.fields.at(1).value) != nullptr);
+
+  const auto& faceSet = boost::get<VrmlNode>(shape.fields.at(1).value);
+  const auto& texCoord = boost::get<VrmlNode>(faceSet.fields.at(1).value);
+  REQUIRE(boost::get<Vec2fArray>(&texCoord.fields.at(0).value) != nullptr);
+  CHECK(boost::get<Vec2fArray>(texCoord.fields.at(0).value).vectors.size() == 3);
+  REQUIRE(boost::get<Int32Array>(&faceSet.fields.at(2).value) != nullptr);
+  CHECK(boost::get<Int32Array>(faceSet.fields.at(2).value).integers.size() == 4);
+  /** Empty array does not match Int32Array grammar, so it is parsed by the generic alternative. */
+  CHECK(boost::get<Vec3fArray>(&faceSet.fields.at(3).value) != nullptr);
+
+  const auto& group = parseResult.value().at(1);
+  REQUIRE(boost::get<VrmlNodeArray>(&group.fields.at(0).value) != nullptr);
+  CHECK(boost::get<VrmlNodeArray>(group.fields.at(0).value).empty());
+
+  const auto& custom = parseResult.value().at(2);
+  CHECK(boost::get<Vec3f>(&custom.fields.at(0).value) != nullptr);
+}
+
+TEST_CASE("Parse VRML File - Schema-Aware Parsing - Accepts The Same Files", "[parsing]") {
+  std::vector<std::string> texts = {simpleValid, simpleInvalidChar, simpleInvalidStartingWithNumber, twoSimpleNodes,
+      nodeInNode, quiteDeepRecursiveNode, groupWithNodesArray, simpleDefNode, simpleUseNode, nodeWithSwitch,
+      nodeWithBoolean, nodeWithUtf8, emptyNode, complicatedNode, complicatedNodeWithComplicatedDefNodeNames, fimuni};
+
+  for (const auto& text : texts) {
+    vrml_proc::parser::service::VrmlNodeManager genericManager;
+    vrml_proc::parser::service::VrmlNodeManager schemaManager;
+    vrml_proc::parser::VrmlParser genericParser(genericManager);
+    vrml_proc::parser::VrmlParser schemaParser(schemaManager, true);
+    vrml_proc::parser::BufferView buffer(text.c_str(), text.c_str() + text.size());
+    auto genericResult = genericParser.Parse(buffer);
+    auto schemaResult = schemaParser.Parse(buffer);
+
+    REQUIRE(genericResult.has_value() == schemaResult.has_value());
+    if (genericResult.has_value()) {
+      CHECK(genericResult.value().size() == schemaResult.value().size());
+      CHECK(genericManager.GetDefNodesTotalCount() == schemaManager.GetDefNodesTotalCount());
+    }
+  }
+}
+
+TEST_CASE("Parse VRML File - Schema-Aware Parsing - Values Of Another Shape", "[parsing][valid]") {
+  using namespace vrml_proc::parser::model;
+
+  /**
+   * Sub-grammar of the field type matches only a prefix of each value, so the value must be parsed by the generic
+   * alternative as a whole. The field after the value must be parsed as well.
+   */
+  struct Case {
+    std::string node;
+    std::function<bool(const VrmlFieldValue&)> check;
+  };
+  std::vector<Case> cases = {
+      {"Material { shininess 0.5 0.5 0.5 transparency 0.5 }",
+          [](const VrmlFieldValue& value) { return boost::get<Vec3f>(&value) != nullptr; }},
+      {"TextureTransform { scale 1.0 2.0 3.0 rotation 0.5 }",
+          [](const VrmlFieldValue& value) { return boost::get<Vec3f>(&value) != nullptr; }},
+      {"Material { diffuseColor 1 0 0 1 shininess 0.5 }",
+          [](const VrmlFieldValue& value) { return boost::get<Vec4f>(&value) != nullptr; }},
+      {"ElevationGrid { xDimension 2 3 zDimension 2 }",
+          [](const VrmlFieldValue& value) { return boost::get<Vec2f>(&value) != nullptr; }},
+  };
+
+  for (const auto& testCase : cases) {
+    std::string text = "#VRML V2.0 utf8\n" + testCase.node + "\n";
+    vrml_proc::parser::service::VrmlNodeManager genericManager;
+    vrml_proc::parser::service::VrmlNodeManager schemaManager;
+    vrml_proc::parser::VrmlParser genericParser(genericManager);
+    vrml_proc::parser::VrmlParser schemaParser(schemaManager, true);
+    vrml_proc::parser::BufferView buffer(text.c_str(), text.c_str() + text.size());
+    auto genericResult = genericParser.Parse(buffer);
+    auto schemaResult = schemaParser.Parse(buffer);
+
+    INFO(testCase.node);
+    REQUIRE(genericResult.has_value());
+    REQUIRE(schemaResult.has_value());
+
+    const auto& genericNode = genericResult.value().at(0);
+    const auto& schemaNode = schemaResult.value().at(0);
+    REQUIRE(schemaNode.fields.size() == 2);
+    REQUIRE(genericNode.fields.size() == 2);
+    CHECK(testCase.check(schemaNode.fields.at(0).value));
+    for (size_t i = 0; i < schemaNode.fields.size(); ++i) {
+      CHECK(schemaNode.fields.at(i).name == genericNode.fields.at(i).name);
+      CHECK(schemaNode.fields.at(i).value.which() == genericNode.fields.at(i).value.which());
+    }
+  }
+}
+
+TEST_CASE("Parse VRML File - Valid Input - Skipped Fields", "[parsing][valid]") {
+  using namespace vrml_proc::parser::model;
+
+  std::string text = R"(#VRML V2.0 utf8
+    IndexedFaceSet {
+      coord Coordinate { point [ 0 0 0, 1 0 0, 1 1 0 ] }
+      texCoord TextureCoordinate { point [ 0 0, 1 0, # comment with ]
+        1 1 ] }
+      coordIndex [ 0, 1, 2, -1 ]
+      texCoordIndex [ 0 1 2 -1 ]
+      colorIndex 5
+    }
+  )";
+
+  vrml_proc::parser::grammar::SkippedFields skippedFields;
+  vrml_proc::parser::grammar::AddSkippedField(skippedFields, "IndexedFaceSet.texCoordIndex");
+  vrml_proc::parser::grammar::AddSkippedField(skippedFields, "IndexedFaceSet.colorIndex");
+  vrml_proc::parser::grammar::AddSkippedField(skippedFields, "TextureCoordinate.point");
+
+  vrml_proc::parser::service::VrmlNodeManager manager;
+  vrml_proc::parser::VrmlParser parser(manager, false, skippedFields);
+  auto parseResult = parser.Parse(vrml_proc::parser::BufferView(text.c_str(), text.c_str() + text.size()));
+  REQUIRE(parseResult);
+
+  const auto& faceSet = parseResult.value().at(0);
+  const auto& coord = boost::get<VrmlNode>(faceSet.fields.at(0).value);
+  CHECK(boost::get<Vec3fArray>(&coord.fields.at(0).value) != nullptr);
+  REQUIRE(boost::get<Int32Array>(&faceSet.fields.at(2).value) != nullptr);
+
+  const auto& texCoord = boost::get<VrmlNode>(faceSet.fields.at(1).value);
+  REQUIRE(boost::get<UnparsedValue>(&texCoord.fields.at(0).value) != nullptr);
+  const auto& point = boost::get<UnparsedValue>(texCoord.fields.at(0).value);
+  CHECK(point.text == "[ 0 0, 1 0, # comment with ]\n        1 1 ]");
+
+  REQUIRE(boost::get<UnparsedValue>(&faceSet.fields.at(3).value) != nullptr);
+  /** Skipped text is a copy, so it does not depend on the parsed buffer. */
+  std::fill(text.begin(), text.end(), ' ');
+  CHECK(boost::get<UnparsedValue>(faceSet.fields.at(3).value).text == "[ 0 1 2 -1 ]");
+  /** Only bracketed arrays are skipped, other values are parsed as usual. */
+  CHECK(boost::get<int32_t>(&faceSet.fields.at(4).value) != nullptr);
+}
+
+TEST_CASE("Parse VRML File - Valid Input - Pruned Nodes", "[parsing][valid]") {
+  using namespace vrml_proc::parser::model;
+
+  std::string text = R"(#VRML V2.0 utf8
+    WorldInfo { title "Braces { in string" info [ "}" ] # comment }
+    }
+    Group {
+      children [
+        DEF Timer TimeSensor { cycleInterval 2 loop TRUE },
+        Collision { proxy DEF Inner Shape { } },
+        Shape { geometry Box { size 1 2 3 } }
+      ]
+    }
+  )";
+
+  vrml_proc::parser::service::VrmlNodeManager manager;
+  vrml_proc::parser::VrmlParser parser(manager);
+  parser.SetPrunedHeaders({"WorldInfo", "TimeSensor", "Collision"});
+  auto parseResult = parser.Parse(vrml_proc::parser::BufferView(text.c_str(), text.c_str() + text.size()));
+  REQUIRE(parseResult);
+  REQUIRE(parseResult.value().size() == 2);
+
+  const auto& worldInfo = parseResult.value().at(0);
+  CHECK(worldInfo.header == "WorldInfo");
+  CHECK(worldInfo.IsPruned());
+  CHECK(worldInfo.fields.empty());
+  CHECK(worldInfo.skippedBody.text.front() == '{');
+  CHECK(worldInfo.skippedBody.text.back() == '}');
+
+  const auto& children = boost::get<VrmlNodeArray>(parseResult.value().at(1).fields.at(0).value);
+  REQUIRE(children.size() == 3);
+
+  const auto& timer = boost::get<VrmlNode>(children.at(0));
+  CHECK(timer.IsPruned());
+  CHECK(timer.skippedBody.text == "{ cycleInterval 2 loop TRUE }");
+  CHECK(timer.definitionName.value() == "Timer");
+
+  /** Body with a DEF node is parsed, so the DEF node is known. */
+  const auto& collision = boost::get<VrmlNode>(children.at(1));
+  CHECK_FALSE(collision.IsPruned());
+  CHECK(manager.GetDefNodesTotalCount() == 2);
+
+  const auto& shape = boost::get<VrmlNode>(children.at(2));
+  CHECK_FALSE(shape.IsPruned());
+  CHECK(shape.fields.size() == 1);
+}
+
+TEST_CASE("Parse VRML File - Valid Input - DEF Nodes Registered During Parsing", "[parsing][valid]") {
+  using namespace vrml_proc::parser::model;
+
+  std::string text = R"(#VRML V2.0 utf8
+    DEF A Group { children [ DEF A Shape { } ] }
+    DEF B Shape { }
+    Group { children [ DEF B Box { } ] }
+    DEF B Sphere { }
+    Group { children [ Group { children [ Shape { } ] } ] }
+  )";
+
+  vrml_proc::parser::service::VrmlNodeManager manager;
+  auto parseResult = ParseVrmlFile(text, manager);
+  REQUIRE(parseResult);
+  const auto& file = parseResult.value();
+  REQUIRE(file.size() == 5);
+
+  /** The last DEF node of the given name in the file is registered. */
+  const auto& nested = boost::get<VrmlNode>(boost::get<VrmlNodeArray>(file.at(0).fields.at(0).value).at(0));
+  auto a = manager.GetDefinitionNode("A");
+  REQUIRE(a.has_value());
+  CHECK(&a.value().get() == &nested);
+
+  auto b = manager.GetDefinitionNode("B");
+  REQUIRE(b.has_value());
+  CHECK(&b.value().get() == &file.at(3));
+  CHECK(b.value().get().header == "Sphere");
+
+  CHECK(file.at(0).containsReferences);
+  CHECK(file.at(2).containsReferences);
+  CHECK_FALSE(file.at(4).containsReferences);
+}
+
+TEST_CASE("Parse VRML File - Valid Input - USE Nodes Linked To Preceding DEF Nodes", "[parsing][valid]") {
+  using namespace vrml_proc::parser::model;
+
+  std::string text = R"(#VRML V2.0 utf8
+    DEF A Shape { }
+    Group { children [ USE A, DEF A Box { }, USE A, USE C ] }
+    Shape { geometry USE A appearance USE C }
+    Group { children [ Group { children [ Shape { } ] } ] }
+  )";
+
+  vrml_proc::parser::service::VrmlNodeManager manager;
+  auto parseResult = ParseVrmlFile(text, manager);
+  REQUIRE(parseResult);
+  const auto& file = parseResult.value();
+  REQUIRE(file.size() == 4);
+
+  /** Each USE node refers to the last DEF node of its name before it. */
+  const auto& children = boost::get<VrmlNodeArray>(file.at(1).fields.at(0).value);
+  REQUIRE(children.size() == 4);
+  const auto& box = boost::get<VrmlNode>(children.at(1));
+  CHECK(boost::get<UseNode>(children.at(0)).definition == &file.at(0));
+  CHECK(boost::get<UseNode>(children.at(2)).definition == &box);
+  CHECK(boost::get<UseNode>(file.at(2).fields.at(0).value).definition == &box);
+
+  /** USE node of an undefined name is not linked. */
+  CHECK(boost::get<UseNode>(children.at(3)).definition == nullptr);
+  CHECK(boost::get<UseNode>(file.at(2).fields.at(1).value).definition == nullptr);
+
+  /** Linked node is returned by the extractor. */
+  auto geometry = vrml_proc::parser::model::utils::VrmlFieldExtractor::ExtractVrmlNode(
+      "geometry", file.at(2).fields, manager);
+  REQUIRE(geometry.has_value());
+  CHECK(&geometry.value().get() == &box);
+
+  CHECK(file.at(1).containsReferences);
+  CHECK(file.at(2).containsReferences);
+  CHECK_FALSE(file.at(3).containsReferences);
+}
+
+TEST_CASE("Parse VRML File - Throughput - Indented And Minified", "[parsing][!benchmark]") {
+  std::string indented = CreateIndexedFaceSetFile(100000, true);
+  std::string minified = CreateIndexedFaceSetFile(100000, false);
+
+  vrml_proc::parser::service::VrmlNodeManager manager;
+  BENCHMARK("Indented input (" + std::to_string(indented.size()) + " bytes)") {
+    return ParseVrmlFile(indented, manager).has_value();
+  };
+  BENCHMARK("Minified input (" + std::to_string(minified.size()) + " bytes)") {
+    return ParseVrmlFile(minified, manager).has_value();
+  };
+}
@@ -0,0 +1,19 @@
+#include <string>
+
+std::string float32Array = R"(
+
+	[   0.0 0.25 1.5 -2
+        3.75, 4.0, # comment
+        -5.5e1 6 ,
+    ]
+)";
+
+std::string emptyFloat32Array = R"(
+
+	[ ]
+)";
+
+std::string invalidFloat32Array = R"(
+
+	[ 0.0 1.0 Box ]
+)";
@@ -123,3 +123,21 @@ std::string complicatedEdgeCase = R"(
         float 15.5
     }
 )";
+
+std::string float32ArrayEdgeCase = R"(
+
+    #VRML V2.0 utf8
+
+    ElevationGrid {
+        height [ 1, 2, 3, 4 ]
+    }
+
+    Extrusion {
+        scale 0.5 1.5
+        orientation 0 1 0 1.5
+    }
+
+    Test {
+        vectors [ 0.5 1.5 2.5, 3.5 4.5 5.5 ]
+    }
+)";